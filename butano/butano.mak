@@ -161,6 +161,16 @@ export LIBPATHS         :=  $(foreach dir,$(LIBDIRS),-L$(dir)/lib)
 
 .PHONY: $(BUILD) clean
  
+#---------------------------------------------------------------------------------------------------------------------
+# VRAM tool options (BG blocks and sprite tiles max items are read from USERFLAGS):
+#---------------------------------------------------------------------------------------------------------------------
+BGBLOCKSMAXITEMS        :=  $(patsubst -DBN_CFG_BG_BLOCKS_MAX_ITEMS=%,%,\
+                                $(filter -DBN_CFG_BG_BLOCKS_MAX_ITEMS=%,$(USERFLAGS)))
+SPRITETILESMAXITEMS     :=  $(patsubst -DBN_CFG_SPRITE_TILES_MAX_ITEMS=%,%,\
+                                $(filter -DBN_CFG_SPRITE_TILES_MAX_ITEMS=%,$(USERFLAGS)))
+VRAMTOOLFLAGS           :=  $(if $(BGBLOCKSMAXITEMS),--bg_blocks_max_items=$(BGBLOCKSMAXITEMS)) \
+                                $(if $(SPRITETILESMAXITEMS),--sprite_tiles_max_items=$(SPRITETILESMAXITEMS))
+
 #---------------------------------------------------------------------------------
 all:
 	@[ -d $(BUILD) ] || mkdir -p $(BUILD)
@@ -171,6 +181,8 @@ all:
 $(BUILD):
 	@$(PYTHON) -B $(LIBBUTANOABS)/tools/butano_assets_tool.py --audio="$(AUDIO)" --dmg_audio="$(DMGAUDIO)" \
 			--graphics="$(GRAPHICS)" --build=$(BUILD)
+	@$(if $(SCENES),$(PYTHON) -B $(LIBBUTANOABS)/tools/butano_vram_tool.py --scenes="$(SCENES)" --build=$(BUILD) \
+			$(VRAMTOOLFLAGS))
 	@$(MAKE) --no-print-directory -C $(BUILD) -f $(CURDIR)/Makefile
 
 #---------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_HW_AFFINE_BG_PERSPECTIVE_H
+#define BN_HW_AFFINE_BG_PERSPECTIVE_H
+
+#include "bn_common.h"
+
+namespace bn::hw::affine_bg_perspective
+{
+    class input
+    {
+
+    public:
+        int camera_x;
+        int camera_y;
+        int camera_height;
+        int sin;
+        int cos;
+        int horizon;
+        int focal_distance;
+    };
+
+    BN_CODE_IWRAM void calculate(const input& input, int16_t* pa_values_ptr, int16_t* pc_values_ptr,
+                                 int* dx_values_ptr, int* dy_values_ptr);
+}
+
+#endif
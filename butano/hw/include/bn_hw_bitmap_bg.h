@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_HW_BITMAP_BG_H
+#define BN_HW_BITMAP_BG_H
+
+#include "bn_hw_tonc.h"
+
+namespace bn::hw::bitmap_bg
+{
+    [[nodiscard]] constexpr int page_half_words()
+    {
+        return 0xA000 / 2;
+    }
+
+    [[nodiscard]] constexpr int reserved_sprite_tiles_count()
+    {
+        return 512;
+    }
+
+    [[nodiscard]] inline uint16_t* page_vram(int page)
+    {
+        return reinterpret_cast<uint16_t*>(MEM_VRAM) + (page * page_half_words());
+    }
+
+    BN_CODE_IWRAM void fill_16(unsigned color, int width, int height, int pitch, uint16_t* destination_ptr);
+
+    BN_CODE_IWRAM void fill_8(unsigned color_index, int x, int width, int height, int pitch,
+                              uint16_t* destination_ptr);
+
+    BN_CODE_IWRAM void copy_16(const uint16_t* source_ptr, int source_pitch, int width, int height, int pitch,
+                               uint16_t* destination_ptr);
+
+    BN_CODE_IWRAM void copy_8(const uint8_t* source_ptr, int source_pitch, int x, int width, int height, int pitch,
+                              uint16_t* destination_ptr);
+
+    BN_CODE_IWRAM void scaled_copy_16(const uint16_t* source_ptr, int source_pitch, unsigned source_x,
+                                      unsigned source_y, unsigned x_step, unsigned y_step, int width, int height,
+                                      int pitch, uint16_t* destination_ptr);
+
+    BN_CODE_IWRAM void scaled_copy_8(const uint8_t* source_ptr, int source_pitch, unsigned source_x,
+                                     unsigned source_y, unsigned x_step, unsigned y_step, int x, int width,
+                                     int height, int pitch, uint16_t* destination_ptr);
+
+    BN_CODE_IWRAM void line_16(unsigned color, int x0, int y0, int x1, int y1, int width, int height, int pitch,
+                               uint16_t* destination_ptr);
+
+    BN_CODE_IWRAM void line_8(unsigned color_index, int x0, int y0, int x1, int y1, int width, int height,
+                              int pitch, uint16_t* destination_ptr);
+}
+
+#endif
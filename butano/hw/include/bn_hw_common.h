@@ -16,6 +16,13 @@
  */
 #define BN_CODE_IWRAM __attribute__((section(".iwram")))
 
+/**
+ * @brief Store code in the specified IWRAM overlay (from 0 to 9).
+ *
+ * See bn::iwram_overlay.
+ */
+#define BN_CODE_IWRAM_OVERLAY(id) __attribute__((section(".iwram" #id)))
+
 /**
  * @brief Store code in EWRAM.
  */
@@ -42,10 +42,16 @@ namespace bn::hw::display
     }
 
     inline void set_display(
-            int mode, const bool* enabled_bgs, const bool* enabled_inside_windows, uint16_t& display_cnt)
+            int mode, int bitmap_page, const bool* enabled_bgs, const bool* enabled_inside_windows,
+            uint16_t& display_cnt)
     {
         unsigned dispcnt = unsigned(mode) | DCNT_OBJ | DCNT_OBJ_1D;
 
+        if(bitmap_page)
+        {
+            dispcnt |= DCNT_PAGE;
+        }
+
         for(int index = 0; index < bgs::count(); ++index)
         {
             if(enabled_bgs[index])
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_HW_IWRAM_OVERLAY_H
+#define BN_HW_IWRAM_OVERLAY_H
+
+#include "bn_common.h"
+
+namespace bn::hw::iwram_overlay
+{
+    [[nodiscard]] constexpr int count()
+    {
+        return 10;
+    }
+
+    [[nodiscard]] int window_size();
+
+    [[nodiscard]] int size(int id);
+
+    void load(int id);
+}
+
+#endif
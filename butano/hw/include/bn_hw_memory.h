@@ -26,8 +26,17 @@ namespace bn::hw::memory
         return int(ptr) >= MEM_PAL && int(ptr) < MEM_ROM;
     }
 
+    [[nodiscard]] inline bool in_rom(const void* ptr)
+    {
+        return int(ptr) >= MEM_ROM && int(ptr) < MEM_SRAM;
+    }
+
     [[nodiscard]] int used_stack_iwram(int current_stack_address);
 
+    void paint_stack_iwram(int current_stack_address);
+
+    [[nodiscard]] int max_used_stack_iwram(int previous_max_used_stack_iwram);
+
     [[nodiscard]] int used_static_iwram();
 
     [[nodiscard]] int used_static_ewram();
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "../include/bn_hw_affine_bg_perspective.h"
+
+#include "bn_array.h"
+#include "bn_display.h"
+#include "bn_algorithm.h"
+#include "bn_reciprocal_lut.h"
+
+namespace bn::hw::affine_bg_perspective
+{
+
+void calculate(const input& input, int16_t* pa_values_ptr, int16_t* pc_values_ptr, int* dx_values_ptr,
+               int* dy_values_ptr)
+{
+    // Lines above the horizon point outside the map, so they are transparent if wrapping is disabled:
+    int horizon = input.horizon;
+
+    for(int line = 0; line <= horizon; ++line)
+    {
+        pa_values_ptr[line] = 0;
+        pc_values_ptr[line] = 0;
+        dx_values_ptr[line] = -256;
+        dy_values_ptr[line] = -256;
+    }
+
+    // Scale is clamped to keep pa and pc inside the 8.8 registers range:
+    constexpr int max_scale = (32767 << 4);
+    constexpr int center_x = display::width() / 2;
+
+    const fixed_t<20>* reciprocal_lut_ptr = reciprocal_lut.data();
+    int64_t camera_height = input.camera_height;
+    int camera_x = input.camera_x >> 4;
+    int camera_y = input.camera_y >> 4;
+    int sin = input.sin;
+    int cos = input.cos;
+    int focal_distance = input.focal_distance;
+
+    for(int line = horizon + 1; line < display::height(); ++line)
+    {
+        int scale = int((camera_height * reciprocal_lut_ptr[line - horizon].data()) >> 20);
+        scale = min(scale, max_scale);
+
+        int scale_cos = (scale * cos) >> 12;
+        int scale_sin = (scale * sin) >> 12;
+        int pa = scale_cos >> 4;
+        int pc = scale_sin >> 4;
+        pa_values_ptr[line] = int16_t(pa);
+        pc_values_ptr[line] = int16_t(pc);
+        dx_values_ptr[line] = camera_x - (center_x * pa) + ((focal_distance * scale_sin) >> 4);
+        dy_values_ptr[line] = camera_y - (center_x * pc) - ((focal_distance * scale_cos) >> 4);
+    }
+}
+
+}
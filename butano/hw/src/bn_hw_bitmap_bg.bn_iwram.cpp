@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "../include/bn_hw_bitmap_bg.h"
+
+namespace bn::hw::bitmap_bg
+{
+
+namespace
+{
+    // VRAM doesn't support 8-bit writes, so 8bpp pixels are written with 16-bit read-modify-write operations:
+    inline void _plot_8(unsigned color_index, int x, uint16_t* row_ptr)
+    {
+        uint16_t& pair = row_ptr[x >> 1];
+
+        if(x & 1)
+        {
+            pair = uint16_t((pair & 0x00FF) | (color_index << 8));
+        }
+        else
+        {
+            pair = uint16_t((pair & 0xFF00) | color_index);
+        }
+    }
+}
+
+void fill_16(unsigned color, int width, int height, int pitch, uint16_t* destination_ptr)
+{
+    for(int y = 0; y < height; ++y)
+    {
+        for(int x = 0; x < width; ++x)
+        {
+            destination_ptr[x] = uint16_t(color);
+        }
+
+        destination_ptr += pitch;
+    }
+}
+
+void fill_8(unsigned color_index, int x, int width, int height, int pitch, uint16_t* destination_ptr)
+{
+    unsigned color_pair = color_index | (color_index << 8);
+    int x_limit = x + width;
+
+    for(int y = 0; y < height; ++y)
+    {
+        int row_x = x;
+
+        if(row_x & 1)
+        {
+            _plot_8(color_index, row_x, destination_ptr);
+            ++row_x;
+        }
+
+        for(; row_x + 1 < x_limit; row_x += 2)
+        {
+            destination_ptr[row_x >> 1] = uint16_t(color_pair);
+        }
+
+        if(row_x < x_limit)
+        {
+            _plot_8(color_index, row_x, destination_ptr);
+        }
+
+        destination_ptr += pitch / 2;
+    }
+}
+
+void copy_16(const uint16_t* source_ptr, int source_pitch, int width, int height, int pitch,
+             uint16_t* destination_ptr)
+{
+    for(int y = 0; y < height; ++y)
+    {
+        for(int x = 0; x < width; ++x)
+        {
+            destination_ptr[x] = source_ptr[x];
+        }
+
+        source_ptr += source_pitch;
+        destination_ptr += pitch;
+    }
+}
+
+void copy_8(const uint8_t* source_ptr, int source_pitch, int x, int width, int height, int pitch,
+            uint16_t* destination_ptr)
+{
+    int x_limit = x + width;
+
+    for(int y = 0; y < height; ++y)
+    {
+        const uint8_t* row_source_ptr = source_ptr;
+        int row_x = x;
+
+        if(row_x & 1)
+        {
+            _plot_8(*row_source_ptr, row_x, destination_ptr);
+            ++row_source_ptr;
+            ++row_x;
+        }
+
+        for(; row_x + 1 < x_limit; row_x += 2)
+        {
+            destination_ptr[row_x >> 1] = uint16_t(row_source_ptr[0] | (row_source_ptr[1] << 8));
+            row_source_ptr += 2;
+        }
+
+        if(row_x < x_limit)
+        {
+            _plot_8(*row_source_ptr, row_x, destination_ptr);
+        }
+
+        source_ptr += source_pitch;
+        destination_ptr += pitch / 2;
+    }
+}
+
+void scaled_copy_16(const uint16_t* source_ptr, int source_pitch, unsigned source_x, unsigned source_y,
+                    unsigned x_step, unsigned y_step, int width, int height, int pitch, uint16_t* destination_ptr)
+{
+    for(int y = 0; y < height; ++y)
+    {
+        const uint16_t* row_source_ptr = source_ptr + ((source_y >> 16) * unsigned(source_pitch));
+        unsigned row_source_x = source_x;
+
+        for(int x = 0; x < width; ++x)
+        {
+            destination_ptr[x] = row_source_ptr[row_source_x >> 16];
+            row_source_x += x_step;
+        }
+
+        source_y += y_step;
+        destination_ptr += pitch;
+    }
+}
+
+void scaled_copy_8(const uint8_t* source_ptr, int source_pitch, unsigned source_x, unsigned source_y,
+                   unsigned x_step, unsigned y_step, int x, int width, int height, int pitch,
+                   uint16_t* destination_ptr)
+{
+    int x_limit = x + width;
+
+    for(int y = 0; y < height; ++y)
+    {
+        const uint8_t* row_source_ptr = source_ptr + ((source_y >> 16) * unsigned(source_pitch));
+        unsigned row_source_x = source_x;
+
+        for(int row_x = x; row_x < x_limit; ++row_x)
+        {
+            _plot_8(row_source_ptr[row_source_x >> 16], row_x, destination_ptr);
+            row_source_x += x_step;
+        }
+
+        source_y += y_step;
+        destination_ptr += pitch / 2;
+    }
+}
+
+void line_16(unsigned color, int x0, int y0, int x1, int y1, int width, int height, int pitch,
+             uint16_t* destination_ptr)
+{
+    int dx = x1 >= x0 ? x1 - x0 : x0 - x1;
+    int dy = y1 >= y0 ? y0 - y1 : y1 - y0;
+    int sx = x0 < x1 ? 1 : -1;
+    int sy = y0 < y1 ? 1 : -1;
+    int error = dx + dy;
+
+    while(true)
+    {
+        if(unsigned(x0) < unsigned(width) && unsigned(y0) < unsigned(height))
+        {
+            destination_ptr[(y0 * pitch) + x0] = uint16_t(color);
+        }
+
+        if(x0 == x1 && y0 == y1)
+        {
+            break;
+        }
+
+        int double_error = error * 2;
+
+        if(double_error >= dy)
+        {
+            error += dy;
+            x0 += sx;
+        }
+
+        if(double_error <= dx)
+        {
+            error += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void line_8(unsigned color_index, int x0, int y0, int x1, int y1, int width, int height, int pitch,
+            uint16_t* destination_ptr)
+{
+    int dx = x1 >= x0 ? x1 - x0 : x0 - x1;
+    int dy = y1 >= y0 ? y0 - y1 : y1 - y0;
+    int sx = x0 < x1 ? 1 : -1;
+    int sy = y0 < y1 ? 1 : -1;
+    int error = dx + dy;
+
+    while(true)
+    {
+        if(unsigned(x0) < unsigned(width) && unsigned(y0) < unsigned(height))
+        {
+            _plot_8(color_index, x0, destination_ptr + (y0 * (pitch / 2)));
+        }
+
+        if(x0 == x1 && y0 == y1)
+        {
+            break;
+        }
+
+        int double_error = error * 2;
+
+        if(double_error >= dy)
+        {
+            error += dy;
+            x0 += sx;
+        }
+
+        if(double_error <= dx)
+        {
+            error += dx;
+            y0 += sy;
+        }
+    }
+}
+
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "../include/bn_hw_iwram_overlay.h"
+
+#include "../include/bn_hw_memory.h"
+
+// Overlay sections and symbols defined by the devkitARM GBA cartridge linker script:
+extern unsigned __iwram_overlay_start;
+extern unsigned __iwram_overlay_end;
+extern unsigned __load_start_iwram0, __load_stop_iwram0;
+extern unsigned __load_start_iwram1, __load_stop_iwram1;
+extern unsigned __load_start_iwram2, __load_stop_iwram2;
+extern unsigned __load_start_iwram3, __load_stop_iwram3;
+extern unsigned __load_start_iwram4, __load_stop_iwram4;
+extern unsigned __load_start_iwram5, __load_stop_iwram5;
+extern unsigned __load_start_iwram6, __load_stop_iwram6;
+extern unsigned __load_start_iwram7, __load_stop_iwram7;
+extern unsigned __load_start_iwram8, __load_stop_iwram8;
+extern unsigned __load_start_iwram9, __load_stop_iwram9;
+
+namespace bn::hw::iwram_overlay
+{
+
+namespace
+{
+    const unsigned* const load_starts[] = {
+        &__load_start_iwram0, &__load_start_iwram1, &__load_start_iwram2, &__load_start_iwram3,
+        &__load_start_iwram4, &__load_start_iwram5, &__load_start_iwram6, &__load_start_iwram7,
+        &__load_start_iwram8, &__load_start_iwram9
+    };
+
+    const unsigned* const load_stops[] = {
+        &__load_stop_iwram0, &__load_stop_iwram1, &__load_stop_iwram2, &__load_stop_iwram3,
+        &__load_stop_iwram4, &__load_stop_iwram5, &__load_stop_iwram6, &__load_stop_iwram7,
+        &__load_stop_iwram8, &__load_stop_iwram9
+    };
+
+    static_assert(sizeof(load_starts) / sizeof(*load_starts) == count());
+    static_assert(sizeof(load_stops) / sizeof(*load_stops) == count());
+}
+
+int window_size()
+{
+    auto window_start = reinterpret_cast<uint8_t*>(&__iwram_overlay_start);
+    auto window_end = reinterpret_cast<uint8_t*>(&__iwram_overlay_end);
+    return window_end - window_start;
+}
+
+int size(int id)
+{
+    auto load_start = reinterpret_cast<const uint8_t*>(load_starts[id]);
+    auto load_stop = reinterpret_cast<const uint8_t*>(load_stops[id]);
+    return load_stop - load_start;
+}
+
+void load(int id)
+{
+    // Overlay sections are word aligned by the linker script:
+    memory::copy_words(load_starts[id], size(id) / 4, &__iwram_overlay_start);
+}
+
+}
@@ -5,6 +5,7 @@
 
 #include "../include/bn_hw_link.h"
 
+#include "bn_spsc_queue.h"
 #include "../include/bn_hw_irq.h"
 
 namespace bn::hw::link
@@ -12,16 +13,17 @@ namespace bn::hw::link
 
 namespace
 {
+    // Queues have room for twice the stored messages, so if the producer is faster than the consumer,
+    // the consumer can discard the oldest messages instead of the producer discarding the newest ones:
+    constexpr int queue_size = LINK_DEFAULT_BUFFER_SIZE * 2;
+
     class static_data
     {
 
     public:
         LinkConnection connection;
-        bn::deque<uint16_t, LINK_DEFAULT_BUFFER_SIZE> sendMessages;
-        bn::deque<LinkResponse, LINK_DEFAULT_BUFFER_SIZE> firstReceivedMessages;
-        bn::deque<LinkResponse, LINK_DEFAULT_BUFFER_SIZE> secondReceivedMessages;
-        volatile bool blockSendMessages = false;
-        volatile bool blockReceivedMessages = false;
+        spsc_queue<uint16_t, queue_size> sendMessages;
+        spsc_queue<LinkResponse, queue_size> receivedMessages;
         volatile bool clearSendMessages = false;
         volatile bool clearReceivedMessages = false;
         bool active = false;
@@ -38,74 +40,46 @@ namespace
         }
     }
 
-    void _sendDataCallback()
+    template<typename Queue>
+    void _discard_oldest_messages(Queue& queue)
     {
-        if(! data.blockSendMessages)
+        while(queue.size() > LINK_DEFAULT_BUFFER_SIZE)
         {
-            for(uint16_t message : data.sendMessages)
-            {
-                data.connection.send(message);
-            }
-
-            data.sendMessages.clear();
+            queue.pop();
         }
     }
 
-    void _receiveResponseCallback(const LinkResponse& response)
+    void _sendDataCallback()
     {
-        if(data.blockReceivedMessages)
+        if(data.clearSendMessages)
         {
-            if(data.secondReceivedMessages.full())
-            {
-                data.secondReceivedMessages.pop_front();
-            }
-
-            data.secondReceivedMessages.push_back(response);
+            data.clearSendMessages = false;
+            BN_BARRIER;
+            data.sendMessages.clear();
+            return;
         }
-        else
-        {
-            for(const LinkResponse& secondReceivedMessage : data.secondReceivedMessages)
-            {
-                if(data.firstReceivedMessages.full())
-                {
-                    data.firstReceivedMessages.pop_front();
-                }
 
-                data.firstReceivedMessages.push_back(secondReceivedMessage);
-            }
+        _discard_oldest_messages(data.sendMessages);
 
-            data.secondReceivedMessages.clear();
+        uint16_t message;
 
-            if(data.firstReceivedMessages.full())
-            {
-                data.firstReceivedMessages.pop_front();
-            }
-
-            data.firstReceivedMessages.push_back(response);
+        while(data.sendMessages.pop(message))
+        {
+            data.connection.send(message);
         }
     }
 
-    void _resetStateCallback()
+    void _receiveResponseCallback(const LinkResponse& response)
     {
-        if(data.blockSendMessages)
-        {
-            data.clearSendMessages = true;
-        }
-        else
-        {
-            data.sendMessages.clear();
-        }
-
-        if(data.blockReceivedMessages)
-        {
-            data.clearReceivedMessages = true;
-        }
-        else
-        {
-            data.firstReceivedMessages.clear();
-        }
+        data.receivedMessages.push(response);
+    }
 
-        data.secondReceivedMessages.clear();
+    void _resetStateCallback()
+    {
+        // This callback is called from both the main loop and the IRQs,
+        // so queues are cleared by their consumers (the send data callback and receive):
+        data.clearSendMessages = true;
+        data.clearReceivedMessages = true;
     }
 }
 
@@ -149,75 +123,23 @@ void send(int data_to_send)
 {
     _check_active();
 
-    BN_BARRIER;
-    data.blockSendMessages = true;
-    BN_BARRIER;
-
-    if(data.sendMessages.full())
-    {
-        data.sendMessages.pop_front();
-    }
-
-    data.sendMessages.push_back(data_to_send);
-
-    BN_BARRIER;
-    data.blockSendMessages = false;
-    BN_BARRIER;
-
-    if(data.clearSendMessages)
-    {
-        BN_BARRIER;
-        data.blockSendMessages = true;
-        BN_BARRIER;
-
-        data.sendMessages.clear();
-
-        BN_BARRIER;
-        data.blockSendMessages = false;
-        BN_BARRIER;
-
-        data.clearSendMessages = false;
-    }
+    data.sendMessages.push(uint16_t(data_to_send));
 }
 
 bool receive(LinkResponse& response)
 {
     _check_active();
 
-    BN_BARRIER;
-    data.blockReceivedMessages = true;
-    BN_BARRIER;
-
-    bool success = ! data.firstReceivedMessages.empty();
-
-    if(success)
-    {
-        response = data.firstReceivedMessages.front();
-        data.firstReceivedMessages.pop_front();
-    }
-
-    BN_BARRIER;
-    data.blockReceivedMessages = false;
-    BN_BARRIER;
-
     if(data.clearReceivedMessages)
     {
-        BN_BARRIER;
-        data.blockReceivedMessages = true;
-        BN_BARRIER;
-
-        data.firstReceivedMessages.clear();
-
-        BN_BARRIER;
-        data.blockReceivedMessages = false;
-        BN_BARRIER;
-
         data.clearReceivedMessages = false;
-
-        success = false;
+        BN_BARRIER;
+        data.receivedMessages.clear();
+        return false;
     }
 
-    return success;
+    _discard_oldest_messages(data.receivedMessages);
+    return data.receivedMessages.pop(response);
 }
 
 void _serial_intr()
@@ -6,11 +6,13 @@
 #include "../include/bn_hw_memory.h"
 
 #include "bn_random.h"
+#include "bn_algorithm.h"
 #include "bn_config_ewram.h"
 
 extern unsigned __iwram_start__;
 extern unsigned __iwram_top;
 extern unsigned __fini_array_end;
+extern unsigned __iwram_overlay_end;
 extern unsigned __ewram_start;
 extern unsigned __ewram_end;
 extern char __eheap_start[], __eheap_end[];
@@ -21,12 +23,21 @@ namespace bn::hw::memory
 static_assert(BN_CFG_EWRAM_WAIT_STATE == BN_EWRAM_WAIT_STATE_2 ||
         BN_CFG_EWRAM_WAIT_STATE == BN_EWRAM_WAIT_STATE_1);
 
-#if BN_CFG_EWRAM_WAIT_STATE == BN_EWRAM_WAIT_STATE_1
-    namespace
-    {
+namespace
+{
+    constexpr unsigned stack_canary = 0xB7A3B7A3;
+
+    #if BN_CFG_EWRAM_WAIT_STATE == BN_EWRAM_WAIT_STATE_1
         BN_DATA_EWRAM unsigned ewram_data;
+    #endif
+
+    [[nodiscard]] uint8_t* _static_iwram_end()
+    {
+        auto iwram_end = reinterpret_cast<uint8_t*>(&__fini_array_end);
+        auto iwram_overlay_end = reinterpret_cast<uint8_t*>(&__iwram_overlay_end);
+        return max(iwram_end, iwram_overlay_end);
     }
-#endif
+}
 
 void init()
 {
@@ -58,11 +69,40 @@ int used_stack_iwram(int current_stack_address)
     return iwram_top - iwram_stack;
 }
 
+void paint_stack_iwram(int current_stack_address)
+{
+    // Leave some room below the stack pointer for the frames of the functions called from here:
+    auto it = reinterpret_cast<unsigned*>(_static_iwram_end());
+    auto end = reinterpret_cast<unsigned*>(current_stack_address - 256);
+
+    while(it < end)
+    {
+        *it = stack_canary;
+        ++it;
+    }
+}
+
+int max_used_stack_iwram(int previous_max_used_stack_iwram)
+{
+    // Search upwards from the bottom of the painted area until the first overwritten word is found.
+    // Unwritten locals inside deeper frames keep their canary words, so searching downwards from the previous
+    // high-water mark would stop too early. Words above the previous high-water mark don't need to be checked:
+    auto iwram_top = reinterpret_cast<uint8_t*>(&__iwram_top);
+    auto it = reinterpret_cast<const unsigned*>(_static_iwram_end());
+    auto end = reinterpret_cast<const unsigned*>(iwram_top - previous_max_used_stack_iwram);
+
+    while(it < end && *it == stack_canary)
+    {
+        ++it;
+    }
+
+    return iwram_top - reinterpret_cast<const uint8_t*>(it);
+}
+
 int used_static_iwram()
 {
     auto iwram_start = reinterpret_cast<uint8_t*>(&__iwram_start__);
-    auto iwram_end = reinterpret_cast<uint8_t*>(&__fini_array_end);
-    return iwram_end - iwram_start;
+    return _static_iwram_end() - iwram_start;
 }
 
 int used_static_ewram()
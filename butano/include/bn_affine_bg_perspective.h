@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_AFFINE_BG_PERSPECTIVE_H
+#define BN_AFFINE_BG_PERSPECTIVE_H
+
+/**
+ * @file
+ * bn::affine_bg_perspective header file.
+ *
+ * @ingroup affine_bg
+ * @ingroup hblank_effect
+ */
+
+#include "bn_display.h"
+#include "bn_fixed_point.h"
+#include "bn_affine_bg_pa_register_hbe_ptr.h"
+#include "bn_affine_bg_pc_register_hbe_ptr.h"
+#include "bn_affine_bg_dx_register_hbe_ptr.h"
+#include "bn_affine_bg_dy_register_hbe_ptr.h"
+
+namespace bn
+{
+
+/**
+ * @brief Renders an affine_bg_ptr as a perspective floor (Mode 7 style) with H-Blank effects.
+ *
+ * The transformation matrix and the position of the affine_bg_ptr are calculated for each screen horizontal line
+ * from a camera placed above the floor, so the attributes of the affine_bg_ptr
+ * which define its position and its transformation matrix are ignored.
+ *
+ * Screen horizontal lines above the horizon point outside the affine_bg_ptr,
+ * so they are transparent if wrapping is disabled.
+ *
+ * H-Blank effects values are stored in this object, so it can't be copied nor moved.
+ *
+ * @ingroup affine_bg
+ * @ingroup hblank_effect
+ */
+class affine_bg_perspective
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param bg affine_bg_ptr to be rendered as a perspective floor.
+     */
+    explicit affine_bg_perspective(const affine_bg_ptr& bg);
+
+    affine_bg_perspective(const affine_bg_perspective& other) = delete;
+
+    affine_bg_perspective& operator=(const affine_bg_perspective& other) = delete;
+
+    /**
+     * @brief Returns the affine_bg_ptr rendered as a perspective floor.
+     */
+    [[nodiscard]] const affine_bg_ptr& bg() const
+    {
+        return _pa_hbe_ptr.bg();
+    }
+
+    /**
+     * @brief Returns the position of the camera over the affine_bg_ptr, in map pixels.
+     */
+    [[nodiscard]] const fixed_point& camera_position() const
+    {
+        return _camera_position;
+    }
+
+    /**
+     * @brief Sets the position of the camera over the affine_bg_ptr, in map pixels.
+     */
+    void set_camera_position(const fixed_point& camera_position)
+    {
+        _camera_position = camera_position;
+        _dirty = true;
+    }
+
+    /**
+     * @brief Returns the distance between the camera and the affine_bg_ptr.
+     */
+    [[nodiscard]] fixed camera_height() const
+    {
+        return _camera_height;
+    }
+
+    /**
+     * @brief Sets the distance between the camera and the affine_bg_ptr.
+     * @param camera_height Camera height in the range [0, 1024).
+     */
+    void set_camera_height(fixed camera_height);
+
+    /**
+     * @brief Returns the camera rotation angle in degrees.
+     *
+     * With an angle of 0 degrees, the camera looks towards the top of the affine_bg_ptr.
+     */
+    [[nodiscard]] fixed camera_angle() const
+    {
+        return _camera_angle;
+    }
+
+    /**
+     * @brief Sets the camera rotation angle.
+     * @param camera_angle Camera rotation angle in degrees, in the range [0, 360].
+     */
+    void set_camera_angle(fixed camera_angle);
+
+    /**
+     * @brief Returns the screen horizontal line of the horizon.
+     */
+    [[nodiscard]] int horizon() const
+    {
+        return _horizon;
+    }
+
+    /**
+     * @brief Sets the screen horizontal line of the horizon.
+     * @param horizon Screen horizontal line in the range [0, display::height() - 1).
+     */
+    void set_horizon(int horizon);
+
+    /**
+     * @brief Returns the distance between the camera and the screen.
+     */
+    [[nodiscard]] int focal_distance() const
+    {
+        return _focal_distance;
+    }
+
+    /**
+     * @brief Sets the distance between the camera and the screen.
+     * @param focal_distance Focal distance in the range [1, 256].
+     */
+    void set_focal_distance(int focal_distance);
+
+    /**
+     * @brief Indicates if the H-Blank effects must be committed to the GBA or not.
+     */
+    [[nodiscard]] bool visible() const
+    {
+        return _pa_hbe_ptr.visible();
+    }
+
+    /**
+     * @brief Sets if the H-Blank effects must be committed to the GBA or not.
+     */
+    void set_visible(bool visible);
+
+    /**
+     * @brief Recalculates the H-Blank effects values if the camera has been modified.
+     *
+     * It should be called once per frame, before bn::core::update.
+     */
+    void update();
+
+private:
+    alignas(int) int16_t _pa_values[display::height()] = {};
+    alignas(int) int16_t _pc_values[display::height()] = {};
+    int _dx_values[display::height()] = {};
+    int _dy_values[display::height()] = {};
+    affine_bg_pa_register_hbe_ptr _pa_hbe_ptr;
+    affine_bg_pc_register_hbe_ptr _pc_hbe_ptr;
+    affine_bg_dx_register_hbe_ptr _dx_hbe_ptr;
+    affine_bg_dy_register_hbe_ptr _dy_hbe_ptr;
+    fixed_point _camera_position;
+    fixed _camera_height = 32;
+    fixed _camera_angle;
+    int16_t _horizon = 0;
+    int16_t _focal_distance = 128;
+    bool _dirty = true;
+};
+
+}
+
+#endif
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_ALLOCATOR_STATS_H
+#define BN_ALLOCATOR_STATS_H
+
+/**
+ * @file
+ * bn::allocator_stats header file.
+ *
+ * @ingroup allocator
+ */
+
+#include "bn_span.h"
+
+namespace bn
+{
+
+class best_fit_allocator;
+class tlsf_allocator;
+
+/**
+ * @brief Usage and fragmentation statistics of an allocator.
+ *
+ * They allow to know if a failed allocation was caused by memory exhaustion
+ * (available_bytes is too low) or by fragmentation (available_bytes is enough, but largest_free_bytes is not).
+ *
+ * @ingroup allocator
+ */
+class allocator_stats
+{
+
+public:
+    /**
+     * @brief Number of buckets of the histogram of allocation sizes.
+     */
+    static constexpr int histogram_size = 8;
+
+    /**
+     * @brief Returns the size in bytes of all allocated items.
+     */
+    [[nodiscard]] constexpr int used_bytes() const
+    {
+        return _used_bytes;
+    }
+
+    /**
+     * @brief Returns the number of bytes that still can be allocated.
+     */
+    [[nodiscard]] constexpr int available_bytes() const
+    {
+        return _available_bytes;
+    }
+
+    /**
+     * @brief Returns the maximum value of used_bytes since the allocator was reset.
+     *
+     * It is only tracked if @ref BN_CFG_ALLOCATOR_STATS_ENABLED is `true`.
+     */
+    [[nodiscard]] constexpr int peak_used_bytes() const
+    {
+        return _peak_used_bytes;
+    }
+
+    /**
+     * @brief Returns the size in bytes of the biggest free item (including its header).
+     */
+    [[nodiscard]] constexpr int largest_free_bytes() const
+    {
+        return _largest_free_bytes;
+    }
+
+    /**
+     * @brief Returns the number of free items.
+     */
+    [[nodiscard]] constexpr int free_items_count() const
+    {
+        return _free_items_count;
+    }
+
+    /**
+     * @brief Returns the number of successful allocations since the allocator was reset.
+     *
+     * It is only tracked if @ref BN_CFG_ALLOCATOR_STATS_ENABLED is `true`.
+     */
+    [[nodiscard]] constexpr int alloc_count() const
+    {
+        return _alloc_count;
+    }
+
+    /**
+     * @brief Returns the number of failed allocations since the allocator was reset.
+     *
+     * It is only tracked if @ref BN_CFG_ALLOCATOR_STATS_ENABLED is `true`.
+     */
+    [[nodiscard]] constexpr int failed_alloc_count() const
+    {
+        return _failed_alloc_count;
+    }
+
+    /**
+     * @brief Returns the number of deallocations since the allocator was reset.
+     *
+     * It is only tracked if @ref BN_CFG_ALLOCATOR_STATS_ENABLED is `true`.
+     */
+    [[nodiscard]] constexpr int free_count() const
+    {
+        return _free_count;
+    }
+
+    /**
+     * @brief Returns the number of timer ticks spent allocating storage since the allocator was reset.
+     *
+     * Each timer tick takes 64 CPU cycles.
+     *
+     * It is only tracked if @ref BN_CFG_ALLOCATOR_STATS_ENABLED is `true`.
+     */
+    [[nodiscard]] constexpr int alloc_ticks() const
+    {
+        return _alloc_ticks;
+    }
+
+    /**
+     * @brief Returns the histogram of requested allocation sizes.
+     *
+     * The bucket at index `i` counts the allocations of up to `8 << i` bytes,
+     * except the last one, which counts all bigger allocations.
+     *
+     * It is only tracked if @ref BN_CFG_ALLOCATOR_STATS_ENABLED is `true`.
+     */
+    [[nodiscard]] constexpr span<const int> alloc_bytes_histogram() const
+    {
+        return span<const int>(_alloc_bytes_histogram);
+    }
+
+    /**
+     * @brief Returns the histogram bucket index of the given allocation size.
+     */
+    [[nodiscard]] constexpr static int histogram_index(int bytes)
+    {
+        int result = 0;
+
+        while(bytes > 8 && result < histogram_size - 1)
+        {
+            bytes = (bytes + 1) / 2;
+            ++result;
+        }
+
+        return result;
+    }
+
+private:
+    friend class best_fit_allocator;
+    friend class tlsf_allocator;
+
+    int _used_bytes = 0;
+    int _available_bytes = 0;
+    int _peak_used_bytes = 0;
+    int _largest_free_bytes = 0;
+    int _free_items_count = 0;
+    int _alloc_count = 0;
+    int _failed_alloc_count = 0;
+    int _free_count = 0;
+    int _alloc_ticks = 0;
+    int _alloc_bytes_histogram[histogram_size] = {};
+};
+
+}
+
+#endif
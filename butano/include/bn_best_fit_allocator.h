@@ -14,6 +14,7 @@
  */
 
 #include "bn_config_log.h"
+#include "bn_allocator_stats.h"
 #include "bn_config_doxygen.h"
 
 namespace bn
@@ -88,6 +89,13 @@ public:
         return available_bytes() == 0;
     }
 
+    /**
+     * @brief Returns usage and fragmentation statistics.
+     *
+     * Fragmentation statistics are calculated by iterating all items, so this method is not fast.
+     */
+    [[nodiscard]] allocator_stats stats() const;
+
     /**
      * @brief Allocates uninitialized storage.
      * @param bytes Bytes to allocate.
@@ -204,6 +212,7 @@ private:
     uint8_t* _start_ptr = nullptr;
     size_type _total_bytes_count = 0;
     size_type _free_bytes_count = 0;
+    allocator_stats _stats;
 
     [[nodiscard]] const item_type* _begin_item() const
     {
@@ -225,6 +234,8 @@ private:
         return reinterpret_cast<item_type*>(_start_ptr + _total_bytes_count);
     }
 
+    [[nodiscard]] void* _alloc(size_type bytes);
+
     [[nodiscard]] item_type* _best_free_item(size_type bytes);
 };
 
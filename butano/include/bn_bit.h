@@ -18,6 +18,10 @@
 
 namespace bn
 {
+    using std::countl_zero;
+
+    using std::countr_zero;
+
     using std::has_single_bit;
 
     using std::popcount;
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_BITMAP_BG_MODE_H
+#define BN_BITMAP_BG_MODE_H
+
+/**
+ * @file
+ * bn::bitmap_bg_mode header file.
+ *
+ * @ingroup bitmap_bg
+ */
+
+#include "bn_common.h"
+
+namespace bn
+{
+
+/**
+ * @brief Specifies the available bitmap background modes.
+ *
+ * @ingroup bitmap_bg
+ */
+enum class bitmap_bg_mode : uint8_t
+{
+    MODE_3, //!< 240x160 pixels with 15 bits per pixel colors and one page.
+    MODE_4, //!< 240x160 pixels with 8 bits per pixel (256 BG palette colors) and two pages.
+    MODE_5 //!< 160x128 pixels with 15 bits per pixel colors and two pages.
+};
+
+}
+
+#endif
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_BITMAP_BG_PTR_H
+#define BN_BITMAP_BG_PTR_H
+
+/**
+ * @file
+ * bn::bitmap_bg_ptr header file.
+ *
+ * @ingroup bitmap_bg
+ */
+
+#include "bn_span.h"
+#include "bn_color.h"
+#include "bn_utility.h"
+#include "bn_optional.h"
+#include "bn_functional.h"
+#include "bn_bitmap_bg_mode.h"
+
+namespace bn
+{
+
+class rect;
+class size;
+class point;
+
+/**
+ * @brief std::shared_ptr like smart pointer that retains shared ownership of a bitmap background.
+ *
+ * Several bitmap_bg_ptr objects may own the same bitmap background.
+ *
+ * The bitmap background is released when the last remaining bitmap_bg_ptr owning it is destroyed.
+ *
+ * Only one bitmap background can exist at the same time. While it exists:
+ * * Regular and affine backgrounds can't be shown, and BG tiles and maps can't be created.
+ * * The first 512 sprite tiles are reserved, since bitmap pages overlap them.
+ *
+ * Pixel coordinates are relative to the top-left corner of the bitmap background.
+ *
+ * In MODE_3, drawings are done in an EWRAM canvas, and only the modified scanlines spans
+ * are uploaded to VRAM in the next frame.
+ * Up to @ref BN_CFG_BGS_BITMAP_MAX_COMMITTED_PIXELS pixels are uploaded per frame,
+ * so big modifications (like clearing the whole bitmap background) are shown in several frames.
+ *
+ * In MODE_4 and MODE_5, drawings are done in the back page, which is shown after calling flip.
+ * Modifications are not tracked per page, so the whole back page should be redrawn after each flip.
+ *
+ * @ingroup bitmap_bg
+ */
+class bitmap_bg_ptr
+{
+
+public:
+    /**
+     * @brief Creates a bitmap_bg_ptr.
+     * @param mode Bitmap background mode.
+     * @return The requested bitmap_bg_ptr.
+     */
+    [[nodiscard]] static bitmap_bg_ptr create(bitmap_bg_mode mode);
+
+    /**
+     * @brief Creates a bitmap_bg_ptr.
+     * @param mode Bitmap background mode.
+     * @return The requested bitmap_bg_ptr if it could be created; bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<bitmap_bg_ptr> create_optional(bitmap_bg_mode mode);
+
+    /**
+     * @brief Copy constructor.
+     * @param other bitmap_bg_ptr to copy.
+     */
+    bitmap_bg_ptr(const bitmap_bg_ptr& other);
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other bitmap_bg_ptr to copy.
+     * @return Reference to this.
+     */
+    bitmap_bg_ptr& operator=(const bitmap_bg_ptr& other);
+
+    /**
+     * @brief Move constructor.
+     * @param other bitmap_bg_ptr to move.
+     */
+    bitmap_bg_ptr(bitmap_bg_ptr&& other) noexcept :
+        bitmap_bg_ptr(other._handle)
+    {
+        other._handle = -1;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other bitmap_bg_ptr to move.
+     * @return Reference to this.
+     */
+    bitmap_bg_ptr& operator=(bitmap_bg_ptr&& other) noexcept
+    {
+        bn::swap(_handle, other._handle);
+        return *this;
+    }
+
+    /**
+     * @brief Releases the referenced bitmap background if no more bitmap_bg_ptr objects reference to it.
+     */
+    ~bitmap_bg_ptr();
+
+    /**
+     * @brief Returns the bitmap background mode.
+     */
+    [[nodiscard]] bitmap_bg_mode mode() const;
+
+    /**
+     * @brief Returns the size in pixels of the bitmap background.
+     */
+    [[nodiscard]] size dimensions() const;
+
+    /**
+     * @brief Returns the pixels in which drawings are done.
+     *
+     * In MODE_3 they are stored in EWRAM, so modified pixels must be notified with set_dirty.
+     *
+     * In MODE_4 they are stored in the back page in VRAM. Each element stores two pixels
+     * (the low byte is the pixel on the left), since VRAM doesn't support 8-bit writes.
+     *
+     * In MODE_5 they are stored in the back page in VRAM.
+     */
+    [[nodiscard]] span<uint16_t> pixels();
+
+    /**
+     * @brief Indicates that the pixels in the given rectangle have been modified,
+     * so they must be uploaded to VRAM in the next frame.
+     *
+     * It is only needed in MODE_3 when pixels are modified directly.
+     *
+     * @param dirty_rect Modified rectangle.
+     */
+    void set_dirty(const rect& dirty_rect);
+
+    /**
+     * @brief Fills the whole bitmap background with the given color (MODE_3 and MODE_5 only).
+     * @param color Fill color.
+     */
+    void clear(color color);
+
+    /**
+     * @brief Fills the whole bitmap background with the given BG palette color (MODE_4 only).
+     * @param color_index BG palette color index [0..255].
+     */
+    void clear(int color_index);
+
+    /**
+     * @brief Fills the given rectangle with the given color (MODE_3 and MODE_5 only).
+     * @param fill_rect Rectangle to fill. Pixels outside the bitmap background are ignored.
+     * @param color Fill color.
+     */
+    void fill_rect(const rect& fill_rect, color color);
+
+    /**
+     * @brief Fills the given rectangle with the given BG palette color (MODE_4 only).
+     * @param fill_rect Rectangle to fill. Pixels outside the bitmap background are ignored.
+     * @param color_index BG palette color index [0..255].
+     */
+    void fill_rect(const rect& fill_rect, int color_index);
+
+    /**
+     * @brief Draws a line with the given color (MODE_3 and MODE_5 only).
+     * @param a First point of the line.
+     * @param b Last point of the line.
+     * @param color Line color.
+     */
+    void draw_line(const point& a, const point& b, color color);
+
+    /**
+     * @brief Draws a line with the given BG palette color (MODE_4 only).
+     * @param a First point of the line.
+     * @param b Last point of the line.
+     * @param color_index BG palette color index [0..255].
+     */
+    void draw_line(const point& a, const point& b, int color_index);
+
+    /**
+     * @brief Copies the given image (MODE_3 and MODE_5 only).
+     * @param image_pixels Image pixels, stored row by row.
+     * @param image_dimensions Image size in pixels.
+     * @param position Position of the top-left corner of the copied image.
+     * Pixels outside the bitmap background are ignored.
+     */
+    void copy(const span<const color>& image_pixels, const size& image_dimensions, const point& position);
+
+    /**
+     * @brief Copies the given image (MODE_4 only).
+     * @param image_pixels Image pixels (BG palette color indexes), stored row by row.
+     * @param image_dimensions Image size in pixels.
+     * @param position Position of the top-left corner of the copied image.
+     * Pixels outside the bitmap background are ignored.
+     */
+    void copy(const span<const uint8_t>& image_pixels, const size& image_dimensions, const point& position);
+
+    /**
+     * @brief Copies the given image scaled to fit the given rectangle (MODE_3 and MODE_5 only).
+     * @param image_pixels Image pixels, stored row by row.
+     * @param image_dimensions Image size in pixels.
+     * @param destination_rect Rectangle in which the image is copied.
+     * Pixels outside the bitmap background are ignored.
+     */
+    void scaled_copy(const span<const color>& image_pixels, const size& image_dimensions,
+                     const rect& destination_rect);
+
+    /**
+     * @brief Copies the given image scaled to fit the given rectangle (MODE_4 only).
+     * @param image_pixels Image pixels (BG palette color indexes), stored row by row.
+     * @param image_dimensions Image size in pixels.
+     * @param destination_rect Rectangle in which the image is copied.
+     * Pixels outside the bitmap background are ignored.
+     */
+    void scaled_copy(const span<const uint8_t>& image_pixels, const size& image_dimensions,
+                     const rect& destination_rect);
+
+    /**
+     * @brief Indicates if the back page is going to be shown in the next frame.
+     */
+    [[nodiscard]] bool flip_pending() const;
+
+    /**
+     * @brief Shows the back page in the next frame (MODE_4 and MODE_5 only).
+     *
+     * After the next frame, the new back page contains the pixels of the page shown before.
+     * The modifications done in the other page are not copied to it, so it should be redrawn entirely
+     * (for example, starting with a clear call).
+     */
+    void flip();
+
+    /**
+     * @brief Returns the internal handle.
+     */
+    [[nodiscard]] int handle() const
+    {
+        return _handle;
+    }
+
+    /**
+     * @brief Exchanges the contents of this bitmap_bg_ptr with those of the other one.
+     * @param other bitmap_bg_ptr to exchange the contents with.
+     */
+    void swap(bitmap_bg_ptr& other)
+    {
+        bn::swap(_handle, other._handle);
+    }
+
+    /**
+     * @brief Exchanges the contents of a bitmap_bg_ptr with those of another one.
+     * @param a First bitmap_bg_ptr to exchange the contents with.
+     * @param b Second bitmap_bg_ptr to exchange the contents with.
+     */
+    friend void swap(bitmap_bg_ptr& a, bitmap_bg_ptr& b)
+    {
+        bn::swap(a._handle, b._handle);
+    }
+
+    /**
+     * @brief Default equal operator.
+     */
+    [[nodiscard]] friend bool operator==(const bitmap_bg_ptr& a, const bitmap_bg_ptr& b) = default;
+
+private:
+    int8_t _handle;
+
+    explicit bitmap_bg_ptr(int handle) :
+        _handle(int8_t(handle))
+    {
+    }
+};
+
+
+/**
+ * @brief Hash support for bitmap_bg_ptr.
+ *
+ * @ingroup bitmap_bg
+ * @ingroup functional
+ */
+template<>
+struct hash<bitmap_bg_ptr>
+{
+    /**
+     * @brief Returns the hash of the given bitmap_bg_ptr.
+     */
+    [[nodiscard]] unsigned operator()(const bitmap_bg_ptr& value) const
+    {
+        return make_hash(value.handle());
+    }
+};
+
+}
+
+#endif
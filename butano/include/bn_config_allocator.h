@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_ALLOCATOR_H
+#define BN_CONFIG_ALLOCATOR_H
+
+/**
+ * @file
+ * Allocators configuration header file.
+ *
+ * @ingroup allocator
+ */
+
+#include "bn_config_profiler.h"
+
+/**
+ * @def BN_CFG_ALLOCATOR_STATS_ENABLED
+ *
+ * Specifies if allocators must track allocation counters, timings, sizes and peak usage.
+ *
+ * Since they are updated in each allocation, they are disabled by default unless the profiler is enabled.
+ *
+ * Usage and fragmentation statistics are always available.
+ *
+ * @ingroup allocator
+ */
+#ifndef BN_CFG_ALLOCATOR_STATS_ENABLED
+    #define BN_CFG_ALLOCATOR_STATS_ENABLED BN_CFG_PROFILER_ENABLED
+#endif
+
+#endif
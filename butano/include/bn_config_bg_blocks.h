@@ -26,6 +26,58 @@
     #define BN_CFG_BG_BLOCKS_MAX_ITEMS 16
 #endif
 
+/**
+ * @def BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+ *
+ * Specifies the maximum number of decompressed 32x32 chunks of compressed big regular maps that can be stored
+ * in EWRAM at the same time.
+ *
+ * If it is zero, compressed big regular maps are not supported.
+ * Otherwise, it must be at least 4, since the visible area of a big map can overlap 4 chunks.
+ *
+ * Each chunk takes 2KB of EWRAM.
+ *
+ * Chunks are shared by all compressed big regular maps,
+ * so showing more than one of them at the same time requires 4 chunks per map to avoid decompressing chunks
+ * every frame.
+ *
+ * @ingroup bg
+ */
+#ifndef BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+    #define BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS 0
+#endif
+
+/**
+ * @def BN_CFG_BG_BLOCKS_MAX_DIRTY_ROWS
+ *
+ * Specifies the maximum number of regular map rows modified with bn::regular_bg_map_ptr::set_cell
+ * or bn::regular_bg_map_ptr::set_cells that can be committed to VRAM without uploading the whole map.
+ *
+ * If more rows are modified in the same frame, the whole map is uploaded to VRAM.
+ *
+ * @ingroup bg
+ */
+#ifndef BN_CFG_BG_BLOCKS_MAX_DIRTY_ROWS
+    #define BN_CFG_BG_BLOCKS_MAX_DIRTY_ROWS 32
+#endif
+
+/**
+ * @def BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+ *
+ * Specifies the maximum number of tiles of the tile pool referenced by streamed regular background tiles.
+ *
+ * If it is zero, streamed regular background tiles are disabled.
+ *
+ * Streamed tiles take around 2 bytes of EWRAM per pool tile, plus 7KB.
+ *
+ * See bn::regular_bg_tiles_ptr::create_streamed.
+ *
+ * @ingroup bg
+ */
+#ifndef BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+    #define BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES 0
+#endif
+
 /**
  * @def BN_CFG_BG_BLOCKS_LOG_ENABLED
  *
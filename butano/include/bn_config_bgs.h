@@ -28,4 +28,21 @@
     #define BN_CFG_BGS_MAX_ITEMS 4
 #endif
 
+/**
+ * @def BN_CFG_BGS_BITMAP_MAX_COMMITTED_PIXELS
+ *
+ * Specifies the maximum number of modified pixels of a MODE_3 bitmap background uploaded to VRAM per frame.
+ *
+ * Uploading the whole MODE_3 canvas (240x160 pixels) doesn't fit in a VBlank,
+ * so bigger modifications are uploaded in several frames.
+ *
+ * Each frame resumes from the scanline following the last uploaded one,
+ * so all modified scanlines are eventually uploaded even if the whole canvas is redrawn every frame.
+ *
+ * @ingroup bitmap_bg
+ */
+#ifndef BN_CFG_BGS_BITMAP_MAX_COMMITTED_PIXELS
+    #define BN_CFG_BGS_BITMAP_MAX_COMMITTED_PIXELS (240 * 40)
+#endif
+
 #endif
@@ -13,6 +13,7 @@
  * @ingroup memory
  */
 
+#include "bn_ewram_allocator.h"
 #include "bn_ewram_wait_state.h"
 
 /**
@@ -28,4 +29,28 @@
     #define BN_CFG_EWRAM_WAIT_STATE BN_EWRAM_WAIT_STATE_2
 #endif
 
+/**
+ * @def BN_CFG_EWRAM_ALLOCATOR
+ *
+ * Specifies the allocator used to manage the EWRAM heap.
+ *
+ * Values not specified in BN_EWRAM_ALLOCATOR_* macros are not allowed.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_EWRAM_ALLOCATOR
+    #define BN_CFG_EWRAM_ALLOCATOR BN_EWRAM_ALLOCATOR_BEST_FIT
+#endif
+
+/**
+ * @def BN_CFG_EWRAM_ALLOC_FAILURES_LOG_ENABLED
+ *
+ * Specifies if EWRAM allocator statistics must be logged when an EWRAM allocation fails.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_EWRAM_ALLOC_FAILURES_LOG_ENABLED
+    #define BN_CFG_EWRAM_ALLOC_FAILURES_LOG_ENABLED false
+#endif
+
 #endif
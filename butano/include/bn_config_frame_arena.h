@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_FRAME_ARENA_H
+#define BN_CONFIG_FRAME_ARENA_H
+
+/**
+ * @file
+ * Frame arena configuration header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_FRAME_ARENA_EWRAM_BYTES
+ *
+ * Specifies the size in bytes of the EWRAM frame arena.
+ *
+ * It must be a multiple of 4.
+ *
+ * It is disabled by default, since its storage is taken from the EWRAM heap.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_FRAME_ARENA_EWRAM_BYTES
+    #define BN_CFG_FRAME_ARENA_EWRAM_BYTES 0
+#endif
+
+/**
+ * @def BN_CFG_FRAME_ARENA_IWRAM_BYTES
+ *
+ * Specifies the size in bytes of the IWRAM frame arena.
+ *
+ * It must be a multiple of 4.
+ *
+ * It is disabled by default, since IWRAM is shared with the stack.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_FRAME_ARENA_IWRAM_BYTES
+    #define BN_CFG_FRAME_ARENA_IWRAM_BYTES 0
+#endif
+
+#endif
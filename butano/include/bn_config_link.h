@@ -47,6 +47,10 @@
  *
  * Specifies the maximum number of stored messages for each player.
  *
+ * It must be a power of two.
+ *
+ * If more messages are sent or received before being processed, the oldest ones are discarded.
+ *
  * @ingroup link
  */
 #ifndef BN_CFG_LINK_MAX_MESSAGES
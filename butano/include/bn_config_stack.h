@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_STACK_H
+#define BN_CONFIG_STACK_H
+
+/**
+ * @file
+ * Stack configuration header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_STACK_IWRAM_PAINTING_ENABLED
+ *
+ * Specifies if the unused IWRAM stack must be filled with a canary pattern at initialization,
+ * so its high-water mark can be retrieved with bn::memory::max_used_stack_iwram.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_STACK_IWRAM_PAINTING_ENABLED
+    #define BN_CFG_STACK_IWRAM_PAINTING_ENABLED false
+#endif
+
+/**
+ * @def BN_CFG_STACK_IWRAM_MAX_USED_BYTES
+ *
+ * If it is greater than zero, an assert is triggered by bn::core::update when the IWRAM stack high-water mark
+ * is greater than the specified number of bytes.
+ *
+ * It requires @ref BN_CFG_STACK_IWRAM_PAINTING_ENABLED.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_STACK_IWRAM_MAX_USED_BYTES
+    #define BN_CFG_STACK_IWRAM_MAX_USED_BYTES 0
+#endif
+
+#endif
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_UNORDERED_CONTAINERS_H
+#define BN_CONFIG_UNORDERED_CONTAINERS_H
+
+/**
+ * @file
+ * Unordered containers configuration header file.
+ *
+ * @ingroup unordered_map
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+ *
+ * Specifies if bn::iunordered_map and bn::iunordered_set must use Robin Hood hashing instead of linear probing.
+ *
+ * With Robin Hood hashing, the probe distance of each element is stored and elements far from their ideal position
+ * take the place of elements nearer to theirs, so the probe distance variance is lower.
+ * Lookups of missing keys are faster at high load factors, and elements are removed with backward shift deletion
+ * instead of reinserting the following ones.
+ *
+ * The probe distance of any element can't be greater than 254.
+ *
+ * @ingroup unordered_map
+ */
+#ifndef BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+    #define BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED false
+#endif
+
+#endif
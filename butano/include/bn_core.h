@@ -108,6 +108,8 @@ namespace bn::core
 
     /**
      * @brief Returns the user function called in V-Blank.
+     *
+     * If a callable object has been set with set_vblank_callback(const ifunction<void()>&), it returns `nullptr`.
      */
     [[nodiscard]] vblank_callback_type vblank_callback();
 
@@ -116,6 +118,14 @@ namespace bn::core
      */
     void set_vblank_callback(vblank_callback_type vblank_callback);
 
+    /**
+     * @brief Sets the user callable object called in V-Blank, replacing the previous user function.
+     *
+     * It is copied into a bn::vblank_function_type, so lambdas with captures can be used
+     * (for example, `bn::core::set_vblank_callback(bn::vblank_function_type([this]{ ... }))`).
+     */
+    void set_vblank_callback(const ifunction<void()>& vblank_callback);
+
     /**
      * @brief Indicates if a slow game pak like the SuperCard SD has been detected or not.
      */
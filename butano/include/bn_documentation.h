@@ -109,6 +109,24 @@
  * @ingroup bg
  */
 
+/**
+ * @defgroup bitmap_bg Bitmap backgrounds
+ *
+ * Backgrounds made of pixels instead of tiles, which can be drawn directly by the CPU.
+ *
+ * Regular and affine backgrounds can't be shown while a bitmap background exists.
+ *
+ * @ingroup bg
+ */
+
+/**
+ * @defgroup tile_collision_map Tile collision maps
+ *
+ * Grids of solid cells with fast collision queries, usually generated from a level background.
+ *
+ * @ingroup bg
+ */
+
 /**
  * @defgroup sprite Sprites
  *
@@ -309,6 +327,13 @@
  * @ingroup display
  */
 
+/**
+ * @defgroup ecs Entity component system
+ *
+ * Fixed capacity sparse sets which store components per entity,
+ * and functions to iterate the entities contained in multiple component sets.
+ */
+
 /**
  * @defgroup memory Memory
  *
@@ -451,6 +476,42 @@
  * @ingroup container
  */
 
+/**
+ * @defgroup flat_map Flat map
+ *
+ * `std::flat_map` like container with the capacity defined at compile time.
+ *
+ * Elements are stored sorted by key in a contiguous buffer and searched with binary search.
+ *
+ * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+ *
+ * @ingroup container
+ */
+
+/**
+ * @defgroup flat_set Flat set
+ *
+ * `std::flat_set` like container with the capacity defined at compile time.
+ *
+ * Elements are stored sorted in a contiguous buffer and searched with binary search.
+ *
+ * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+ *
+ * @ingroup container
+ */
+
+/**
+ * @defgroup spsc_queue Single producer single consumer queue
+ *
+ * Lock-free ring buffer with the capacity defined at compile time.
+ *
+ * It allows to exchange data between an interrupt handler and the main loop without disabling interrupts.
+ *
+ * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+ *
+ * @ingroup container
+ */
+
 /**
  * @defgroup string Strings
  *
@@ -509,6 +570,16 @@
  * @ingroup container
  */
 
+/**
+ * @defgroup function Function
+ *
+ * `std::function` like container with the capacity defined at compile time.
+ *
+ * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+ *
+ * @ingroup container
+ */
+
 /**
  * @defgroup unique_ptr Unique pointer
  *
@@ -536,7 +607,7 @@
 /**
  * @defgroup allocator Allocator
  *
- * A generic allocator where allocation and release are not O(1) operations.
+ * A generic allocator where allocation and release are not necessarily O(1) operations.
  *
  * An allocator doesn't destroy its elements in its destructor, they must be destroyed manually.
  *
@@ -1188,6 +1259,11 @@
  * (`true` by default).
  * * `"flipped_tiles_reduction"`: optional field which specifies if flipped tiles must be reduced or not
  * (`true` by default).
+ * * `"tileset_group"`: optional field which specifies the name of a tileset group.
+ * All regular backgrounds with the same tileset group share a bn::regular_bg_tiles_item with that name,
+ * so repeated and flipped tiles of different backgrounds are stored in ROM and committed to VRAM only once.
+ * The backgrounds of a tileset group must have the same BPP mode and the same tiles compression,
+ * and Huffman compression is not supported for tiles nor maps.
  * * `"tiles_compression"`: optional field which specifies the compression of the tiles data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
@@ -1206,6 +1282,10 @@
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
  *   * `"auto"`: uses the option which gives the smallest data size.
+ *
+ *   Big maps are split in 32x32 map cells chunks compressed independently,
+ *   so only the chunks that enter in view are decompressed. Huffman compression is not supported in big maps.
+ *   Compressed big regular maps require @ref BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS to be greater than zero.
  * * `"compression"`: optional field which specifies the compression of the tiles, the colors and the map data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
@@ -1219,6 +1299,9 @@
  * For example, from two files named `image.bmp` and `image.json`,
  * a header file named `bn_regular_bg_items_image.h` is generated in the `build` folder.
  *
+ * If a tileset group is specified, a header file named `bn_regular_bg_tiles_items_<tileset_group>.h`
+ * is generated too.
+ *
  * You can use this header to create a regular background with only one line of C++ code:
  *
  * @code{.cpp}
@@ -1404,6 +1487,41 @@
  * @endcode
  *
  *
+ * @subsection import_tile_collision_map Tile collision maps
+ *
+ * Tile collision maps are generated from a *.bmp file with the same size as the level background,
+ * in which each 8x8 pixels cell is empty if all of its pixels use the color index 0, or solid otherwise.
+ *
+ * An example of the `*.json` files required for tile collision maps is the following:
+ *
+ * @code{.json}
+ * {
+ *     "type": "tile_collision_map",
+ *     "bits_per_cell": 4
+ * }
+ * @endcode
+ *
+ * The fields for tile collision maps are the following:
+ * * `"type"`: must be `"tile_collision_map"` for tile collision maps.
+ * * `"bits_per_cell"`: optional field which specifies the bits stored per cell:
+ *   * `1`: only stores if each cell is solid or not (this is the default option).
+ *   * `4`: also stores the highest color index [0..15] of each cell, which can be used as a tile type.
+ *
+ * If the conversion process has finished successfully,
+ * a bn::tile_collision_map should have been generated in the `build` folder.
+ *
+ * For example, from two files named `level.bmp` and `level.json`,
+ * a header file named `bn_tile_collision_map_items_level.h` is generated in the `build` folder.
+ *
+ * You can use this header to query the collision map with only one line of C++ code:
+ *
+ * @code{.cpp}
+ * #include "bn_tile_collision_map_items_level.h"
+ *
+ * int delta_x = bn::tile_collision_map_items::level.sweep_x(player_rect, player_speed_x);
+ * @endcode
+ *
+ *
  * @section import_audio Audio
  *
  * By default audio files played with Direct Sound channels go into the `audio` folder of your project,
@@ -1476,6 +1594,42 @@
  *
  * bn::sound_items::sfx.play();
  * @endcode
+ *
+ *
+ * @section import_vram_budget VRAM budget
+ *
+ * Since VRAM is allocated at runtime, running out of it or fragmenting it usually shows up late,
+ * when a scene loads all of its assets at once.
+ *
+ * To catch these issues at build time, a list of directories containing scene files can be specified
+ * with the `SCENES` variable of your project's `Makefile`. A scene file is a `*.json` file which lists
+ * the items created by a scene:
+ *
+ * @code{.json}
+ * {
+ *     "regular_bgs": ["sky", "town"],
+ *     "affine_bgs": ["floor"],
+ *     "regular_bg_tiles": ["font"],
+ *     "allocated_regular_bg_tiles": [{"tiles": 64, "bpp_mode": "bpp_4"}],
+ *     "allocated_regular_bg_maps": [{"width": 32, "height": 32}],
+ *     "sprites": ["hero", "hero:3", "coin:1"],
+ *     "sprite_tiles": ["shadow"],
+ *     "allocated_sprite_tiles": [32]
+ * }
+ * @endcode
+ *
+ * All fields are optional. Sprite entries can be followed by a graphics index (`"hero:3"`).
+ * Items are created in the order shown above, and items already created are shared, as they are at runtime.
+ *
+ * After importing assets, the placement done by the BG blocks and the sprite tiles managers is simulated
+ * for each scene, and its VRAM usage, alignment padding and fragmentation are reported
+ * alongside the peak usage of all scenes. The build fails if a scene doesn't fit in VRAM.
+ *
+ * The simulated BG blocks layout of each scene is also written to a `bn_vram_scenes_<scene name>.h` header
+ * (`bn::vram_scenes::<scene name>_bg_blocks_layout`), so it can be compared with the runtime one.
+ *
+ * If `BN_CFG_BG_BLOCKS_MAX_ITEMS` or `BN_CFG_SPRITE_TILES_MAX_ITEMS` are defined in the `USERFLAGS` variable
+ * of your project's `Makefile`, their values are used by the simulation too.
  */
 
 
@@ -2019,6 +2173,36 @@
  * * <a href="https://www.coranac.com/projects/#tonc">Tonclib</a> unused components removed
  *   (EWRAM and ROM usage reduced).
  * * Flipped tiles reduction disabled in `dynamic_regular_bg` example.
+ * * Double buffered sprite tiles added (bn::sprite_tiles_ptr::create_new_double_buffered).
+ * * Repeated sprite graphics are removed by the graphics tool
+ *   (it can be disabled with the `repeated_graphics_reduction` field).
+ * * Streamed sprite tiles added (bn::sprite_tiles_ptr::create_streamed).
+ * * bn::tlsf_allocator added. It can be used by the heap manager with @ref BN_CFG_EWRAM_ALLOCATOR.
+ * * EWRAM and IWRAM frame arenas added (bn::frame_arena).
+ * * Allocator statistics added (bn::allocator_stats, bn::memory::alloc_ewram_stats and
+ *   @ref BN_CFG_EWRAM_ALLOC_FAILURES_LOG_ENABLED).
+ * * bn::dynamic_vector and bn::dynamic_unordered_map added.
+ * * IWRAM code overlays added (bn::iwram_overlay and @ref BN_CODE_IWRAM_OVERLAY).
+ * * IWRAM stack high-water mark tracking added (bn::memory::max_used_stack_iwram,
+ *   @ref BN_CFG_STACK_IWRAM_PAINTING_ENABLED and @ref BN_CFG_STACK_IWRAM_MAX_USED_BYTES).
+ * * Robin Hood hashing mode for bn::iunordered_map and bn::iunordered_set added
+ *   (@ref BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED).
+ * * bn::flat_map and bn::flat_set added.
+ * * bn::function added. It can be used as V-Blank callback (bn::vblank_function_type).
+ * * bn::spsc_queue added.
+ * * Link communication IRQ queues are now lock-free.
+ * * bn::ecs added.
+ * * Compressed big regular maps supported (see @ref BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS).
+ * * Streamed regular BG tiles added.
+ * * bn::regular_bg_map_ptr::set_cell and bn::regular_bg_map_ptr::set_cells added.
+ * * BG maps are placed at the end of VRAM and moved to join free BG blocks when VRAM is fragmented.
+ * * Big maps VBlank usage reduced when the camera jumps or when they are hidden.
+ * * bn::bitmap_bg_ptr added.
+ * * Regular backgrounds can share their tiles with tileset groups.
+ * * VRAM budget of scenes can be checked at build time with the `SCENES` Makefile variable.
+ * * bn::affine_bg_perspective added.
+ * * Regular backgrounds camera factor added, and regular_bg_position_hbe_ptr can apply per line camera factors for parallax scrolling.
+ * * bn::tile_collision_map added.
  *
  *
  * @section changelog_13_0_0 13.0.0
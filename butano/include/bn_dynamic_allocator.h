@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_DYNAMIC_ALLOCATOR_H
+#define BN_DYNAMIC_ALLOCATOR_H
+
+/**
+ * @file
+ * bn::ewram_heap_allocator and bn::ewram_frame_arena_allocator header file.
+ *
+ * @ingroup allocator
+ */
+
+#include "bn_memory.h"
+#include "bn_frame_arena.h"
+
+namespace bn
+{
+
+/**
+ * @brief Storage provider of dynamic containers which allocates storage in the EWRAM heap
+ * with bn::memory::ewram_alloc.
+ *
+ * @ingroup allocator
+ */
+class ewram_heap_allocator
+{
+
+public:
+    /**
+     * @brief Allocates uninitialized storage.
+     * @param bytes Bytes to allocate.
+     * @return On success, returns the pointer to the beginning of newly allocated memory.
+     * On failure, returns `nullptr`.
+     */
+    [[nodiscard]] static void* alloc(int bytes)
+    {
+        return memory::ewram_alloc(bytes);
+    }
+
+    /**
+     * @brief Deallocates the storage previously allocated by alloc.
+     * @param ptr Pointer to the storage to deallocate.
+     */
+    static void free(void* ptr)
+    {
+        memory::ewram_free(ptr);
+    }
+};
+
+
+/**
+ * @brief Storage provider of dynamic containers which allocates storage in the EWRAM frame arena
+ * with bn::frame_arena::ewram_alloc.
+ *
+ * Storage is released at the end of bn::core::update,
+ * so containers using it must be destroyed before that.
+ *
+ * @ingroup allocator
+ */
+class ewram_frame_arena_allocator
+{
+
+public:
+    /**
+     * @brief Allocates uninitialized storage.
+     * @param bytes Bytes to allocate.
+     * @return On success, returns the pointer to the beginning of newly allocated memory.
+     * On failure, returns `nullptr`.
+     */
+    [[nodiscard]] static void* alloc(int bytes)
+    {
+        return frame_arena::ewram_alloc(bytes);
+    }
+
+    /**
+     * @brief Does nothing, since frame arena storage is released at the end of bn::core::update.
+     */
+    static void free(void*)
+    {
+    }
+};
+
+}
+
+#endif
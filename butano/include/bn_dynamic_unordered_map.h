@@ -0,0 +1,548 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_DYNAMIC_UNORDERED_MAP_H
+#define BN_DYNAMIC_UNORDERED_MAP_H
+
+/**
+ * @file
+ * bn::dynamic_unordered_map header file.
+ *
+ * @ingroup unordered_map
+ */
+
+#include "bn_unordered_map.h"
+#include "bn_dynamic_allocator.h"
+
+namespace bn
+{
+
+/**
+ * @brief `std::unordered_map` like container which grows its buffer on demand.
+ *
+ * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+ *
+ * Unlike `std::unordered_map`, it doesn't offer pointer stability when moving, inserting or erasing elements.
+ *
+ * Since it inherits bn::iunordered_map, it can be used by code which expects a bn::iunordered_map reference,
+ * but methods called through a bn::iunordered_map reference can't grow the buffer,
+ * so they are limited to the current capacity (see reserve).
+ *
+ * @tparam Key Key type.
+ * @tparam Value Value type.
+ * @tparam KeyHash Functor used to calculate the hash of a given key.
+ * @tparam KeyEqual Functor used for all key comparisons.
+ * @tparam Allocator Storage provider (bn::ewram_heap_allocator, bn::ewram_frame_arena_allocator...).
+ *
+ * @ingroup unordered_map
+ */
+template<typename Key, typename Value, typename KeyHash = hash<Key>, typename KeyEqual = equal_to<Key>,
+         typename Allocator = ewram_heap_allocator>
+class dynamic_unordered_map : public iunordered_map<Key, Value, KeyHash, KeyEqual>
+{
+    using base_type = iunordered_map<Key, Value, KeyHash, KeyEqual>;
+
+public:
+    using key_type = Key; //!< Key type alias.
+    using mapped_type = Value; //!< Value type alias.
+    using value_type = pair<const key_type, mapped_type>; //!< (Key, Value) pair type alias.
+    using size_type = int; //!< Size type alias.
+    using difference_type = int; //!< Difference type alias.
+    using hash_type = unsigned; //!< Hash type alias.
+    using hasher = KeyHash; //!< Hash functor alias.
+    using key_equal = KeyEqual; //!< Equality functor alias.
+    using reference = value_type&; //!< (Key, Value) pair reference alias.
+    using const_reference = const value_type&; //!< (Key, Value) pair const reference alias.
+    using pointer = value_type*; //!< (Key, Value) pair pointer alias.
+    using const_pointer = const value_type*; //!< (Key, Value) pair const pointer alias.
+    using iterator = typename base_type::iterator; //!< Iterator alias.
+    using allocator_type = Allocator; //!< Allocator alias.
+
+    static_assert(alignof(value_type) <= alignof(int));
+
+    /**
+     * @brief Default constructor.
+     *
+     * It doesn't allocate any storage.
+     */
+    dynamic_unordered_map() = default;
+
+    /**
+     * @brief Copy constructor.
+     * @param other dynamic_unordered_map to copy.
+     */
+    dynamic_unordered_map(const dynamic_unordered_map& other) :
+        dynamic_unordered_map(static_cast<const base_type&>(other))
+    {
+    }
+
+    /**
+     * @brief Move constructor.
+     *
+     * It takes the buffer of the given dynamic_unordered_map, so it doesn't move any element.
+     *
+     * @param other dynamic_unordered_map to move.
+     */
+    dynamic_unordered_map(dynamic_unordered_map&& other) noexcept
+    {
+        this->_swap_storage(other);
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other iunordered_map to copy.
+     */
+    dynamic_unordered_map(const base_type& other)
+    {
+        _insert_all(other);
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other iunordered_map to move.
+     */
+    dynamic_unordered_map(base_type&& other) noexcept
+    {
+        _insert_all(move(other));
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other dynamic_unordered_map to copy.
+     * @return Reference to this.
+     */
+    dynamic_unordered_map& operator=(const dynamic_unordered_map& other)
+    {
+        return *this = static_cast<const base_type&>(other);
+    }
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * It exchanges the buffers of both dynamic_unordered_maps, so it doesn't move any element.
+     *
+     * @param other dynamic_unordered_map to move.
+     * @return Reference to this.
+     */
+    dynamic_unordered_map& operator=(dynamic_unordered_map&& other) noexcept
+    {
+        if(this != &other)
+        {
+            this->clear();
+            this->_swap_storage(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other iunordered_map to copy.
+     * @return Reference to this.
+     */
+    dynamic_unordered_map& operator=(const base_type& other)
+    {
+        if(this != &other)
+        {
+            this->clear();
+            _insert_all(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other iunordered_map to move.
+     * @return Reference to this.
+     */
+    dynamic_unordered_map& operator=(base_type&& other) noexcept
+    {
+        if(this != &other)
+        {
+            this->clear();
+            _insert_all(move(other));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~dynamic_unordered_map() noexcept
+    {
+        this->clear();
+        allocator_type::free(this->_storage_data());
+    }
+
+    /**
+     * @brief Grows the buffer if it can't store the given number of elements without too many collisions.
+     * @param count Minimum number of elements that the buffer must be able to store.
+     */
+    void reserve(size_type count)
+    {
+        BN_ASSERT(count >= 0, "Invalid count: ", count);
+
+        size_type new_max_size = this->max_size();
+
+        if(_too_many_elements(count, new_max_size))
+        {
+            new_max_size = max(new_max_size, _min_max_size);
+
+            while(_too_many_elements(count, new_max_size))
+            {
+                new_max_size *= 2;
+            }
+
+            _reallocate(new_max_size);
+        }
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair.
+     * @param value (Key, Value) pair to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair.
+     */
+    iterator insert(const value_type& value)
+    {
+        _reserve_one();
+        return base_type::insert(value);
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair.
+     * @param value (Key, Value) pair to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair.
+     */
+    iterator insert(value_type&& value)
+    {
+        _reserve_one();
+        return base_type::insert(move(value));
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair.
+     * @param key Key to insert.
+     * @param mapped_value Value to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair.
+     */
+    iterator insert(const key_type& key, const mapped_type& mapped_value)
+    {
+        _reserve_one();
+        return base_type::insert(key, mapped_value);
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair.
+     * @param key Key to insert.
+     * @param mapped_value Value to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair.
+     */
+    iterator insert(const key_type& key, mapped_type&& mapped_value)
+    {
+        _reserve_one();
+        return base_type::insert(key, move(mapped_value));
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair.
+     * @param key_hash Hash of the key to insert.
+     * @param value (Key, Value) pair to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair.
+     */
+    iterator insert_hash(hash_type key_hash, const value_type& value)
+    {
+        _reserve_one();
+        return base_type::insert_hash(key_hash, value);
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair.
+     * @param key_hash Hash of the key to insert.
+     * @param value (Key, Value) pair to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair.
+     */
+    iterator insert_hash(hash_type key_hash, value_type&& value)
+    {
+        _reserve_one();
+        return base_type::insert_hash(key_hash, move(value));
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair.
+     * @param key_hash Hash of the key to insert.
+     * @param key Key to insert.
+     * @param mapped_value Value to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair.
+     */
+    iterator insert_hash(hash_type key_hash, const key_type& key, const mapped_type& mapped_value)
+    {
+        _reserve_one();
+        return base_type::insert_hash(key_hash, key, mapped_value);
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair.
+     * @param key_hash Hash of the key to insert.
+     * @param key Key to insert.
+     * @param mapped_value Value to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair.
+     */
+    iterator insert_hash(hash_type key_hash, const key_type& key, mapped_type&& mapped_value)
+    {
+        _reserve_one();
+        return base_type::insert_hash(key_hash, key, move(mapped_value));
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair
+     * or replaces the value with the given one if the key is found.
+     * @param value (Key, Value) pair to insert or assign.
+     * @return Iterator pointing to the inserted or assigned (Key, Value) pair.
+     */
+    iterator insert_or_assign(const value_type& value)
+    {
+        _reserve_one();
+        return base_type::insert_or_assign(value);
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair
+     * or replaces the value with the given one if the key is found.
+     * @param value (Key, Value) pair to insert or assign.
+     * @return Iterator pointing to the inserted or assigned (Key, Value) pair.
+     */
+    iterator insert_or_assign(value_type&& value)
+    {
+        _reserve_one();
+        return base_type::insert_or_assign(move(value));
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair
+     * or replaces the value with the given one if the key is found.
+     * @param key Key to insert or assign.
+     * @param mapped_value Value to insert or assign.
+     * @return Iterator pointing to the inserted or assigned (Key, Value) pair.
+     */
+    iterator insert_or_assign(const key_type& key, const mapped_type& mapped_value)
+    {
+        _reserve_one();
+        return base_type::insert_or_assign(key, mapped_value);
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair
+     * or replaces the value with the given one if the key is found.
+     * @param key Key to insert or assign.
+     * @param mapped_value Value to insert or assign.
+     * @return Iterator pointing to the inserted or assigned (Key, Value) pair.
+     */
+    iterator insert_or_assign(const key_type& key, mapped_type&& mapped_value)
+    {
+        _reserve_one();
+        return base_type::insert_or_assign(key, move(mapped_value));
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair
+     * or replaces the value with the given one if the key is found.
+     * @param key_hash Hash of the key to insert or assign.
+     * @param value (Key, Value) pair to insert or assign.
+     * @return Iterator pointing to the inserted or assigned (Key, Value) pair.
+     */
+    iterator insert_or_assign_hash(hash_type key_hash, const value_type& value)
+    {
+        _reserve_one();
+        return base_type::insert_or_assign_hash(key_hash, value);
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair
+     * or replaces the value with the given one if the key is found.
+     * @param key_hash Hash of the key to insert or assign.
+     * @param value (Key, Value) pair to insert or assign.
+     * @return Iterator pointing to the inserted or assigned (Key, Value) pair.
+     */
+    iterator insert_or_assign_hash(hash_type key_hash, value_type&& value)
+    {
+        _reserve_one();
+        return base_type::insert_or_assign_hash(key_hash, move(value));
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair
+     * or replaces the value with the given one if the key is found.
+     * @param key_hash Hash of the key to insert or assign.
+     * @param key Key to insert or assign.
+     * @param mapped_value Value to insert or assign.
+     * @return Iterator pointing to the inserted or assigned (Key, Value) pair.
+     */
+    iterator insert_or_assign_hash(hash_type key_hash, const key_type& key, const mapped_type& mapped_value)
+    {
+        _reserve_one();
+        return base_type::insert_or_assign_hash(key_hash, key, mapped_value);
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair
+     * or replaces the value with the given one if the key is found.
+     * @param key_hash Hash of the key to insert or assign.
+     * @param key Key to insert or assign.
+     * @param mapped_value Value to insert or assign.
+     * @return Iterator pointing to the inserted or assigned (Key, Value) pair.
+     */
+    iterator insert_or_assign_hash(hash_type key_hash, const key_type& key, mapped_type&& mapped_value)
+    {
+        _reserve_one();
+        return base_type::insert_or_assign_hash(key_hash, key, move(mapped_value));
+    }
+
+    /**
+     * @brief Inserts in-place a (Key, Value) pair if the given key does not exist.
+     * @param key Key to insert.
+     * @param args Parameters of the value to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair if the key does not exist, otherwise end().
+     */
+    template<typename... Args>
+    iterator try_emplace(const key_type& key, Args&&... args)
+    {
+        _reserve_one();
+        return base_type::try_emplace(key, forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Inserts in-place a (Key, Value) pair if the given key does not exist.
+     * @param key_hash Hash of the key to insert.
+     * @param key Key to insert.
+     * @param args Parameters of the value to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair if the key does not exist, otherwise end().
+     */
+    template<typename... Args>
+    iterator try_emplace_hash(hash_type key_hash, const key_type& key, Args&&... args)
+    {
+        _reserve_one();
+        return base_type::try_emplace_hash(key_hash, key, forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns a reference to the value that is mapped to the given key,
+     * performing an insertion if such key does not already exist.
+     * @param key Key to search for.
+     * @return Reference to the value that is mapped to the given key.
+     */
+    [[nodiscard]] mapped_type& operator[](const key_type& key)
+    {
+        _reserve_one();
+        return base_type::operator[](key);
+    }
+
+    /**
+     * @brief Returns a reference to the value that is mapped to the given key,
+     * performing an insertion if such key does not already exist.
+     * @param key Key to search for.
+     * @return Reference to the value that is mapped to the given key.
+     */
+    [[nodiscard]] mapped_type& operator()(const key_type& key)
+    {
+        _reserve_one();
+        return base_type::operator()(key);
+    }
+
+    /**
+     * @brief Returns a reference to the value that is mapped to the given key,
+     * performing an insertion if such key does not already exist.
+     * @param key_hash Hash of the key to search for.
+     * @param key Key to search for.
+     * @return Reference to the value that is mapped to the given key.
+     */
+    [[nodiscard]] mapped_type& operator()(hash_type key_hash, const key_type& key)
+    {
+        _reserve_one();
+        return base_type::operator()(key_hash, key);
+    }
+
+    /**
+     * @brief Exchanges the contents of this dynamic_unordered_map with those of the other one.
+     *
+     * It exchanges the buffers of both dynamic_unordered_maps, so it doesn't move any element.
+     *
+     * @param other dynamic_unordered_map to exchange the contents with.
+     */
+    void swap(dynamic_unordered_map& other)
+    {
+        this->_swap_storage(other);
+    }
+
+    /**
+     * @brief Exchanges the contents of a dynamic_unordered_map with those of another one.
+     * @param a First dynamic_unordered_map to exchange the contents with.
+     * @param b Second dynamic_unordered_map to exchange the contents with.
+     */
+    friend void swap(dynamic_unordered_map& a, dynamic_unordered_map& b)
+    {
+        a.swap(b);
+    }
+
+private:
+    static constexpr size_type _min_max_size = 8;
+
+    [[nodiscard]] static bool _too_many_elements(size_type count, size_type max_size)
+    {
+        // Linear probing degrades quickly when the load factor is greater than 3/4:
+        return count * 4 > max_size * 3;
+    }
+
+    void _reserve_one()
+    {
+        reserve(this->size() + 1);
+    }
+
+    void _reallocate(size_type new_max_size)
+    {
+        dynamic_unordered_map new_map;
+        auto new_storage = static_cast<pointer>(
+                    allocator_type::alloc((int(sizeof(value_type)) + int(sizeof(uint8_t))) * new_max_size));
+        BN_ASSERT(new_storage, "Allocation failed: ", new_max_size);
+
+        auto new_allocated = reinterpret_cast<uint8_t*>(new_storage + new_max_size);
+        memory::clear(new_max_size, *new_allocated);
+        new_map._set_storage(new_storage, new_allocated, new_max_size);
+
+        for(value_type& value : *this)
+        {
+            new_map.base_type::insert_hash(hasher()(value.first), move(value));
+        }
+
+        this->_swap_storage(new_map);
+    }
+
+    void _insert_all(const base_type& other)
+    {
+        reserve(other.size());
+
+        for(const value_type& value : other)
+        {
+            base_type::insert(value);
+        }
+    }
+
+    void _insert_all(base_type&& other)
+    {
+        reserve(other.size());
+
+        for(value_type& value : other)
+        {
+            base_type::insert(move(value));
+        }
+
+        other.clear();
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_DYNAMIC_VECTOR_H
+#define BN_DYNAMIC_VECTOR_H
+
+/**
+ * @file
+ * bn::dynamic_vector header file.
+ *
+ * @ingroup vector
+ */
+
+#include "bn_vector.h"
+#include "bn_dynamic_allocator.h"
+
+namespace bn
+{
+
+/**
+ * @brief `std::vector` like container which grows its buffer on demand.
+ *
+ * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+ *
+ * Since it inherits bn::ivector, it can be used by code which expects a bn::ivector reference,
+ * but methods called through a bn::ivector reference can't grow the buffer,
+ * so they are limited to the current capacity (see reserve).
+ *
+ * @tparam Type Element type.
+ * @tparam Allocator Storage provider (bn::ewram_heap_allocator, bn::ewram_frame_arena_allocator...).
+ *
+ * @ingroup vector
+ */
+template<typename Type, typename Allocator = ewram_heap_allocator>
+class dynamic_vector : public ivector<Type>
+{
+    static_assert(alignof(Type) <= alignof(int));
+
+    using base_type = ivector<Type>;
+
+public:
+    using value_type = Type; //!< Value type alias.
+    using size_type = int; //!< Size type alias.
+    using difference_type = int; //!< Difference type alias.
+    using reference = Type&; //!< Reference alias.
+    using const_reference = const Type&; //!< Const reference alias.
+    using pointer = Type*; //!< Pointer alias.
+    using const_pointer = const Type*; //!< Const pointer alias.
+    using iterator = Type*; //!< Iterator alias.
+    using const_iterator = const Type*; //!< Const iterator alias.
+    using reverse_iterator = bn::reverse_iterator<iterator>; //!< Reverse iterator alias.
+    using const_reverse_iterator = bn::reverse_iterator<const_iterator>; //!< Const reverse iterator alias.
+    using allocator_type = Allocator; //!< Allocator alias.
+
+    /**
+     * @brief Default constructor.
+     *
+     * It doesn't allocate any storage.
+     */
+    dynamic_vector() = default;
+
+    /**
+     * @brief Copy constructor.
+     * @param other dynamic_vector to copy.
+     */
+    dynamic_vector(const dynamic_vector& other) :
+        dynamic_vector(static_cast<const base_type&>(other))
+    {
+    }
+
+    /**
+     * @brief Move constructor.
+     *
+     * It takes the buffer of the given dynamic_vector, so it doesn't move any element.
+     *
+     * @param other dynamic_vector to move.
+     */
+    dynamic_vector(dynamic_vector&& other) noexcept
+    {
+        this->_swap_storage(other);
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other ivector to copy.
+     */
+    dynamic_vector(const base_type& other)
+    {
+        reserve(other.size());
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other ivector to move.
+     */
+    dynamic_vector(base_type&& other) noexcept
+    {
+        reserve(other.size());
+        this->_assign(move(other));
+    }
+
+    /**
+     * @brief Size constructor.
+     * @param count Initial size of the dynamic_vector.
+     */
+    explicit dynamic_vector(size_type count)
+    {
+        BN_ASSERT(count >= 0, "Invalid count: ", count);
+
+        reserve(count);
+        this->_assign(count);
+    }
+
+    /**
+     * @brief Size constructor.
+     * @param count Initial size of the dynamic_vector.
+     * @param value Value to fill the dynamic_vector with.
+     */
+    dynamic_vector(size_type count, const_reference value)
+    {
+        BN_ASSERT(count >= 0, "Invalid count: ", count);
+
+        reserve(count);
+        this->_assign(count, value);
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other dynamic_vector to copy.
+     * @return Reference to this.
+     */
+    dynamic_vector& operator=(const dynamic_vector& other)
+    {
+        return *this = static_cast<const base_type&>(other);
+    }
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * It exchanges the buffers of both dynamic_vectors, so it doesn't move any element.
+     *
+     * @param other dynamic_vector to move.
+     * @return Reference to this.
+     */
+    dynamic_vector& operator=(dynamic_vector&& other) noexcept
+    {
+        if(this != &other)
+        {
+            this->clear();
+            this->_swap_storage(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other ivector to copy.
+     * @return Reference to this.
+     */
+    dynamic_vector& operator=(const base_type& other)
+    {
+        if(this != &other)
+        {
+            this->clear();
+            reserve(other.size());
+            this->_assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other ivector to move.
+     * @return Reference to this.
+     */
+    dynamic_vector& operator=(base_type&& other) noexcept
+    {
+        if(this != &other)
+        {
+            this->clear();
+            reserve(other.size());
+            this->_assign(move(other));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~dynamic_vector() noexcept
+    {
+        this->clear();
+        allocator_type::free(this->data());
+    }
+
+    /**
+     * @brief Returns the number of elements that can be stored without growing the buffer.
+     */
+    [[nodiscard]] size_type capacity() const
+    {
+        return this->max_size();
+    }
+
+    /**
+     * @brief Grows the buffer if it can't store the given number of elements.
+     * @param new_capacity Minimum number of elements that the buffer must be able to store.
+     */
+    void reserve(size_type new_capacity)
+    {
+        if(new_capacity > capacity())
+        {
+            _reallocate(new_capacity);
+        }
+    }
+
+    /**
+     * @brief Shrinks the buffer to fit the current size, releasing it if the dynamic_vector is empty.
+     */
+    void shrink_to_fit()
+    {
+        if(this->size() < capacity())
+        {
+            _reallocate(this->size());
+        }
+    }
+
+    /**
+     * @brief Inserts a copy of a value at the end of the dynamic_vector.
+     * @param value Value to insert.
+     */
+    void push_back(const_reference value)
+    {
+        if(this->full())
+        {
+            // The given value can be an element of this dynamic_vector, so it must be copied before growing:
+            value_type value_copy(value);
+            _grow();
+            base_type::push_back(move(value_copy));
+        }
+        else
+        {
+            base_type::push_back(value);
+        }
+    }
+
+    /**
+     * @brief Inserts a moved value at the end of the dynamic_vector.
+     * @param value Value to insert.
+     */
+    void push_back(value_type&& value)
+    {
+        if(this->full())
+        {
+            value_type value_copy(move(value));
+            _grow();
+            base_type::push_back(move(value_copy));
+        }
+        else
+        {
+            base_type::push_back(move(value));
+        }
+    }
+
+    /**
+     * @brief Constructs and inserts a value at the end of the dynamic_vector.
+     * @param args Parameters of the value to insert.
+     * @return Reference to the new value.
+     */
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if(this->full())
+        {
+            // The given parameters can reference elements of this dynamic_vector:
+            value_type value(forward<Args>(args)...);
+            _grow();
+            return base_type::emplace_back(move(value));
+        }
+
+        return base_type::emplace_back(forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Inserts a copy of a value at the specified position.
+     * @param position The given value is inserted before this position.
+     * @param value Value to insert.
+     * @return Iterator pointing to the inserted value.
+     */
+    iterator insert(const_iterator position, const_reference value)
+    {
+        if(this->full())
+        {
+            size_type index = position - this->begin();
+            value_type value_copy(value);
+            _grow();
+            return base_type::insert(this->begin() + index, move(value_copy));
+        }
+
+        return base_type::insert(position, value);
+    }
+
+    /**
+     * @brief Inserts a moved value at the specified position.
+     * @param position The given value is inserted before this position.
+     * @param value Value to insert.
+     * @return Iterator pointing to the inserted value.
+     */
+    iterator insert(const_iterator position, value_type&& value)
+    {
+        if(this->full())
+        {
+            size_type index = position - this->begin();
+            value_type value_copy(move(value));
+            _grow();
+            return base_type::insert(this->begin() + index, move(value_copy));
+        }
+
+        return base_type::insert(position, move(value));
+    }
+
+    /**
+     * @brief Constructs and inserts a value at the specified position.
+     * @param position The new value is inserted before this position.
+     * @param args Parameters of the value to insert.
+     * @return Iterator pointing to the new value.
+     */
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args)
+    {
+        if(this->full())
+        {
+            size_type index = position - this->begin();
+            value_type value(forward<Args>(args)...);
+            _grow();
+            return base_type::insert(this->begin() + index, move(value));
+        }
+
+        return base_type::emplace(position, forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Resizes the dynamic_vector.
+     * @param count New size.
+     */
+    void resize(size_type count)
+    {
+        reserve(count);
+        base_type::resize(count);
+    }
+
+    /**
+     * @brief Resizes the dynamic_vector.
+     * @param count New size.
+     * @param value Value to fill new elements with.
+     */
+    void resize(size_type count, const_reference value)
+    {
+        reserve(count);
+        base_type::resize(count, value);
+    }
+
+    /**
+     * @brief Assigns values to the dynamic_vector, removing the previous ones.
+     * @param count Number of elements to insert.
+     * @param value Value to fill new elements with.
+     */
+    void assign(size_type count, const_reference value)
+    {
+        BN_ASSERT(count >= 0, "Invalid count: ", count);
+
+        this->clear();
+        reserve(count);
+        this->_assign(count, value);
+    }
+
+    /**
+     * @brief Assigns values to the dynamic_vector, removing the previous ones.
+     * @param first Iterator to the first element to insert.
+     * @param last Iterator following to the last element to insert.
+     */
+    template<typename Iterator>
+    void assign(const Iterator& first, const Iterator& last)
+    {
+        this->clear();
+        reserve(last - first);
+        base_type::assign(first, last);
+    }
+
+    /**
+     * @brief Exchanges the contents of this dynamic_vector with those of the other one.
+     *
+     * It exchanges the buffers of both dynamic_vectors, so it doesn't move any element.
+     *
+     * @param other dynamic_vector to exchange the contents with.
+     */
+    void swap(dynamic_vector& other)
+    {
+        this->_swap_storage(other);
+    }
+
+    /**
+     * @brief Exchanges the contents of a dynamic_vector with those of another one.
+     * @param a First dynamic_vector to exchange the contents with.
+     * @param b Second dynamic_vector to exchange the contents with.
+     */
+    friend void swap(dynamic_vector& a, dynamic_vector& b)
+    {
+        a.swap(b);
+    }
+
+private:
+    static constexpr size_type _min_capacity = 4;
+
+    void _grow()
+    {
+        _reallocate(max(capacity() * 2, _min_capacity));
+    }
+
+    void _reallocate(size_type new_capacity)
+    {
+        pointer old_data = this->data();
+        pointer new_data = nullptr;
+        size_type size = this->size();
+
+        if(new_capacity)
+        {
+            new_data = static_cast<pointer>(allocator_type::alloc(int(sizeof(value_type)) * new_capacity));
+            BN_ASSERT(new_data, "Allocation failed: ", new_capacity);
+
+            for(size_type index = 0; index < size; ++index)
+            {
+                ::new(new_data + index) value_type(move(old_data[index]));
+                old_data[index].~value_type();
+            }
+        }
+
+        allocator_type::free(old_data);
+        this->_set_storage(new_data, new_capacity);
+    }
+};
+
+}
+
+#endif
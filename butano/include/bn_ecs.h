@@ -0,0 +1,724 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_ECS_H
+#define BN_ECS_H
+
+/**
+ * @file
+ * bn::ecs header file.
+ *
+ * @ingroup ecs
+ */
+
+#include <new>
+#include "bn_span.h"
+#include "bn_limits.h"
+#include "bn_utility.h"
+
+namespace bn
+{
+    class sprite_ptr;
+    class fixed_point;
+}
+
+/**
+ * @brief Entity component system related functions and classes.
+ *
+ * @ingroup ecs
+ */
+namespace bn::ecs
+{
+
+/**
+ * @brief Entity identifier type alias.
+ *
+ * The lower 16 bits store the index of the entity, and the upper ones store its generation,
+ * so the identifiers of destroyed entities are not valid anymore even if their index is recycled.
+ *
+ * @ingroup ecs
+ */
+using entity = int;
+
+/**
+ * @brief Returns the index of the given entity.
+ *
+ * @ingroup ecs
+ */
+[[nodiscard]] constexpr int entity_index(entity id)
+{
+    return id & 0xFFFF;
+}
+
+/**
+ * @brief Returns the generation of the given entity.
+ *
+ * @ingroup ecs
+ */
+[[nodiscard]] constexpr int entity_generation(entity id)
+{
+    return id >> 16;
+}
+
+/**
+ * @brief Returns the entity with the given index and generation.
+ *
+ * @ingroup ecs
+ */
+[[nodiscard]] constexpr entity make_entity(int index, int generation)
+{
+    return (generation << 16) | index;
+}
+
+
+/**
+ * @brief Creates and destroys entity identifiers, recycling the destroyed ones.
+ *
+ * @tparam MaxEntities Maximum number of alive entities.
+ *
+ * @ingroup ecs
+ */
+template<int MaxEntities>
+class entity_registry
+{
+    static_assert(MaxEntities > 0 && MaxEntities <= numeric_limits<int16_t>::max());
+
+public:
+    /**
+     * @brief Default constructor.
+     */
+    entity_registry()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Returns the number of alive entities.
+     */
+    [[nodiscard]] int size() const
+    {
+        return MaxEntities - _free_entities_count;
+    }
+
+    /**
+     * @brief Returns the maximum number of alive entities.
+     */
+    [[nodiscard]] constexpr int max_size() const
+    {
+        return MaxEntities;
+    }
+
+    /**
+     * @brief Returns the number of entities that can still be created.
+     */
+    [[nodiscard]] int available() const
+    {
+        return _free_entities_count;
+    }
+
+    /**
+     * @brief Indicates if there's no alive entities.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _free_entities_count == MaxEntities;
+    }
+
+    /**
+     * @brief Indicates if no more entities can be created.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return _free_entities_count == 0;
+    }
+
+    /**
+     * @brief Indicates if the given entity is alive or not.
+     */
+    [[nodiscard]] bool contains(entity id) const
+    {
+        int index = entity_index(id);
+        return id >= 0 && index < MaxEntities && _alive_entities[index] &&
+                entity_generation(id) == _generations[index];
+    }
+
+    /**
+     * @brief Creates a new entity.
+     * @return Identifier of the new entity, with an index in the range [0, max_size()).
+     */
+    [[nodiscard]] entity create()
+    {
+        BN_ASSERT(! full(), "Registry is full");
+
+        --_free_entities_count;
+
+        int index = _free_entities[_free_entities_count];
+        _alive_entities[index] = true;
+        return make_entity(index, _generations[index]);
+    }
+
+    /**
+     * @brief Destroys the given entity, removing it from the given component sets.
+     * @param id Entity to destroy.
+     * @param component_sets Component sets from which the entity must be removed.
+     */
+    template<typename... ComponentSets>
+    void destroy(entity id, ComponentSets&... component_sets)
+    {
+        BN_ASSERT(contains(id), "Invalid entity: ", id);
+
+        int index = entity_index(id);
+        (component_sets.erase(id), ...);
+        _alive_entities[index] = false;
+        _generations[index] = int16_t((_generations[index] + 1) & numeric_limits<int16_t>::max());
+        _free_entities[_free_entities_count] = int16_t(index);
+        ++_free_entities_count;
+    }
+
+    /**
+     * @brief Destroys all entities.
+     *
+     * Component sets are not modified, so they should be cleared too.
+     */
+    void clear()
+    {
+        for(int index = 0; index < MaxEntities; ++index)
+        {
+            _free_entities[index] = int16_t(MaxEntities - index - 1);
+
+            if(_alive_entities[index])
+            {
+                _alive_entities[index] = false;
+                _generations[index] = int16_t((_generations[index] + 1) & numeric_limits<int16_t>::max());
+            }
+        }
+
+        _free_entities_count = MaxEntities;
+    }
+
+private:
+    int16_t _free_entities[MaxEntities];
+    int16_t _generations[MaxEntities] = {};
+    bool _alive_entities[MaxEntities] = {};
+    int _free_entities_count;
+};
+
+
+/**
+ * @brief Base class of bn::ecs::icomponent_set.
+ *
+ * It stores the entities contained in a component set, allowing to know if an entity is contained or not in
+ * constant time and to iterate them in a contiguous buffer.
+ *
+ * @ingroup ecs
+ */
+class isparse_set
+{
+
+public:
+    isparse_set(const isparse_set& other) = delete;
+
+    isparse_set& operator=(const isparse_set& other) = delete;
+
+    /**
+     * @brief Returns the current number of entities.
+     */
+    [[nodiscard]] int size() const
+    {
+        return _size;
+    }
+
+    /**
+     * @brief Returns the maximum possible number of entities.
+     */
+    [[nodiscard]] int max_size() const
+    {
+        return _max_size;
+    }
+
+    /**
+     * @brief Returns the number of valid entity indexes (valid entity indexes are in the range [0, max_entities()).
+     */
+    [[nodiscard]] int max_entities() const
+    {
+        return _max_entities;
+    }
+
+    /**
+     * @brief Returns the remaining entity capacity.
+     */
+    [[nodiscard]] int available() const
+    {
+        return _max_size - _size;
+    }
+
+    /**
+     * @brief Indicates if it doesn't contain any entity.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _size == 0;
+    }
+
+    /**
+     * @brief Indicates if it can't contain any more entities.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return _size == _max_size;
+    }
+
+    /**
+     * @brief Returns the contained entities, in the same order as their components.
+     */
+    [[nodiscard]] span<const entity> entities() const
+    {
+        return span<const entity>(_entities, _size);
+    }
+
+    /**
+     * @brief Indicates if the given entity is contained or not.
+     */
+    [[nodiscard]] bool contains(entity id) const
+    {
+        int sparse_index = entity_index(id);
+
+        if(id < 0 || sparse_index >= _max_entities)
+        {
+            return false;
+        }
+
+        int index = _sparse[sparse_index];
+        return index >= 0 && _entities[index] == id;
+    }
+
+    /**
+     * @brief Returns the position of the given entity in the entities buffer,
+     * or -1 if it is not contained.
+     */
+    [[nodiscard]] int index(entity id) const
+    {
+        BN_ASSERT(id >= 0 && entity_index(id) < _max_entities, "Invalid entity: ", id, " - ", _max_entities);
+
+        return contains(id) ? _sparse[entity_index(id)] : -1;
+    }
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    isparse_set(int16_t* sparse, entity* entities, int max_entities, int max_size) :
+        _sparse(sparse),
+        _entities(entities),
+        _max_entities(max_entities),
+        _max_size(max_size)
+    {
+        for(int index = 0; index < max_entities; ++index)
+        {
+            sparse[index] = -1;
+        }
+    }
+
+    [[nodiscard]] int _unchecked_index(entity id) const
+    {
+        return _sparse[entity_index(id)];
+    }
+
+    int _push_back(entity id)
+    {
+        int sparse_index = entity_index(id);
+        BN_ASSERT(id >= 0 && sparse_index < _max_entities, "Invalid entity: ", id, " - ", _max_entities);
+        BN_ASSERT(_sparse[sparse_index] < 0, "Entity already contained: ", id);
+        BN_ASSERT(! full(), "Component set is full");
+
+        int result = _size;
+        _sparse[sparse_index] = int16_t(result);
+        _entities[result] = id;
+        _size = result + 1;
+        return result;
+    }
+
+    int _pop_back(int index)
+    {
+        int last_index = _size - 1;
+        entity last_entity = _entities[last_index];
+        _sparse[entity_index(_entities[index])] = -1;
+
+        if(index != last_index)
+        {
+            _sparse[entity_index(last_entity)] = int16_t(index);
+            _entities[index] = last_entity;
+        }
+
+        _size = last_index;
+        return last_index;
+    }
+
+    void _clear()
+    {
+        for(int index = 0, limit = _size; index < limit; ++index)
+        {
+            _sparse[entity_index(_entities[index])] = -1;
+        }
+
+        _size = 0;
+    }
+
+    /// @endcond
+
+private:
+    int16_t* _sparse;
+    entity* _entities;
+    int _max_entities;
+    int _max_size;
+    int _size = 0;
+};
+
+
+/**
+ * @brief Base class of bn::ecs::component_set.
+ *
+ * Can be used as a reference type for all bn::ecs::component_set containers containing a specific type.
+ *
+ * Components are stored in a contiguous buffer separated from the entities one (structure of arrays),
+ * so iterating them is cache and DMA friendly.
+ *
+ * Inserting or erasing components doesn't preserve the order of the other ones.
+ *
+ * @tparam Component Component type.
+ *
+ * @ingroup ecs
+ */
+template<typename Component>
+class icomponent_set : public isparse_set
+{
+
+public:
+    using value_type = Component; //!< Value type alias.
+    using size_type = int; //!< Size type alias.
+    using reference = Component&; //!< Reference alias.
+    using const_reference = const Component&; //!< Const reference alias.
+    using pointer = Component*; //!< Pointer alias.
+    using const_pointer = const Component*; //!< Const pointer alias.
+    using iterator = Component*; //!< Iterator alias.
+    using const_iterator = const Component*; //!< Const iterator alias.
+
+    /**
+     * @brief Returns a const pointer to the beginning of the components buffer.
+     */
+    [[nodiscard]] const_pointer data() const
+    {
+        return _components;
+    }
+
+    /**
+     * @brief Returns a pointer to the beginning of the components buffer.
+     */
+    [[nodiscard]] pointer data()
+    {
+        return _components;
+    }
+
+    /**
+     * @brief Returns a const iterator to the beginning of the components buffer.
+     */
+    [[nodiscard]] const_iterator begin() const
+    {
+        return _components;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the components buffer.
+     */
+    [[nodiscard]] iterator begin()
+    {
+        return _components;
+    }
+
+    /**
+     * @brief Returns a const iterator to the end of the components buffer.
+     */
+    [[nodiscard]] const_iterator end() const
+    {
+        return _components + size();
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the components buffer.
+     */
+    [[nodiscard]] iterator end()
+    {
+        return _components + size();
+    }
+
+    /**
+     * @brief Returns a const iterator to the beginning of the components buffer.
+     */
+    [[nodiscard]] const_iterator cbegin() const
+    {
+        return _components;
+    }
+
+    /**
+     * @brief Returns a const iterator to the end of the components buffer.
+     */
+    [[nodiscard]] const_iterator cend() const
+    {
+        return _components + size();
+    }
+
+    /**
+     * @brief Returns a const pointer to the component of the given entity, or `nullptr` if it is not contained.
+     */
+    [[nodiscard]] const_pointer find(entity id) const
+    {
+        return const_cast<icomponent_set&>(*this).find(id);
+    }
+
+    /**
+     * @brief Returns a pointer to the component of the given entity, or `nullptr` if it is not contained.
+     */
+    [[nodiscard]] pointer find(entity id)
+    {
+        return contains(id) ? _components + _unchecked_index(id) : nullptr;
+    }
+
+    /**
+     * @brief Returns a const reference to the component of the given entity.
+     */
+    [[nodiscard]] const_reference get(entity id) const
+    {
+        return const_cast<icomponent_set&>(*this).get(id);
+    }
+
+    /**
+     * @brief Returns a reference to the component of the given entity.
+     */
+    [[nodiscard]] reference get(entity id)
+    {
+        BN_ASSERT(contains(id), "Entity not found: ", id);
+
+        return _components[_unchecked_index(id)];
+    }
+
+    /**
+     * @brief Returns a const reference to the component of the given entity.
+     */
+    [[nodiscard]] const_reference operator[](entity id) const
+    {
+        return get(id);
+    }
+
+    /**
+     * @brief Returns a reference to the component of the given entity.
+     */
+    [[nodiscard]] reference operator[](entity id)
+    {
+        return get(id);
+    }
+
+    /**
+     * @brief Inserts a copy of the given component for the given entity.
+     * @param id Entity to insert. It must not be contained yet.
+     * @param component Component to insert.
+     * @return Reference to the inserted component.
+     */
+    reference insert(entity id, const_reference component)
+    {
+        return emplace(id, component);
+    }
+
+    /**
+     * @brief Inserts a moved component for the given entity.
+     * @param id Entity to insert. It must not be contained yet.
+     * @param component Component to insert.
+     * @return Reference to the inserted component.
+     */
+    reference insert(entity id, value_type&& component)
+    {
+        return emplace(id, move(component));
+    }
+
+    /**
+     * @brief Constructs and inserts a component for the given entity.
+     * @param id Entity to insert. It must not be contained yet.
+     * @param args Parameters of the component to insert.
+     * @return Reference to the inserted component.
+     */
+    template<typename... Args>
+    reference emplace(entity id, Args&&... args)
+    {
+        pointer component = _components + _push_back(id);
+        ::new(component) value_type(forward<Args>(args)...);
+        return *component;
+    }
+
+    /**
+     * @brief Removes the component of the given entity.
+     *
+     * The last component is moved to the position of the removed one.
+     *
+     * @param id Entity to remove.
+     * @return `true` if the entity was removed, otherwise `false`.
+     */
+    bool erase(entity id)
+    {
+        if(! contains(id))
+        {
+            return false;
+        }
+
+        int index = _unchecked_index(id);
+        int last_index = _pop_back(index);
+
+        if(index != last_index)
+        {
+            _components[index] = move(_components[last_index]);
+        }
+
+        _components[last_index].~value_type();
+        return true;
+    }
+
+    /**
+     * @brief Removes all components.
+     */
+    void clear()
+    {
+        for(pointer it = _components, end = _components + size(); it != end; ++it)
+        {
+            it->~value_type();
+        }
+
+        _clear();
+    }
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    icomponent_set(int16_t* sparse, entity* entities, reference components_ref, int max_entities, int max_size) :
+        isparse_set(sparse, entities, max_entities, max_size),
+        _components(&components_ref)
+    {
+    }
+
+    [[nodiscard]] reference _unchecked_get(entity id)
+    {
+        return _components[_unchecked_index(id)];
+    }
+
+    [[nodiscard]] const_reference _unchecked_get(entity id) const
+    {
+        return _components[_unchecked_index(id)];
+    }
+
+    template<typename Function, typename... ComponentSets>
+    friend void for_each(Function&& function, ComponentSets&... component_sets);
+
+    /// @endcond
+
+private:
+    pointer _components;
+};
+
+
+/**
+ * @brief Sparse set which stores a component per entity.
+ *
+ * Components are stored in a contiguous buffer separated from the entities one (structure of arrays),
+ * so iterating them is cache and DMA friendly.
+ *
+ * Since it stores its buffers inside, big component sets should be declared in EWRAM
+ * (for example, as `BN_DATA_EWRAM` static variables or allocated in the heap) instead of in the stack.
+ *
+ * @tparam Component Component type.
+ * @tparam MaxEntities Number of valid entity indexes (valid entity indexes are in the range [0, MaxEntities)).
+ * @tparam MaxSize Maximum number of components that can be stored.
+ *
+ * @ingroup ecs
+ */
+template<typename Component, int MaxEntities, int MaxSize = MaxEntities>
+class component_set : public icomponent_set<Component>
+{
+    static_assert(MaxEntities > 0 && MaxEntities <= numeric_limits<int16_t>::max());
+    static_assert(MaxSize > 0 && MaxSize <= MaxEntities);
+
+public:
+    /**
+     * @brief Default constructor.
+     */
+    component_set() :
+        icomponent_set<Component>(_sparse_buffer, _entities_buffer,
+                                  *reinterpret_cast<Component*>(_components_buffer), MaxEntities, MaxSize)
+    {
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~component_set() noexcept
+    {
+        this->clear();
+    }
+
+private:
+    alignas(Component) char _components_buffer[sizeof(Component) * MaxSize];
+    entity _entities_buffer[MaxSize];
+    int16_t _sparse_buffer[MaxEntities];
+};
+
+
+/**
+ * @brief Calls the given function for each entity contained in all the given component sets.
+ *
+ * Entities are iterated in the order of the smallest component set, so only the smallest set is traversed
+ * and the other ones are queried in constant time.
+ *
+ * Component sets must not be modified while iterating them.
+ *
+ * @param function Function to call with an entity and a reference to each of its components
+ * (for example, `[](bn::ecs::entity entity, position& position, const velocity& velocity){ ... }`).
+ * @param component_sets Component sets to intersect.
+ *
+ * @ingroup ecs
+ */
+template<typename Function, typename... ComponentSets>
+void for_each(Function&& function, ComponentSets&... component_sets)
+{
+    static_assert(sizeof...(ComponentSets) > 0);
+
+    const isparse_set* smallest_set = nullptr;
+    ((smallest_set = ! smallest_set || component_sets.size() < smallest_set->size() ?
+            &component_sets : smallest_set), ...);
+
+    const entity* entities = smallest_set->entities().data();
+
+    for(int index = 0, limit = smallest_set->size(); index < limit; ++index)
+    {
+        entity id = entities[index];
+
+        if((component_sets.contains(id) && ...))
+        {
+            function(id, component_sets._unchecked_get(id)...);
+        }
+    }
+}
+
+
+/**
+ * @brief Sets the position of the sprites of all entities which contain both a position and a sprite.
+ *
+ * It calls bn::sprite_ptr::set_position for each of them, so it should be called once per frame,
+ * after all positions have been updated.
+ *
+ * @param positions Position components.
+ * @param sprites Sprite components.
+ *
+ * @ingroup ecs
+ */
+void set_sprite_positions(const icomponent_set<fixed_point>& positions, icomponent_set<sprite_ptr>& sprites);
+
+}
+
+#endif
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_EWRAM_ALLOCATOR_H
+#define BN_EWRAM_ALLOCATOR_H
+
+/**
+ * @file
+ * Available EWRAM heap allocators header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_EWRAM_ALLOCATOR_BEST_FIT
+ *
+ * EWRAM heap is managed by a bn::best_fit_allocator.
+ *
+ * It has the lowest memory overhead, but allocation time grows with the number of allocated items.
+ *
+ * @ingroup memory
+ */
+#define BN_EWRAM_ALLOCATOR_BEST_FIT 1
+
+/**
+ * @def BN_EWRAM_ALLOCATOR_TLSF
+ *
+ * EWRAM heap is managed by a bn::tlsf_allocator.
+ *
+ * Allocation and release are O(1) operations, at the cost of a bigger memory overhead.
+ *
+ * @ingroup memory
+ */
+#define BN_EWRAM_ALLOCATOR_TLSF     2
+
+#endif
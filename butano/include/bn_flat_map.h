@@ -0,0 +1,991 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FLAT_MAP_H
+#define BN_FLAT_MAP_H
+
+/**
+ * @file
+ * bn::iflat_map and bn::flat_map implementation header file.
+ *
+ * @ingroup flat_map
+ */
+
+#include <new>
+#include "bn_assert.h"
+#include "bn_utility.h"
+#include "bn_iterator.h"
+#include "bn_algorithm.h"
+#include "bn_flat_map_fwd.h"
+
+namespace bn
+{
+
+template<typename Key, typename Value, typename KeyCompare>
+class iflat_map
+{
+
+public:
+    using key_type = Key; //!< Key type alias.
+    using mapped_type = Value; //!< Value type alias.
+    using value_type = pair<Key, Value>; //!< (Key, Value) pair type alias.
+    using size_type = int; //!< Size type alias.
+    using difference_type = int; //!< Difference type alias.
+    using reference = value_type&; //!< (Key, Value) pair reference alias.
+    using const_reference = const value_type&; //!< (Key, Value) pair const reference alias.
+    using pointer = value_type*; //!< (Key, Value) pair pointer alias.
+    using const_pointer = const value_type*; //!< (Key, Value) pair const pointer alias.
+    using iterator = value_type*; //!< Iterator alias.
+    using const_iterator = const value_type*; //!< Const iterator alias.
+    using reverse_iterator = bn::reverse_iterator<iterator>; //!< Reverse iterator alias.
+    using const_reverse_iterator = bn::reverse_iterator<const_iterator>; //!< Const reverse iterator alias.
+    using key_compare = KeyCompare; //!< Key comparison functor alias.
+
+    iflat_map(const iflat_map& other) = delete;
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other iflat_map to copy.
+     * @return Reference to this.
+     */
+    iflat_map& operator=(const iflat_map& other)
+    {
+        if(this != &other)
+        {
+            BN_ASSERT(other._size <= _max_size, "Not enough space: ", _max_size, " - ", other._size);
+
+            clear();
+            _assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other iflat_map to move.
+     * @return Reference to this.
+     */
+    iflat_map& operator=(iflat_map&& other) noexcept
+    {
+        if(this != &other)
+        {
+            BN_ASSERT(other._size <= _max_size, "Not enough space: ", _max_size, " - ", other._size);
+
+            clear();
+            _assign(move(other));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns a const pointer to the beginning of the iflat_map data.
+     */
+    [[nodiscard]] const_pointer data() const
+    {
+        return _data;
+    }
+
+    /**
+     * @brief Returns the current elements count.
+     */
+    [[nodiscard]] size_type size() const
+    {
+        return _size;
+    }
+
+    /**
+     * @brief Returns the maximum possible elements count.
+     */
+    [[nodiscard]] size_type max_size() const
+    {
+        return _max_size;
+    }
+
+    /**
+     * @brief Returns the remaining element capacity.
+     */
+    [[nodiscard]] size_type available() const
+    {
+        return _max_size - _size;
+    }
+
+    /**
+     * @brief Indicates if it doesn't contain any element.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _size == 0;
+    }
+
+    /**
+     * @brief Indicates if it can't contain any more elements.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return _size == _max_size;
+    }
+
+    /**
+     * @brief Returns a const iterator to the beginning of the iflat_map.
+     */
+    [[nodiscard]] const_iterator begin() const
+    {
+        return _data;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the iflat_map.
+     */
+    [[nodiscard]] iterator begin()
+    {
+        return _data;
+    }
+
+    /**
+     * @brief Returns a const iterator to the end of the iflat_map.
+     */
+    [[nodiscard]] const_iterator end() const
+    {
+        return _data + _size;
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the iflat_map.
+     */
+    [[nodiscard]] iterator end()
+    {
+        return _data + _size;
+    }
+
+    /**
+     * @brief Returns a const iterator to the beginning of the iflat_map.
+     */
+    [[nodiscard]] const_iterator cbegin() const
+    {
+        return _data;
+    }
+
+    /**
+     * @brief Returns a const iterator to the end of the iflat_map.
+     */
+    [[nodiscard]] const_iterator cend() const
+    {
+        return _data + _size;
+    }
+
+    /**
+     * @brief Returns a const reverse iterator to the end of the iflat_map.
+     */
+    [[nodiscard]] const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end of the iflat_map.
+     */
+    [[nodiscard]] reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a const reverse iterator to the beginning of the iflat_map.
+     */
+    [[nodiscard]] const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning of the iflat_map.
+     */
+    [[nodiscard]] reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns a const reverse iterator to the end of the iflat_map.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    /**
+     * @brief Returns a const reverse iterator to the beginning of the iflat_map.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+    /**
+     * @brief Indicates if the specified key is contained in this iflat_map.
+     * @param key Key to search for.
+     * @return `true` if the specified key is contained in this iflat_map, otherwise `false`.
+     */
+    [[nodiscard]] bool contains(const key_type& key) const
+    {
+        return find(key) != end();
+    }
+
+    /**
+     * @brief Counts the number of keys stored in this iflat_map are equal to the given one.
+     * @param key Key to search for.
+     * @return 1 if the specified key is contained in this iflat_map, otherwise 0.
+     */
+    [[nodiscard]] size_type count(const key_type& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief Returns a const iterator to the first element with a key not less than the given one.
+     */
+    [[nodiscard]] const_iterator lower_bound(const key_type& key) const
+    {
+        return const_cast<iflat_map&>(*this).lower_bound(key);
+    }
+
+    /**
+     * @brief Returns an iterator to the first element with a key not less than the given one.
+     */
+    [[nodiscard]] iterator lower_bound(const key_type& key)
+    {
+        return bn::lower_bound(begin(), end(), key, [](const value_type& value, const key_type& other_key)
+        {
+            return key_compare()(value.first, other_key);
+        });
+    }
+
+    /**
+     * @brief Returns a const iterator to the first element with a key greater than the given one.
+     */
+    [[nodiscard]] const_iterator upper_bound(const key_type& key) const
+    {
+        return const_cast<iflat_map&>(*this).upper_bound(key);
+    }
+
+    /**
+     * @brief Returns an iterator to the first element with a key greater than the given one.
+     */
+    [[nodiscard]] iterator upper_bound(const key_type& key)
+    {
+        return bn::upper_bound(begin(), end(), key, [](const key_type& other_key, const value_type& value)
+        {
+            return key_compare()(other_key, value.first);
+        });
+    }
+
+    /**
+     * @brief Searches for a given key.
+     * @param key Key to search for.
+     * @return Const iterator to the (Key, Value) pair if it exists, otherwise end().
+     */
+    [[nodiscard]] const_iterator find(const key_type& key) const
+    {
+        return const_cast<iflat_map&>(*this).find(key);
+    }
+
+    /**
+     * @brief Searches for a given key.
+     * @param key Key to search for.
+     * @return Iterator to the (Key, Value) pair if it exists, otherwise end().
+     */
+    [[nodiscard]] iterator find(const key_type& key)
+    {
+        iterator it = lower_bound(key);
+        iterator last = end();
+
+        if(it != last && key_compare()(key, it->first))
+        {
+            it = last;
+        }
+
+        return it;
+    }
+
+    /**
+     * @brief Searches for the value stored with the given key.
+     * @param key Key to search.
+     * @return Const reference to the value stored with the given key.
+     */
+    [[nodiscard]] const mapped_type& at(const key_type& key) const
+    {
+        const_iterator it = find(key);
+        BN_ASSERT(it != end(), "Key not found");
+
+        return it->second;
+    }
+
+    /**
+     * @brief Searches for the value stored with the given key.
+     * @param key Key to search.
+     * @return Reference to the value stored with the given key.
+     */
+    [[nodiscard]] mapped_type& at(const key_type& key)
+    {
+        iterator it = find(key);
+        BN_ASSERT(it != end(), "Key not found");
+
+        return it->second;
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair.
+     * @param value (Key, Value) pair to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair if the key does not exist, otherwise end().
+     */
+    iterator insert(const value_type& value)
+    {
+        return insert(value_type(value));
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair.
+     * @param value (Key, Value) pair to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair if the key does not exist, otherwise end().
+     */
+    iterator insert(value_type&& value)
+    {
+        iterator it = lower_bound(value.first);
+
+        if(it != end() && ! key_compare()(value.first, it->first))
+        {
+            return end();
+        }
+
+        return _emplace(it, move(value));
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair.
+     * @param key Key to insert.
+     * @param mapped_value Value to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair if the key does not exist, otherwise end().
+     */
+    iterator insert(const key_type& key, const mapped_type& mapped_value)
+    {
+        return insert(value_type(key, mapped_value));
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair.
+     * @param key Key to insert.
+     * @param mapped_value Value to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair if the key does not exist, otherwise end().
+     */
+    iterator insert(const key_type& key, mapped_type&& mapped_value)
+    {
+        return insert(value_type(key, move(mapped_value)));
+    }
+
+    /**
+     * @brief Inserts a sorted range of (Key, Value) pairs.
+     *
+     * Elements whose key is already contained in this iflat_map are not inserted,
+     * and only the first element of each group of equal keys in the range is inserted.
+     *
+     * Since the range is sorted, it is merged with the current elements in linear time,
+     * instead of inserting them one by one.
+     *
+     * @param first Bidirectional iterator to the first element to insert.
+     * @param last Bidirectional iterator following to the last element to insert.
+     */
+    template<typename Iterator>
+    void insert_sorted(const Iterator& first, const Iterator& last)
+    {
+        key_compare key_compare_functor;
+        pointer data = _data;
+        size_type size = _size;
+        size_type inserted_count = 0;
+
+        // Count new keys:
+
+        size_type index = 0;
+
+        for(Iterator it = first; it != last; ++it)
+        {
+            const key_type& key = it->first;
+
+            if(it != first)
+            {
+                Iterator previous_it = it;
+                --previous_it;
+                BN_ASSERT(! key_compare_functor(key, previous_it->first), "Range is not sorted");
+
+                if(! key_compare_functor(previous_it->first, key))
+                {
+                    continue;
+                }
+            }
+
+            while(index < size && key_compare_functor(data[index].first, key))
+            {
+                ++index;
+            }
+
+            if(index == size || key_compare_functor(key, data[index].first))
+            {
+                ++inserted_count;
+            }
+        }
+
+        if(! inserted_count)
+        {
+            return;
+        }
+
+        size_type new_size = size + inserted_count;
+        BN_ASSERT(new_size <= _max_size, "Not enough space: ", _max_size, " - ", new_size);
+
+        // Merge from the back, so current elements are moved only once:
+
+        size_type output_index = new_size - 1;
+        index = size - 1;
+
+        for(Iterator it = last; it != first && output_index > index; )
+        {
+            --it;
+
+            const key_type& key = it->first;
+
+            if(it != first)
+            {
+                Iterator previous_it = it;
+                --previous_it;
+
+                if(! key_compare_functor(previous_it->first, key))
+                {
+                    continue;
+                }
+            }
+
+            while(index >= 0 && key_compare_functor(key, data[index].first))
+            {
+                _move_to(index, output_index, size);
+                --index;
+                --output_index;
+            }
+
+            if(index < 0 || key_compare_functor(data[index].first, key))
+            {
+                if(output_index >= size)
+                {
+                    ::new(data + output_index) value_type(*it);
+                }
+                else
+                {
+                    data[output_index] = *it;
+                }
+
+                --output_index;
+            }
+        }
+
+        _size = new_size;
+    }
+
+    /**
+     * @brief Inserts a copy of the given (Key, Value) pair
+     * or replaces the value with the given one if the key is found.
+     * @param key Key to insert or assign.
+     * @param mapped_value Value to insert or assign.
+     * @return Iterator pointing to the inserted or assigned (Key, Value) pair.
+     */
+    iterator insert_or_assign(const key_type& key, const mapped_type& mapped_value)
+    {
+        return insert_or_assign(key, mapped_type(mapped_value));
+    }
+
+    /**
+     * @brief Inserts a moved (Key, Value) pair
+     * or replaces the value with the given one if the key is found.
+     * @param key Key to insert or assign.
+     * @param mapped_value Value to insert or assign.
+     * @return Iterator pointing to the inserted or assigned (Key, Value) pair.
+     */
+    iterator insert_or_assign(const key_type& key, mapped_type&& mapped_value)
+    {
+        iterator it = lower_bound(key);
+
+        if(it != end() && ! key_compare()(key, it->first))
+        {
+            it->second = move(mapped_value);
+            return it;
+        }
+
+        return _emplace(it, key, move(mapped_value));
+    }
+
+    /**
+     * @brief Inserts in-place a (Key, Value) pair if the given key does not exist.
+     * @param key Key to insert.
+     * @param args Parameters of the value to insert.
+     * @return Iterator pointing to the inserted (Key, Value) pair if the key does not exist, otherwise end().
+     */
+    template<typename... Args>
+    iterator try_emplace(const key_type& key, Args&&... args)
+    {
+        iterator it = lower_bound(key);
+
+        if(it != end() && ! key_compare()(key, it->first))
+        {
+            return end();
+        }
+
+        return _emplace(it, key, mapped_type(forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Erases an element.
+     * @param position Iterator to the element to erase.
+     * @return Iterator following the erased element.
+     */
+    iterator erase(const_iterator position)
+    {
+        BN_ASSERT(_size, "Flat map is empty");
+        BN_ASSERT(position >= begin() && position < end(), "Invalid position");
+
+        auto non_const_position = const_cast<iterator>(position);
+        iterator it = non_const_position;
+        --_size;
+
+        iterator last = end();
+
+        while(it != last)
+        {
+            iterator next = it + 1;
+            *it = move(*next);
+            it = next;
+        }
+
+        _data[_size].~value_type();
+        return non_const_position;
+    }
+
+    /**
+     * @brief Erases an element.
+     * @param key Key of the element to erase.
+     * @return `true` if the element was erased, otherwise `false`.
+     */
+    bool erase(const key_type& key)
+    {
+        const_iterator it = find(key);
+
+        if(it == end())
+        {
+            return false;
+        }
+
+        erase(it);
+        return true;
+    }
+
+    /**
+     * @brief Erases all elements that satisfy the specified predicate.
+     * @param map iflat_map from which to erase.
+     * @param pred Unary predicate which returns `true` if the element should be erased.
+     * @return Number of erased elements.
+     */
+    template<class Pred>
+    friend size_type erase_if(iflat_map& map, const Pred& pred)
+    {
+        iterator first = remove_if(map.begin(), map.end(), pred);
+        iterator last = map.end();
+        size_type erased_count = last - first;
+
+        for(iterator it = first; it != last; ++it)
+        {
+            it->~value_type();
+        }
+
+        map._size -= erased_count;
+        return erased_count;
+    }
+
+    /**
+     * @brief Removes all elements.
+     */
+    void clear()
+    {
+        _size = 0;
+    }
+
+    /**
+     * @brief Removes all elements.
+     */
+    void clear()
+    requires(! is_trivially_destructible_v<value_type>)
+    {
+        pointer data = _data;
+
+        for(size_type index = 0, size = _size; index < size; ++index)
+        {
+            data[index].~value_type();
+        }
+
+        _size = 0;
+    }
+
+    /**
+     * @brief Returns a reference to the value stored with the specified key,
+     * inserting a default constructed value if the key does not exist.
+     * @param key Key to search.
+     * @return Reference to the value stored with the specified key.
+     */
+    [[nodiscard]] mapped_type& operator[](const key_type& key)
+    {
+        iterator it = lower_bound(key);
+
+        if(it == end() || key_compare()(key, it->first))
+        {
+            it = _emplace(it, key, mapped_type());
+        }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Exchanges the contents of this iflat_map with those of the other one.
+     * @param other iflat_map to exchange the contents with.
+     */
+    void swap(iflat_map& other)
+    {
+        if(_data != other._data)
+        {
+            BN_ASSERT(_size <= other._max_size, "Invalid size: ", _size, " - ", other._max_size);
+            BN_ASSERT(other._size <= _max_size, "Invalid other size: ", other._size, " - ", _max_size);
+
+            pointer min_data;
+            pointer max_data;
+            size_type min_size;
+            size_type max_size;
+
+            if(_size < other._size)
+            {
+                min_data = _data;
+                max_data = other._data;
+                min_size = _size;
+                max_size = other._size;
+            }
+            else
+            {
+                min_data = other._data;
+                max_data = _data;
+                min_size = other._size;
+                max_size = _size;
+            }
+
+            for(size_type index = 0; index < min_size; ++index)
+            {
+                bn::swap(min_data[index], max_data[index]);
+            }
+
+            for(size_type index = min_size; index < max_size; ++index)
+            {
+                ::new(min_data + index) value_type(move(max_data[index]));
+                max_data[index].~value_type();
+            }
+
+            bn::swap(_size, other._size);
+        }
+    }
+
+    /**
+     * @brief Exchanges the contents of a iflat_map with those of another one.
+     * @param a First iflat_map to exchange the contents with.
+     * @param b Second iflat_map to exchange the contents with.
+     */
+    friend void swap(iflat_map& a, iflat_map& b)
+    {
+        a.swap(b);
+    }
+
+    /**
+     * @brief Equal operator.
+     * @param a First iflat_map to compare.
+     * @param b Second iflat_map to compare.
+     * @return `true` if the first iflat_map is equal to the second one, otherwise `false`.
+     */
+    [[nodiscard]] friend bool operator==(const iflat_map& a, const iflat_map& b)
+    {
+        if(a._size != b._size)
+        {
+            return false;
+        }
+
+        return equal(a.begin(), a.end(), b.begin());
+    }
+
+    /**
+     * @brief Not equal operator.
+     * @param a First iflat_map to compare.
+     * @param b Second iflat_map to compare.
+     * @return `true` if the first iflat_map is not equal to the second one, otherwise `false`.
+     */
+    [[nodiscard]] friend bool operator!=(const iflat_map& a, const iflat_map& b)
+    {
+        return ! (a == b);
+    }
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    iflat_map(reference data, size_type max_size) :
+        _data(&data),
+        _size(0),
+        _max_size(max_size)
+    {
+    }
+
+    void _assign(const iflat_map& other)
+    {
+        pointer data = _data;
+        const_pointer other_data = other._data;
+        size_type other_size = other._size;
+        _size = other_size;
+
+        for(size_type index = 0; index < other_size; ++index)
+        {
+            ::new(data + index) value_type(other_data[index]);
+        }
+    }
+
+    void _assign(iflat_map&& other)
+    {
+        pointer data = _data;
+        pointer other_data = other._data;
+        size_type other_size = other._size;
+        _size = other_size;
+
+        for(size_type index = 0; index < other_size; ++index)
+        {
+            ::new(data + index) value_type(move(other_data[index]));
+        }
+
+        other.clear();
+    }
+
+    /// @endcond
+
+private:
+    pointer _data;
+    size_type _size;
+    size_type _max_size;
+
+    template<typename... Args>
+    iterator _emplace(iterator position, Args&&... args)
+    {
+        BN_ASSERT(! full(), "Flat map is full");
+
+        iterator last = end();
+
+        if(position == last)
+        {
+            ::new(last) value_type(forward<Args>(args)...);
+        }
+        else
+        {
+            // Build the value before shifting, since args can reference elements of this iflat_map:
+            value_type value(forward<Args>(args)...);
+            ::new(last) value_type(move(*(last - 1)));
+
+            for(iterator it = last - 1; it != position; --it)
+            {
+                *it = move(*(it - 1));
+            }
+
+            *position = move(value);
+        }
+
+        ++_size;
+        return position;
+    }
+
+    void _move_to(size_type index, size_type output_index, size_type size)
+    {
+        pointer data = _data;
+
+        if(output_index >= size)
+        {
+            ::new(data + output_index) value_type(move(data[index]));
+        }
+        else
+        {
+            data[output_index] = move(data[index]);
+        }
+    }
+};
+
+
+template<typename Key, typename Value, int MaxSize, typename KeyCompare>
+class flat_map : public iflat_map<Key, Value, KeyCompare>
+{
+    static_assert(MaxSize > 0);
+
+public:
+    using key_type = Key; //!< Key type alias.
+    using mapped_type = Value; //!< Value type alias.
+    using value_type = pair<Key, Value>; //!< (Key, Value) pair type alias.
+    using size_type = int; //!< Size type alias.
+    using difference_type = int; //!< Difference type alias.
+    using reference = value_type&; //!< (Key, Value) pair reference alias.
+    using const_reference = const value_type&; //!< (Key, Value) pair const reference alias.
+    using pointer = value_type*; //!< (Key, Value) pair pointer alias.
+    using const_pointer = const value_type*; //!< (Key, Value) pair const pointer alias.
+    using iterator = value_type*; //!< Iterator alias.
+    using const_iterator = const value_type*; //!< Const iterator alias.
+    using reverse_iterator = bn::reverse_iterator<iterator>; //!< Reverse iterator alias.
+    using const_reverse_iterator = bn::reverse_iterator<const_iterator>; //!< Const reverse iterator alias.
+    using key_compare = KeyCompare; //!< Key comparison functor alias.
+
+    /**
+     * @brief Default constructor.
+     */
+    flat_map() :
+        iflat_map<Key, Value, KeyCompare>(*reinterpret_cast<pointer>(_storage_buffer), MaxSize)
+    {
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other flat_map to copy.
+     */
+    flat_map(const flat_map& other) :
+        flat_map()
+    {
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other flat_map to move.
+     */
+    flat_map(flat_map&& other) noexcept :
+        flat_map()
+    {
+        this->_assign(move(other));
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other iflat_map to copy.
+     */
+    flat_map(const iflat_map<Key, Value, KeyCompare>& other) :
+        flat_map()
+    {
+        BN_ASSERT(other.size() <= MaxSize, "Not enough space: ", MaxSize, " - ", other.size());
+
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other iflat_map to move.
+     */
+    flat_map(iflat_map<Key, Value, KeyCompare>&& other) noexcept :
+        flat_map()
+    {
+        BN_ASSERT(other.size() <= MaxSize, "Not enough space: ", MaxSize, " - ", other.size());
+
+        this->_assign(move(other));
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other flat_map to copy.
+     * @return Reference to this.
+     */
+    flat_map& operator=(const flat_map& other)
+    {
+        if(this != &other)
+        {
+            this->clear();
+            this->_assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other flat_map to move.
+     * @return Reference to this.
+     */
+    flat_map& operator=(flat_map&& other) noexcept
+    {
+        if(this != &other)
+        {
+            this->clear();
+            this->_assign(move(other));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other iflat_map to copy.
+     * @return Reference to this.
+     */
+    flat_map& operator=(const iflat_map<Key, Value, KeyCompare>& other)
+    {
+        if(this != &other)
+        {
+            BN_ASSERT(other.size() <= MaxSize, "Not enough space: ", MaxSize, " - ", other.size());
+
+            this->clear();
+            this->_assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other iflat_map to move.
+     * @return Reference to this.
+     */
+    flat_map& operator=(iflat_map<Key, Value, KeyCompare>&& other) noexcept
+    {
+        if(this != &other)
+        {
+            BN_ASSERT(other.size() <= MaxSize, "Not enough space: ", MaxSize, " - ", other.size());
+
+            this->clear();
+            this->_assign(move(other));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~flat_map() noexcept = default;
+
+    /**
+     * @brief Destructor.
+     */
+    ~flat_map() noexcept
+    requires(! is_trivially_destructible_v<value_type>)
+    {
+        this->clear();
+    }
+
+private:
+    static constexpr unsigned _alignment = alignof(value_type) > alignof(int) ? alignof(value_type) : alignof(int);
+
+    alignas(_alignment) char _storage_buffer[sizeof(value_type) * MaxSize];
+};
+
+}
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FLAT_SET_FWD_H
+#define BN_FLAT_SET_FWD_H
+
+/**
+ * @file
+ * bn::iflat_set and bn::flat_set declaration header file.
+ *
+ * @ingroup flat_set
+ */
+
+#include "bn_functional.h"
+
+namespace bn
+{
+    /**
+     * @brief Base class of bn::flat_set.
+     *
+     * Can be used as a reference type for all bn::flat_set containers containing a specific type.
+     *
+     * Elements are stored sorted in a contiguous buffer, so it doesn't offer pointer stability
+     * when inserting or erasing elements.
+     *
+     * @tparam Key Element type.
+     * @tparam KeyCompare Functor used to sort keys.
+     *
+     * @ingroup flat_set
+     */
+    template<typename Key, typename KeyCompare = less<Key>>
+    class iflat_set;
+
+    /**
+     * @brief `std::flat_set` like container with a fixed size buffer.
+     *
+     * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+     *
+     * Elements are stored sorted in a contiguous buffer, so it doesn't offer pointer stability
+     * when inserting or erasing elements.
+     *
+     * @tparam Key Element type.
+     * @tparam MaxSize Maximum number of elements that can be stored.
+     * @tparam KeyCompare Functor used to sort keys.
+     *
+     * @ingroup flat_set
+     */
+    template<typename Key, int MaxSize, typename KeyCompare = less<Key>>
+    class flat_set;
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FRAME_ARENA_H
+#define BN_FRAME_ARENA_H
+
+/**
+ * @file
+ * bn::frame_arena header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_common.h"
+
+/**
+ * @brief Frame arena related functions.
+ *
+ * A frame arena is a fixed chunk of memory where storage is allocated by incrementing a pointer.
+ *
+ * All storage allocated in a frame arena is released at the end of bn::core::update,
+ * so it is useful for temporary data which only lives for one frame
+ * (text strings, sort scratch buffers, command lists...).
+ *
+ * Destructors of the values stored in a frame arena are not called.
+ *
+ * Frame arenas size can be specified with @ref BN_CFG_FRAME_ARENA_EWRAM_BYTES and
+ * @ref BN_CFG_FRAME_ARENA_IWRAM_BYTES.
+ *
+ * @ingroup memory
+ */
+namespace bn::frame_arena
+{
+    /**
+     * @brief Allocates uninitialized storage in the EWRAM frame arena.
+     * @param bytes Bytes to allocate.
+     * @return On success, returns the pointer to the beginning of newly allocated memory.
+     * On failure, returns `nullptr`.
+     *
+     * The returned pointer is invalidated at the end of bn::core::update.
+     */
+    [[nodiscard]] void* ewram_alloc(int bytes);
+
+    /**
+     * @brief Allocates uninitialized storage in the IWRAM frame arena.
+     * @param bytes Bytes to allocate.
+     * @return On success, returns the pointer to the beginning of newly allocated memory.
+     * On failure, returns `nullptr`.
+     *
+     * The returned pointer is invalidated at the end of bn::core::update.
+     */
+    [[nodiscard]] void* iwram_alloc(int bytes);
+
+    /**
+     * @brief Returns the number of bytes allocated in the EWRAM frame arena in the current frame.
+     */
+    [[nodiscard]] int used_ewram();
+
+    /**
+     * @brief Returns the number of bytes that still can be allocated in the EWRAM frame arena in the current frame.
+     */
+    [[nodiscard]] int available_ewram();
+
+    /**
+     * @brief Returns the number of bytes allocated in the IWRAM frame arena in the current frame.
+     */
+    [[nodiscard]] int used_iwram();
+
+    /**
+     * @brief Returns the number of bytes that still can be allocated in the IWRAM frame arena in the current frame.
+     */
+    [[nodiscard]] int available_iwram();
+}
+
+#endif
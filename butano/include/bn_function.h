@@ -0,0 +1,482 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FUNCTION_H
+#define BN_FUNCTION_H
+
+/**
+ * @file
+ * bn::ifunction and bn::function implementation header file.
+ *
+ * @ingroup function
+ */
+
+#include <new>
+#include "bn_assert.h"
+#include "bn_limits.h"
+#include "bn_utility.h"
+#include "bn_function_fwd.h"
+
+namespace bn
+{
+
+/**
+ * @brief Base class of bn::function.
+ *
+ * Can be used as a reference type for all bn::function containers with a specific signature.
+ *
+ * @tparam Result Return type of the function signature.
+ * @tparam Args Parameter types of the function signature.
+ *
+ * @ingroup function
+ */
+template<typename Result, typename... Args>
+class ifunction<Result(Args...)>
+{
+
+public:
+    using result_type = Result; //!< Result type alias.
+
+    ifunction(const ifunction& other) = delete;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ifunction() noexcept
+    {
+        reset();
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other ifunction to copy.
+     * @return Reference to this.
+     */
+    ifunction& operator=(const ifunction& other)
+    {
+        if(this != &other)
+        {
+            reset();
+            _assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other ifunction to move.
+     * @return Reference to this.
+     */
+    ifunction& operator=(ifunction&& other) noexcept
+    {
+        if(this != &other)
+        {
+            reset();
+            _assign(move(other));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Assignment operator.
+     * @param value Callable object to copy or move.
+     * @return Reference to this.
+     */
+    template<typename Type>
+    ifunction& operator=(Type&& value)
+    requires(! is_base_of_v<ifunction, decay_t<Type>>)
+    {
+        reset();
+        _create<decay_t<Type>>(forward<Type>(value));
+        return *this;
+    }
+
+    /**
+     * @brief Indicates if it contains a callable object or not.
+     */
+    [[nodiscard]] bool has_value() const
+    {
+        return _invoker;
+    }
+
+    /**
+     * @brief Indicates if it contains a callable object or not.
+     */
+    [[nodiscard]] explicit operator bool() const
+    {
+        return _invoker;
+    }
+
+    /**
+     * @brief Returns the maximum size in bytes of the managed callable objects.
+     */
+    [[nodiscard]] int max_size() const
+    {
+        return _max_size;
+    }
+
+    /**
+     * @brief Returns the maximum alignment in bytes of the managed callable objects.
+     */
+    [[nodiscard]] int max_alignment() const
+    {
+        return _max_alignment;
+    }
+
+    /**
+     * @brief Calls the contained callable object.
+     * @param args Arguments of the call.
+     * @return Result of the call.
+     */
+    Result operator()(Args... args) const
+    {
+        BN_ASSERT(_invoker, "Function is empty");
+
+        return _invoker(_storage, forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Disposes the contained callable object.
+     */
+    void reset()
+    {
+        if(_invoker)
+        {
+            base_manager* manager = _manager_ptr();
+            manager->destroy(*this);
+            manager->~base_manager();
+            _invoker = nullptr;
+        }
+    }
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    class base_manager
+    {
+
+    public:
+        virtual ~base_manager() = default;
+
+        virtual void copy_to(const ifunction& this_function, ifunction& other_function) const = 0;
+
+        virtual void move_to(ifunction& this_function, ifunction& other_function) const = 0;
+
+        virtual void destroy(ifunction& function) const = 0;
+    };
+
+    template<typename Type>
+    class type_manager : public base_manager
+    {
+
+    public:
+        void copy_to(const ifunction& this_function, ifunction& other_function) const final
+        {
+            if constexpr(is_copy_constructible_v<Type>)
+            {
+                other_function._create<Type>(*this_function._value_ptr<Type>());
+            }
+            else
+            {
+                BN_ERROR("This type can't be copied");
+            }
+        }
+
+        void move_to(ifunction& this_function, ifunction& other_function) const final
+        {
+            other_function._create<Type>(move(*this_function._value_ptr<Type>()));
+            this_function.reset();
+        }
+
+        void destroy(ifunction& function) const final
+        {
+            function._value_ptr<Type>()->~Type();
+        }
+    };
+
+    using invoker_type = Result(*)(char* storage, Args&&... args);
+
+    ifunction(char* storage, int max_size, int max_alignment) :
+        _storage(storage),
+        _max_size(max_size),
+        _max_alignment(int16_t(max_alignment))
+    {
+    }
+
+    template<typename Type>
+    [[nodiscard]] const Type* _value_ptr() const
+    {
+        return reinterpret_cast<const Type*>(_storage);
+    }
+
+    template<typename Type>
+    [[nodiscard]] Type* _value_ptr()
+    {
+        return reinterpret_cast<Type*>(_storage);
+    }
+
+    template<typename Type, typename Value>
+    void _create(Value&& value)
+    {
+        static_assert(sizeof(type_manager<Type>) == sizeof(base_manager));
+        static_assert(alignof(type_manager<Type>) == alignof(base_manager));
+
+        BN_ASSERT(int(sizeof(Type)) <= _max_size, "Invalid value size: ", sizeof(Type), " - ", _max_size);
+        BN_ASSERT(int(alignof(Type)) <= _max_alignment, "Invalid value alignment: ",
+                   alignof(Type), " - ", _max_alignment);
+
+        ::new(_value_ptr<Type>()) Type(forward<Value>(value));
+        ::new(_manager_ptr()) type_manager<Type>();
+        _invoker = &_invoke<Type>;
+    }
+
+    void _assign(const ifunction& other)
+    {
+        if(other._invoker)
+        {
+            other._manager_ptr()->copy_to(other, *this);
+        }
+    }
+
+    void _assign(ifunction&& other)
+    {
+        if(other._invoker)
+        {
+            other._manager_ptr()->move_to(other, *this);
+        }
+    }
+
+    /// @endcond
+
+private:
+    alignas(base_manager) char _base_manager_buffer[sizeof(base_manager)];
+    invoker_type _invoker = nullptr;
+    char* _storage;
+    int _max_size;
+    int16_t _max_alignment;
+
+    template<typename Type>
+    static Result _invoke(char* storage, Args&&... args)
+    {
+        return (*reinterpret_cast<Type*>(storage))(forward<Args>(args)...);
+    }
+
+    [[nodiscard]] const base_manager* _manager_ptr() const
+    {
+        return reinterpret_cast<const base_manager*>(_base_manager_buffer);
+    }
+
+    [[nodiscard]] base_manager* _manager_ptr()
+    {
+        return reinterpret_cast<base_manager*>(_base_manager_buffer);
+    }
+};
+
+
+/**
+ * @brief `std::function` like container with a fixed size buffer.
+ *
+ * It stores any callable object (function pointers, lambdas with captures, functors...)
+ * without allocating memory, and calling it has the overhead of one indirect call.
+ *
+ * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+ *
+ * @tparam Result Return type of the function signature.
+ * @tparam Args Parameter types of the function signature.
+ * @tparam MaxSize Maximum size in bytes of the managed callable objects.
+ * @tparam MaxAlignment Maximum alignment in bytes of the managed callable objects.
+ *
+ * @ingroup function
+ */
+template<typename Result, typename... Args, int MaxSize, int MaxAlignment>
+class function<Result(Args...), MaxSize, MaxAlignment> : public ifunction<Result(Args...)>
+{
+    static_assert(MaxSize > 0);
+    static_assert(MaxAlignment > 0 && MaxAlignment <= numeric_limits<int16_t>::max());
+
+    using base_type = ifunction<Result(Args...)>;
+
+public:
+    using result_type = Result; //!< Result type alias.
+
+    /**
+     * @brief Default constructor.
+     */
+    function() :
+        base_type(_storage_buffer, MaxSize, MaxAlignment)
+    {
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other function to copy.
+     */
+    function(const function& other) :
+        function()
+    {
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other function to move.
+     */
+    function(function&& other) noexcept :
+        function()
+    {
+        this->_assign(move(other));
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other ifunction to copy.
+     */
+    function(const base_type& other) :
+        function()
+    {
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other ifunction to move.
+     */
+    function(base_type&& other) noexcept :
+        function()
+    {
+        this->_assign(move(other));
+    }
+
+    /**
+     * @brief Constructor.
+     * @param value Callable object to copy or move.
+     */
+    template<typename Type>
+    function(Type&& value)
+    requires(! is_base_of_v<base_type, decay_t<Type>>) :
+        function()
+    {
+        static_assert(int(sizeof(decay_t<Type>)) <= MaxSize);
+        static_assert(int(alignof(decay_t<Type>)) <= MaxAlignment);
+
+        this->template _create<decay_t<Type>>(forward<Type>(value));
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other function to copy.
+     * @return Reference to this.
+     */
+    function& operator=(const function& other)
+    {
+        if(this != &other)
+        {
+            this->reset();
+            this->_assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other function to move.
+     * @return Reference to this.
+     */
+    function& operator=(function&& other) noexcept
+    {
+        if(this != &other)
+        {
+            this->reset();
+            this->_assign(move(other));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other ifunction to copy.
+     * @return Reference to this.
+     */
+    function& operator=(const base_type& other)
+    {
+        if(this != &other)
+        {
+            this->reset();
+            this->_assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other ifunction to move.
+     * @return Reference to this.
+     */
+    function& operator=(base_type&& other) noexcept
+    {
+        if(this != &other)
+        {
+            this->reset();
+            this->_assign(move(other));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Assignment operator.
+     * @param value Callable object to copy or move.
+     * @return Reference to this.
+     */
+    template<typename Type>
+    function& operator=(Type&& value)
+    requires(! is_base_of_v<base_type, decay_t<Type>>)
+    {
+        static_assert(int(sizeof(decay_t<Type>)) <= MaxSize);
+        static_assert(int(alignof(decay_t<Type>)) <= MaxAlignment);
+
+        this->reset();
+        this->template _create<decay_t<Type>>(forward<Type>(value));
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents of this function with those of the other one.
+     * @param other function to exchange the contents with.
+     */
+    void swap(function& other)
+    {
+        if(this != &other)
+        {
+            function temp(move(other));
+            other = move(*this);
+            *this = move(temp);
+        }
+    }
+
+    /**
+     * @brief Exchanges the contents of a function with those of another one.
+     * @param a First function to exchange the contents with.
+     * @param b Second function to exchange the contents with.
+     */
+    friend void swap(function& a, function& b)
+    {
+        a.swap(b);
+    }
+
+private:
+    static constexpr unsigned _alignment = MaxAlignment > alignof(int) ? MaxAlignment : alignof(int);
+
+    alignas(_alignment) char _storage_buffer[MaxSize];
+};
+
+}
+
+#endif
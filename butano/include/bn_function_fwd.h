@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FUNCTION_FWD_H
+#define BN_FUNCTION_FWD_H
+
+/**
+ * @file
+ * bn::ifunction and bn::function declaration header file.
+ *
+ * @ingroup function
+ */
+
+#include "bn_common.h"
+
+namespace bn
+{
+    /**
+     * @brief Base class of bn::function.
+     *
+     * Can be used as a reference type for all bn::function containers with a specific signature.
+     *
+     * @tparam Signature Function signature (for example, `void(int)`).
+     *
+     * @ingroup function
+     */
+    template<typename Signature>
+    class ifunction;
+
+    /**
+     * @brief `std::function` like container with a fixed size buffer.
+     *
+     * It stores any callable object (function pointers, lambdas with captures, functors...)
+     * without allocating memory, and calling it has the overhead of one indirect call.
+     *
+     * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+     *
+     * @tparam Signature Function signature (for example, `void(int)`).
+     * @tparam MaxSize Maximum size in bytes of the managed callable objects.
+     * @tparam MaxAlignment Maximum alignment in bytes of the managed callable objects.
+     *
+     * @ingroup function
+     */
+    template<typename Signature, int MaxSize = int(sizeof(int) * 2), int MaxAlignment = alignof(int)>
+    class function;
+}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_IWRAM_OVERLAY_H
+#define BN_IWRAM_OVERLAY_H
+
+/**
+ * @file
+ * bn::iwram_overlay header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_optional.h"
+#include "../hw/include/bn_hw_iwram_overlay.h"
+
+/**
+ * @brief IWRAM code overlays related functions.
+ *
+ * An IWRAM overlay is a group of functions and data that is stored in ROM and copied on demand
+ * into a window of IWRAM shared by all overlays, so for example a scene can run a collision routine
+ * from IWRAM and another scene can run an audio mixer from the same IWRAM window.
+ *
+ * Functions and data are placed in an overlay with the @ref BN_CODE_IWRAM_OVERLAY macro.
+ * As with @ref BN_CODE_IWRAM, functions should be defined in `.bn_iwram.cpp` files,
+ * so they are compiled to ARM code without link time optimization.
+ *
+ * The window size is the size of the biggest overlay.
+ *
+ * Calling a function of an overlay which is not loaded results in undefined behavior.
+ *
+ * @ingroup memory
+ */
+namespace bn::iwram_overlay
+{
+    /**
+     * @brief Returns the number of available overlays.
+     */
+    [[nodiscard]] constexpr int count()
+    {
+        return hw::iwram_overlay::count();
+    }
+
+    /**
+     * @brief Returns the size in bytes of the IWRAM window shared by all overlays.
+     */
+    [[nodiscard]] int window_size();
+
+    /**
+     * @brief Returns the size in bytes of the specified overlay.
+     * @param id Overlay index (from 0 to 9).
+     */
+    [[nodiscard]] int size(int id);
+
+    /**
+     * @brief Returns the index of the overlay currently loaded in the IWRAM window,
+     * or bn::nullopt if no overlay has been loaded yet.
+     */
+    [[nodiscard]] optional<int> loaded_id();
+
+    /**
+     * @brief Copies the specified overlay from ROM to the IWRAM window,
+     * replacing the previously loaded one.
+     *
+     * If the specified overlay is already loaded, this function does nothing.
+     *
+     * @param id Overlay index (from 0 to 9).
+     */
+    void load(int id);
+}
+
+#endif
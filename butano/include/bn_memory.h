@@ -17,7 +17,9 @@
 #include <memory>
 #include "bn_alignment.h"
 #include "bn_unique_ptr.h"
+#include "bn_allocator_stats.h"
 #include "bn_config_log.h"
+#include "bn_config_stack.h"
 #include "bn_config_doxygen.h"
 
 namespace bn
@@ -121,11 +123,23 @@ namespace bn::memory
      */
     [[nodiscard]] int available_alloc_ewram();
 
+    /**
+     * @brief Returns usage and fragmentation statistics of the EWRAM allocator.
+     *
+     * Fragmentation statistics are calculated by iterating all allocated items, so this function is not fast.
+     */
+    [[nodiscard]] allocator_stats alloc_ewram_stats();
+
     #if BN_CFG_LOG_ENABLED || BN_DOXYGEN
         /**
          * @brief Logs the current status of the EWRAM allocator.
          */
         void log_alloc_ewram_status();
+
+        /**
+         * @brief Logs usage and fragmentation statistics of the EWRAM allocator.
+         */
+        void log_alloc_ewram_stats();
     #endif
 
     /**
@@ -133,8 +147,18 @@ namespace bn::memory
      */
     [[nodiscard]] int used_stack_iwram();
 
+    #if BN_CFG_STACK_IWRAM_PAINTING_ENABLED || BN_DOXYGEN
+        /**
+         * @brief Returns the maximum IWRAM used by the stack in bytes (high-water mark)
+         * until the last bn::core::update call.
+         *
+         * It requires @ref BN_CFG_STACK_IWRAM_PAINTING_ENABLED.
+         */
+        [[nodiscard]] int max_used_stack_iwram();
+    #endif
+
     /**
-     * @brief Returns the bytes of all static objects in IWRAM.
+     * @brief Returns the bytes of all static objects in IWRAM (including the IWRAM overlays window).
      */
     [[nodiscard]] int used_static_iwram();
 
@@ -116,6 +116,36 @@ public:
         return _dimensions.width() > 64 || _dimensions.height() > 64;
     }
 
+    /**
+     * @brief Returns the width and height in map cells of the chunks of compressed big maps.
+     */
+    [[nodiscard]] static constexpr int chunk_size()
+    {
+        return 32;
+    }
+
+    /**
+     * @brief Returns the number of map cells of each chunk of compressed big maps.
+     */
+    [[nodiscard]] static constexpr int chunk_cells()
+    {
+        return chunk_size() * chunk_size();
+    }
+
+    /**
+     * @brief Indicates if the referenced map cells are split in independently compressed chunks or not.
+     *
+     * Compressed big maps are split in chunks of chunk_size() x chunk_size() map cells,
+     * so only the chunks that enter in view must be decompressed.
+     *
+     * Their data starts with a table of 32-bit byte offsets (one per chunk, in row-major order)
+     * followed by the compressed chunks.
+     */
+    [[nodiscard]] constexpr bool chunked() const
+    {
+        return _compression != compression_type::NONE && big();
+    }
+
     /**
      * @brief Returns the compression type.
      */
@@ -209,6 +239,14 @@ public:
     [[nodiscard]] regular_bg_map_item decompress(regular_bg_map_cell& decompressed_cells_ref,
                                                  const size& decompressed_dimensions) const;
 
+    /**
+     * @brief Decompresses a chunk of a compressed big map.
+     * @param chunk_x Horizontal position of the chunk [0..dimensions().width() / chunk_size()).
+     * @param chunk_y Vertical position of the chunk [0..dimensions().height() / chunk_size()).
+     * @param decompressed_cells_ref Destination of the chunk_cells() decompressed map cells.
+     */
+    void decompress_chunk(int chunk_x, int chunk_y, regular_bg_map_cell& decompressed_cells_ref) const;
+
     /// @cond DO_NOT_DOCUMENT
 
     [[deprecated("Call decompress() instead")]]
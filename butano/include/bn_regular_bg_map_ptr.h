@@ -21,6 +21,7 @@
 namespace bn
 {
 
+class rect;
 class size;
 class bg_palette_ptr;
 class bg_palette_item;
@@ -315,6 +316,35 @@ public:
      */
     void reload_cells_ref();
 
+    /**
+     * @brief Sets the referenced map cell in the specified map coordinates.
+     *
+     * The referenced map cells are modified, so they must be uncompressed and stored in RAM
+     * (map cells generated by the graphics tool are stored in ROM, so they can't be modified).
+     *
+     * Only the modified rows are uploaded to VRAM in the next frame
+     * (see BN_CFG_BG_BLOCKS_MAX_DIRTY_ROWS). Big maps are uploaded to VRAM again instead.
+     *
+     * @param map_x Horizontal position of the map cell [0..dimensions().width()).
+     * @param map_y Vertical position of the map cell [0..dimensions().height()).
+     * @param cell New map cell.
+     */
+    void set_cell(int map_x, int map_y, regular_bg_map_cell cell);
+
+    /**
+     * @brief Sets the referenced map cells in the specified map region.
+     *
+     * The referenced map cells are modified, so they must be uncompressed and stored in RAM
+     * (map cells generated by the graphics tool are stored in ROM, so they can't be modified).
+     *
+     * Only the modified rows are uploaded to VRAM in the next frame
+     * (see BN_CFG_BG_BLOCKS_MAX_DIRTY_ROWS). Big maps are uploaded to VRAM again instead.
+     *
+     * @param cells_rect Map region to modify.
+     * @param cells New map cells, stored row by row (cells_rect.width() * cells_rect.height() cells).
+     */
+    void set_cells(const rect& cells_rect, const span<const regular_bg_map_cell>& cells);
+
     /**
      * @brief Returns the referenced tiles.
      */
@@ -92,6 +92,42 @@ public:
     [[nodiscard]] static optional<regular_bg_position_hbe_ptr> create_vertical_optional(
             regular_bg_ptr bg, const span<const fixed>& deltas_ref);
 
+    /**
+     * @brief Creates a regular_bg_position_hbe_ptr which changes the horizontal position of a
+     * regular background in each screen horizontal line from the horizontal position of its camera.
+     * @param bg Regular background to be modified.
+     * @param factors_ref Reference to an array of 160 factors to apply to the horizontal position
+     * of the camera of the given regular background in each screen horizontal line,
+     * replacing its camera factor (see regular_bg_ptr::set_camera_factor).
+     *
+     * The factors are not copied but referenced, so they should outlive the regular_bg_position_hbe_ptr
+     * to avoid dangling references.
+     *
+     * Since the H-Blank effect is updated when the camera moves, the factors can be precomputed only once.
+     *
+     * @return The requested regular_bg_position_hbe_ptr.
+     */
+    [[nodiscard]] static regular_bg_position_hbe_ptr create_horizontal_parallax(
+            regular_bg_ptr bg, const span<const fixed>& factors_ref);
+
+    /**
+     * @brief Creates a regular_bg_position_hbe_ptr which changes the horizontal position of a
+     * regular background in each screen horizontal line from the horizontal position of its camera.
+     * @param bg Regular background to be modified.
+     * @param factors_ref Reference to an array of 160 factors to apply to the horizontal position
+     * of the camera of the given regular background in each screen horizontal line,
+     * replacing its camera factor (see regular_bg_ptr::set_camera_factor).
+     *
+     * The factors are not copied but referenced, so they should outlive the regular_bg_position_hbe_ptr
+     * to avoid dangling references.
+     *
+     * Since the H-Blank effect is updated when the camera moves, the factors can be precomputed only once.
+     *
+     * @return The requested regular_bg_position_hbe_ptr if it could be allocated; bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<regular_bg_position_hbe_ptr> create_horizontal_parallax_optional(
+            regular_bg_ptr bg, const span<const fixed>& factors_ref);
+
     /**
      * @brief Returns the regular background modified by this H-Blank effect.
      */
@@ -102,7 +138,8 @@ public:
 
     /**
      * @brief Returns the referenced array of 160 deltas to add to the horizontal or vertical position
-     * of the managed regular background in each screen horizontal line.
+     * of the managed regular background in each screen horizontal line
+     * (or the referenced array of 160 camera factors for parallax H-Blank effects).
      *
      * The deltas are not copied but referenced, so they should outlive the regular_bg_position_hbe_ptr
      * to avoid dangling references.
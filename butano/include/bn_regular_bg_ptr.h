@@ -489,6 +489,24 @@ public:
      */
     void remove_camera();
 
+    /**
+     * @brief Returns the factor applied to the position of the camera_ptr attached to this regular background.
+     *
+     * By default it is (1, 1).
+     */
+    [[nodiscard]] const fixed_point& camera_factor() const;
+
+    /**
+     * @brief Sets the factor applied to the position of the camera_ptr attached to this regular background.
+     *
+     * It allows to implement parallax scrolling with a single camera_ptr:
+     * a factor of (0.5, 0.5) moves the regular background at half the speed of the camera,
+     * and a factor of (0, 0) keeps it fixed on screen.
+     *
+     * @param camera_factor Camera factor to set.
+     */
+    void set_camera_factor(const fixed_point& camera_factor);
+
     /**
      * @brief Returns the attributes to commit to the GBA for this regular background.
      */
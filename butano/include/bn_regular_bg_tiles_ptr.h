@@ -16,6 +16,7 @@
 
 #include "bn_span.h"
 #include "bn_optional.h"
+#include "bn_config_bg_blocks.h"
 
 namespace bn
 {
@@ -87,6 +88,34 @@ public:
      */
     [[nodiscard]] static regular_bg_tiles_ptr allocate(int tiles_count, bpp_mode bpp);
 
+    #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES || BN_DOXYGEN
+        /**
+         * @brief Creates a regular_bg_tiles_ptr which references a VRAM tiles cache
+         * filled on demand from a tile pool bigger than VRAM.
+         *
+         * Big regular maps which use these tiles must be uncompressed, and their cells must store
+         * the pool tile index in the bits [0..13], the horizontal flip in the bit 14
+         * and the vertical flip in the bit 15. Their palette bank is always the first one.
+         *
+         * Map cells are rewritten to cache tiles as they scroll in,
+         * and cache tiles not visible anymore are reused with a least recently released policy.
+         *
+         * Only one streamed regular_bg_tiles_ptr can exist at the same time,
+         * and only one regular map can use it.
+         *
+         * The pool tiles are not copied but referenced,
+         * so they should outlive the regular_bg_tiles_ptr to avoid dangling references.
+         *
+         * @param tiles_pool Tiles referenced by the map cells
+         * (up to BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES tiles).
+         * @param bpp Bits per pixel of the tiles.
+         * @param cache_tiles_count Number of VRAM tiles used as cache.
+         * @return regular_bg_tiles_ptr which references the VRAM tiles cache.
+         */
+        [[nodiscard]] static regular_bg_tiles_ptr create_streamed(const span<const tile>& tiles_pool, bpp_mode bpp,
+                                                                  int cache_tiles_count);
+    #endif
+
     /**
      * @brief Searches for a regular_bg_tiles_ptr which references the given tiles.
      * If it is not found, it creates a regular_bg_tiles_ptr which references them.
@@ -74,8 +74,7 @@ public:
         _shape_size(shape_size)
     {
         BN_ASSERT(tiles_item.bpp() == palette_item.bpp(), "Tiles and color palette BPP are different");
-        BN_ASSERT(tiles_item.tiles_ref().size() ==
-                  _shape_size.tiles_count(palette_item.bpp()) * tiles_item.graphics_count(),
+        BN_ASSERT(tiles_item.tiles_count_per_graphic() == _shape_size.tiles_count(palette_item.bpp()),
                   "Invalid shape or size");
     }
 
@@ -304,6 +304,9 @@ public:
      * Before creating a new sprite tile set, the sprite_tiles_ptr used by this sprite is removed,
      * so VRAM usage is reduced.
      *
+     * If the sprite tiles used by this sprite are streamed, they are not replaced:
+     * they reference the requested tile set instead.
+     *
      * The new sprite tiles must be compatible with the current color palette, shape and size of the sprite.
      *
      * @param tiles_item It creates the sprite tiles to use by this sprite.
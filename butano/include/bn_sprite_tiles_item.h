@@ -83,6 +83,7 @@ public:
      */
     constexpr sprite_tiles_item(const span<const tile>& tiles_ref, bpp_mode bpp, compression_type compression) :
         _tiles_ref(tiles_ref),
+        _graphics_indexes(nullptr),
         _graphics_count(1),
         _tiles_count_per_graphic(tiles_ref.size()),
         _compression(uint8_t(compression)),
@@ -121,6 +122,7 @@ public:
     constexpr sprite_tiles_item(const span<const tile>& tiles_ref, bpp_mode bpp, compression_type compression,
                                 int graphics_count) :
         _tiles_ref(tiles_ref),
+        _graphics_indexes(nullptr),
         _graphics_count(graphics_count),
         _tiles_count_per_graphic(0),
         _compression(uint8_t(compression)),
@@ -138,6 +140,53 @@ public:
         _tiles_count_per_graphic = tcpg;
     }
 
+    /**
+     * @brief Constructor.
+     * @param tiles_ref Reference to one or more unique sprite tile sets.
+     *
+     * The tiles are not copied but referenced, so they should outlive the sprite_tiles_item
+     * to avoid dangling references.
+     *
+     * @param bpp tiles_ref bits per pixel.
+     * @param graphics_indexes_ref Reference to the index of the sprite tile set in tiles_ref
+     * used by each graphic, so repeated graphics can share the same tiles.
+     *
+     * The indexes are not copied but referenced, so they should outlive the sprite_tiles_item
+     * to avoid dangling references.
+     */
+    constexpr sprite_tiles_item(const span<const tile>& tiles_ref, bpp_mode bpp,
+                                const span<const uint16_t>& graphics_indexes_ref) :
+        _tiles_ref(tiles_ref),
+        _graphics_indexes(graphics_indexes_ref.data()),
+        _graphics_count(graphics_indexes_ref.size()),
+        _tiles_count_per_graphic(0),
+        _compression(uint8_t(compression_type::NONE)),
+        _bpp(uint8_t(bpp))
+    {
+        int graphics_count = graphics_indexes_ref.size();
+        BN_ASSERT(graphics_count > 0 && graphics_count < 65536, "Invalid graphics count: ", graphics_count);
+
+        int unique_graphics_count = 0;
+
+        for(int graphics_index : graphics_indexes_ref)
+        {
+            if(graphics_index >= unique_graphics_count)
+            {
+                unique_graphics_count = graphics_index + 1;
+            }
+        }
+
+        BN_ASSERT(unique_graphics_count <= tiles_ref.size(),
+                  "Invalid tiles or graphics indexes: ", tiles_ref.size(), " - ", unique_graphics_count);
+        BN_ASSERT(tiles_ref.size() % unique_graphics_count == 0,
+                  "Invalid tiles or graphics indexes: ", tiles_ref.size(), " - ", unique_graphics_count);
+
+        int tcpg = tiles_ref.size() / unique_graphics_count;
+        BN_ASSERT(valid_tiles_count(tcpg, bpp), "Invalid tiles count per graphic: ", tcpg, " - ", int(bpp));
+
+        _tiles_count_per_graphic = tcpg;
+    }
+
     /**
      * @brief Returns the reference to one or more sprite tile sets.
      *
@@ -158,7 +207,23 @@ public:
     }
 
     /**
-     * @brief Returns the number of sprite tile sets contained in tiles_ref.
+     * @brief Returns the reference to the index of the sprite tile set in tiles_ref used by each graphic
+     * if repeated graphics have been removed; an empty span otherwise.
+     */
+    [[nodiscard]] constexpr span<const uint16_t> graphics_indexes_ref() const
+    {
+        span<const uint16_t> result;
+
+        if(_graphics_indexes)
+        {
+            result = span<const uint16_t>(_graphics_indexes, _graphics_count);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Returns the number of sprite tile sets referenced by this item.
      */
     [[nodiscard]] constexpr int graphics_count() const
     {
@@ -195,6 +260,11 @@ public:
         BN_ASSERT(graphics_index < _graphics_count,
                   "Invalid graphics index: ", graphics_index, " - ", _graphics_count);
 
+        if(_graphics_indexes)
+        {
+            graphics_index = _graphics_indexes[graphics_index];
+        }
+
         int tiles_count = _tiles_count_per_graphic;
         return span<const tile>(_tiles_ref.data() + (graphics_index * tiles_count), tiles_count);
     }
@@ -359,7 +429,7 @@ public:
     [[nodiscard]] constexpr friend bool operator==(const sprite_tiles_item& a, const sprite_tiles_item& b)
     {
         return a._tiles_ref.data() == b._tiles_ref.data() && a._tiles_ref.size() == b._tiles_ref.size() &&
-                a._graphics_count == b._graphics_count;
+                a._graphics_indexes == b._graphics_indexes && a._graphics_count == b._graphics_count;
     }
 
     /**
@@ -375,6 +445,7 @@ public:
 
 private:
     span<const tile> _tiles_ref;
+    const uint16_t* _graphics_indexes;
 
     uint16_t _graphics_count;
 
@@ -116,6 +116,89 @@ public:
      */
     [[nodiscard]] static sprite_tiles_ptr create_new(const sprite_tiles_item& tiles_item, int graphics_index);
 
+    /**
+     * @brief Creates a double buffered sprite_tiles_ptr which references the given tiles.
+     *
+     * Two chunks of VRAM tiles are allocated: when the referenced tiles are changed,
+     * the new ones are uploaded to the chunk not visible on the screen,
+     * and sprites are pointed to it when they are committed to VRAM.
+     *
+     * This avoids tearing when replacing big tile sets, and it also allows to upload tiles outside VBlank.
+     *
+     * The sprite tiles system does not support multiple sprite_tiles_ptr items referencing to the same tiles.
+     *
+     * The tiles are not copied but referenced,
+     * so they should outlive the sprite_tiles_ptr to avoid dangling references.
+     *
+     * @param tiles_item sprite_tiles_item which references the tiles to handle.
+     * @return sprite_tiles_ptr which references tiles_item.graphics_tiles_ref().
+     */
+    [[nodiscard]] static sprite_tiles_ptr create_new_double_buffered(const sprite_tiles_item& tiles_item);
+
+    /**
+     * @brief Creates a double buffered sprite_tiles_ptr which references the given tiles.
+     *
+     * Two chunks of VRAM tiles are allocated: when the referenced tiles are changed,
+     * the new ones are uploaded to the chunk not visible on the screen,
+     * and sprites are pointed to it when they are committed to VRAM.
+     *
+     * This avoids tearing when replacing big tile sets, and it also allows to upload tiles outside VBlank.
+     *
+     * The sprite tiles system does not support multiple sprite_tiles_ptr items referencing to the same tiles.
+     *
+     * The tiles are not copied but referenced,
+     * so they should outlive the sprite_tiles_ptr to avoid dangling references.
+     *
+     * @param tiles_item sprite_tiles_item which references the tiles to handle.
+     * @param graphics_index Index of the tile set to reference in sprite_tiles_item.
+     * @return sprite_tiles_ptr which references tiles_item.graphics_tiles_ref(graphics_index).
+     */
+    [[nodiscard]] static sprite_tiles_ptr create_new_double_buffered(const sprite_tiles_item& tiles_item,
+                                                                     int graphics_index);
+
+    /**
+     * @brief Creates a streamed sprite_tiles_ptr which references the given tiles.
+     *
+     * Streamed tiles own a fixed chunk of VRAM tiles that is fed directly from ROM:
+     * when the referenced tiles are changed, the new ones are copied to VRAM in the next VBlank
+     * without searching or allocating VRAM tiles.
+     *
+     * This is meant for very large animations, where allocating a tile set per frame is too expensive.
+     *
+     * Streamed tiles are never shared: find and create methods don't return them,
+     * and multiple streamed sprite_tiles_ptr items can reference the same tiles.
+     *
+     * The tiles are not copied but referenced,
+     * so they should outlive the sprite_tiles_ptr to avoid dangling references.
+     *
+     * @param tiles_item sprite_tiles_item which references the tiles to handle.
+     * It must not be compressed.
+     * @return sprite_tiles_ptr which references tiles_item.graphics_tiles_ref().
+     */
+    [[nodiscard]] static sprite_tiles_ptr create_streamed(const sprite_tiles_item& tiles_item);
+
+    /**
+     * @brief Creates a streamed sprite_tiles_ptr which references the given tiles.
+     *
+     * Streamed tiles own a fixed chunk of VRAM tiles that is fed directly from ROM:
+     * when the referenced tiles are changed, the new ones are copied to VRAM in the next VBlank
+     * without searching or allocating VRAM tiles.
+     *
+     * This is meant for very large animations, where allocating a tile set per frame is too expensive.
+     *
+     * Streamed tiles are never shared: find and create methods don't return them,
+     * and multiple streamed sprite_tiles_ptr items can reference the same tiles.
+     *
+     * The tiles are not copied but referenced,
+     * so they should outlive the sprite_tiles_ptr to avoid dangling references.
+     *
+     * @param tiles_item sprite_tiles_item which references the tiles to handle.
+     * It must not be compressed.
+     * @param graphics_index Index of the tile set to reference in sprite_tiles_item.
+     * @return sprite_tiles_ptr which references tiles_item.graphics_tiles_ref(graphics_index).
+     */
+    [[nodiscard]] static sprite_tiles_ptr create_streamed(const sprite_tiles_item& tiles_item, int graphics_index);
+
     /**
      * @brief Creates a sprite_tiles_ptr which references a chunk of VRAM tiles not visible on the screen.
      * @param tiles_count Number of tiles to allocate.
@@ -186,6 +269,91 @@ public:
     [[nodiscard]] static optional<sprite_tiles_ptr> create_new_optional(const sprite_tiles_item& tiles_item,
                                                                         int graphics_index);
 
+    /**
+     * @brief Creates a double buffered sprite_tiles_ptr which references the given tiles.
+     *
+     * Two chunks of VRAM tiles are allocated: when the referenced tiles are changed,
+     * the new ones are uploaded to the chunk not visible on the screen,
+     * and sprites are pointed to it when they are committed to VRAM.
+     *
+     * The sprite tiles system does not support multiple sprite_tiles_ptr items referencing to the same tiles.
+     *
+     * The tiles are not copied but referenced,
+     * so they should outlive the sprite_tiles_ptr to avoid dangling references.
+     *
+     * @param tiles_item sprite_tiles_item which references the tiles to handle.
+     * @return sprite_tiles_ptr which references tiles_item.graphics_tiles_ref() if it could be allocated;
+     * bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<sprite_tiles_ptr> create_new_double_buffered_optional(
+            const sprite_tiles_item& tiles_item);
+
+    /**
+     * @brief Creates a double buffered sprite_tiles_ptr which references the given tiles.
+     *
+     * Two chunks of VRAM tiles are allocated: when the referenced tiles are changed,
+     * the new ones are uploaded to the chunk not visible on the screen,
+     * and sprites are pointed to it when they are committed to VRAM.
+     *
+     * The sprite tiles system does not support multiple sprite_tiles_ptr items referencing to the same tiles.
+     *
+     * The tiles are not copied but referenced,
+     * so they should outlive the sprite_tiles_ptr to avoid dangling references.
+     *
+     * @param tiles_item sprite_tiles_item which references the tiles to handle.
+     * @param graphics_index Index of the tile set to reference in sprite_tiles_item.
+     * @return sprite_tiles_ptr which references tiles_item.graphics_tiles_ref(graphics_index)
+     * if it could be allocated; bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<sprite_tiles_ptr> create_new_double_buffered_optional(
+            const sprite_tiles_item& tiles_item, int graphics_index);
+
+    /**
+     * @brief Creates a streamed sprite_tiles_ptr which references the given tiles.
+     *
+     * Streamed tiles own a fixed chunk of VRAM tiles that is fed directly from ROM:
+     * when the referenced tiles are changed, the new ones are copied to VRAM in the next VBlank
+     * without searching or allocating VRAM tiles.
+     *
+     * This is meant for very large animations, where allocating a tile set per frame is too expensive.
+     *
+     * Streamed tiles are never shared: find and create methods don't return them,
+     * and multiple streamed sprite_tiles_ptr items can reference the same tiles.
+     *
+     * The tiles are not copied but referenced,
+     * so they should outlive the sprite_tiles_ptr to avoid dangling references.
+     *
+     * @param tiles_item sprite_tiles_item which references the tiles to handle.
+     * It must not be compressed.
+     * @return sprite_tiles_ptr which references tiles_item.graphics_tiles_ref() if it could be allocated;
+     * bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<sprite_tiles_ptr> create_streamed_optional(const sprite_tiles_item& tiles_item);
+
+    /**
+     * @brief Creates a streamed sprite_tiles_ptr which references the given tiles.
+     *
+     * Streamed tiles own a fixed chunk of VRAM tiles that is fed directly from ROM:
+     * when the referenced tiles are changed, the new ones are copied to VRAM in the next VBlank
+     * without searching or allocating VRAM tiles.
+     *
+     * This is meant for very large animations, where allocating a tile set per frame is too expensive.
+     *
+     * Streamed tiles are never shared: find and create methods don't return them,
+     * and multiple streamed sprite_tiles_ptr items can reference the same tiles.
+     *
+     * The tiles are not copied but referenced,
+     * so they should outlive the sprite_tiles_ptr to avoid dangling references.
+     *
+     * @param tiles_item sprite_tiles_item which references the tiles to handle.
+     * It must not be compressed.
+     * @param graphics_index Index of the tile set to reference in sprite_tiles_item.
+     * @return sprite_tiles_ptr which references tiles_item.graphics_tiles_ref(graphics_index)
+     * if it could be allocated; bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<sprite_tiles_ptr> create_streamed_optional(const sprite_tiles_item& tiles_item,
+                                                                      int graphics_index);
+
     /**
      * @brief Creates a sprite_tiles_ptr which references a chunk of VRAM tiles not visible on the screen.
      * @param tiles_count Number of tiles to allocate.
@@ -244,6 +412,16 @@ public:
      */
     [[nodiscard]] int tiles_count() const;
 
+    /**
+     * @brief Indicates if the referenced tiles are double buffered or not.
+     */
+    [[nodiscard]] bool double_buffered() const;
+
+    /**
+     * @brief Indicates if the referenced tiles are streamed or not.
+     */
+    [[nodiscard]] bool streamed() const;
+
     /**
      * @brief Returns the compression of the referenced tiles.
      */
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SPSC_QUEUE_H
+#define BN_SPSC_QUEUE_H
+
+/**
+ * @file
+ * bn::spsc_queue implementation header file.
+ *
+ * @ingroup spsc_queue
+ */
+
+#include <new>
+#include "bn_assert.h"
+#include "bn_utility.h"
+#include "bn_power_of_two.h"
+#include "bn_spsc_queue_fwd.h"
+
+namespace bn
+{
+
+/**
+ * @brief Lock-free single producer single consumer queue with a fixed size buffer.
+ *
+ * One side of the queue (for example, an interrupt handler) can push elements
+ * while the other side (for example, the main loop) pops them without disabling interrupts.
+ *
+ * Only the producer can call push methods, and only the consumer can call front, pop and clear methods.
+ *
+ * Since the GBA has only one core, compiler level memory barriers are enough to ensure
+ * that an element is fully written before the consumer can see it and vice versa.
+ *
+ * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+ *
+ * @tparam Type Element type.
+ * @tparam MaxSize Maximum number of elements that can be stored (it must be a power of two).
+ *
+ * @ingroup spsc_queue
+ */
+template<typename Type, int MaxSize>
+class spsc_queue
+{
+    static_assert(MaxSize > 0);
+    static_assert(power_of_two(MaxSize));
+
+public:
+    using value_type = Type; //!< Value type alias.
+    using size_type = int; //!< Size type alias.
+    using reference = Type&; //!< Reference alias.
+    using const_reference = const Type&; //!< Const reference alias.
+
+    /**
+     * @brief Default constructor.
+     */
+    spsc_queue() = default;
+
+    spsc_queue(const spsc_queue& other) = delete;
+
+    spsc_queue& operator=(const spsc_queue& other) = delete;
+
+    /**
+     * @brief Destructor.
+     */
+    ~spsc_queue() noexcept
+    {
+        clear();
+    }
+
+    /**
+     * @brief Returns the current number of elements.
+     */
+    [[nodiscard]] size_type size() const
+    {
+        return size_type(_head - _tail);
+    }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     */
+    [[nodiscard]] constexpr size_type max_size() const
+    {
+        return MaxSize;
+    }
+
+    /**
+     * @brief Returns the remaining element capacity.
+     */
+    [[nodiscard]] size_type available() const
+    {
+        return MaxSize - size();
+    }
+
+    /**
+     * @brief Indicates if it doesn't contain any element.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _head == _tail;
+    }
+
+    /**
+     * @brief Indicates if it can't contain any more elements.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return size() == MaxSize;
+    }
+
+    /**
+     * @brief Returns a const reference to the oldest element.
+     *
+     * It can be called by the consumer only.
+     */
+    [[nodiscard]] const_reference front() const
+    {
+        return const_cast<spsc_queue&>(*this).front();
+    }
+
+    /**
+     * @brief Returns a reference to the oldest element.
+     *
+     * It can be called by the consumer only.
+     */
+    [[nodiscard]] reference front()
+    {
+        BN_ASSERT(! empty(), "Queue is empty");
+
+        _barrier();
+        return *_element_ptr(_tail);
+    }
+
+    /**
+     * @brief Inserts a copy of the given value at the end of the queue.
+     *
+     * It can be called by the producer only.
+     *
+     * @param value Value to insert.
+     * @return `true` if the value was inserted, `false` if the queue is full.
+     */
+    bool push(const_reference value)
+    {
+        return emplace(value);
+    }
+
+    /**
+     * @brief Inserts a moved value at the end of the queue.
+     *
+     * It can be called by the producer only.
+     *
+     * @param value Value to insert.
+     * @return `true` if the value was inserted, `false` if the queue is full.
+     */
+    bool push(value_type&& value)
+    {
+        return emplace(move(value));
+    }
+
+    /**
+     * @brief Constructs and inserts a value at the end of the queue.
+     *
+     * It can be called by the producer only.
+     *
+     * @param args Parameters of the value to insert.
+     * @return `true` if the value was inserted, `false` if the queue is full.
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args)
+    {
+        unsigned head = _head;
+
+        if(head - _tail == unsigned(MaxSize))
+        {
+            return false;
+        }
+
+        ::new(_element_ptr(head)) Type(forward<Args>(args)...);
+        _barrier();
+        _head = head + 1;
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element.
+     *
+     * It can be called by the consumer only.
+     */
+    void pop()
+    {
+        BN_ASSERT(! empty(), "Queue is empty");
+
+        unsigned tail = _tail;
+        _element_ptr(tail)->~Type();
+        _barrier();
+        _tail = tail + 1;
+    }
+
+    /**
+     * @brief Moves the oldest element to the given output parameter and removes it from the queue.
+     *
+     * It can be called by the consumer only.
+     *
+     * @param value Output parameter.
+     * @return `true` if an element was removed, `false` if the queue is empty.
+     */
+    bool pop(reference value)
+    {
+        unsigned tail = _tail;
+
+        if(tail == _head)
+        {
+            return false;
+        }
+
+        _barrier();
+
+        Type* element_ptr = _element_ptr(tail);
+        value = move(*element_ptr);
+        element_ptr->~Type();
+        _barrier();
+        _tail = tail + 1;
+        return true;
+    }
+
+    /**
+     * @brief Removes all elements.
+     *
+     * It can be called by the consumer only.
+     *
+     * Elements pushed by the producer while this method is running are not removed.
+     */
+    void clear()
+    {
+        unsigned tail = _tail;
+        unsigned head = _head;
+        _barrier();
+
+        while(tail != head)
+        {
+            _element_ptr(tail)->~Type();
+            ++tail;
+        }
+
+        _barrier();
+        _tail = tail;
+    }
+
+private:
+    alignas(Type) char _storage_buffer[sizeof(Type) * MaxSize];
+    volatile unsigned _head = 0;
+    volatile unsigned _tail = 0;
+
+    static void _barrier()
+    {
+        asm volatile("" ::: "memory");
+    }
+
+    [[nodiscard]] Type* _element_ptr(unsigned index)
+    {
+        return reinterpret_cast<Type*>(_storage_buffer) + (index & unsigned(MaxSize - 1));
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SPSC_QUEUE_FWD_H
+#define BN_SPSC_QUEUE_FWD_H
+
+/**
+ * @file
+ * bn::spsc_queue declaration header file.
+ *
+ * @ingroup spsc_queue
+ */
+
+#include "bn_common.h"
+
+namespace bn
+{
+    /**
+     * @brief Lock-free single producer single consumer queue with a fixed size buffer.
+     *
+     * One side of the queue (for example, an interrupt handler) can push elements
+     * while the other side (for example, the main loop) pops them without disabling interrupts.
+     *
+     * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
+     *
+     * @tparam Type Element type.
+     * @tparam MaxSize Maximum number of elements that can be stored (it must be a power of two).
+     *
+     * @ingroup spsc_queue
+     */
+    template<typename Type, int MaxSize>
+    class spsc_queue;
+}
+
+#endif
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_TILE_COLLISION_MAP_H
+#define BN_TILE_COLLISION_MAP_H
+
+/**
+ * @file
+ * bn::tile_collision_map header file.
+ *
+ * @ingroup tile_collision_map
+ * @ingroup tool
+ */
+
+#include "bn_size.h"
+#include "bn_point.h"
+#include "bn_optional.h"
+
+namespace bn
+{
+
+class rect;
+
+/**
+ * @brief Grid of 8x8 pixels cells which indicates which parts of a level are solid.
+ *
+ * Solid cells are stored in bits, one row and one column per group of 32-bit words,
+ * so collision queries can test 32 cells at once.
+ *
+ * Optionally, each cell can also store a 4-bit value (a tile type, for example).
+ *
+ * The assets conversion tools generate an object of this type in the build folder for each *.bmp file
+ * with `tile_collision_map` type.
+ *
+ * The referenced data is not copied, so it should outlive the tile_collision_map to avoid dangling references.
+ *
+ * Unless otherwise specified, queries treat the cells outside of the map as empty.
+ *
+ * @ingroup tile_collision_map
+ * @ingroup tool
+ */
+class tile_collision_map
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param solid_rows_ref Reference to the solid bits of each row of cells.
+     *
+     * Each row starts at a new 32-bit word, and the least significant bit of each word is the leftmost cell.
+     *
+     * @param solid_columns_ref Reference to the solid bits of each column of cells.
+     *
+     * Each column starts at a new 32-bit word, and the least significant bit of each word is the topmost cell.
+     *
+     * @param dimensions Size in cells of the referenced data.
+     */
+    constexpr tile_collision_map(const uint32_t& solid_rows_ref, const uint32_t& solid_columns_ref,
+                                 const size& dimensions) :
+        _solid_rows_ptr(&solid_rows_ref),
+        _solid_columns_ptr(&solid_columns_ref),
+        _values_ptr(nullptr),
+        _dimensions(dimensions)
+    {
+        BN_ASSERT(dimensions.width() > 0, "Invalid width: ", dimensions.width());
+        BN_ASSERT(dimensions.height() > 0, "Invalid height: ", dimensions.height());
+    }
+
+    /**
+     * @brief Constructor.
+     * @param solid_rows_ref Reference to the solid bits of each row of cells.
+     *
+     * Each row starts at a new 32-bit word, and the least significant bit of each word is the leftmost cell.
+     *
+     * @param solid_columns_ref Reference to the solid bits of each column of cells.
+     *
+     * Each column starts at a new 32-bit word, and the least significant bit of each word is the topmost cell.
+     *
+     * @param values_ref Reference to the 4-bit value of each cell.
+     *
+     * Each row starts at a new 32-bit word, and the least significant nibble of each word is the leftmost cell.
+     *
+     * @param dimensions Size in cells of the referenced data.
+     */
+    constexpr tile_collision_map(const uint32_t& solid_rows_ref, const uint32_t& solid_columns_ref,
+                                 const uint32_t& values_ref, const size& dimensions) :
+        _solid_rows_ptr(&solid_rows_ref),
+        _solid_columns_ptr(&solid_columns_ref),
+        _values_ptr(&values_ref),
+        _dimensions(dimensions)
+    {
+        BN_ASSERT(dimensions.width() > 0, "Invalid width: ", dimensions.width());
+        BN_ASSERT(dimensions.height() > 0, "Invalid height: ", dimensions.height());
+    }
+
+    /**
+     * @brief Returns the size in cells of the referenced data.
+     */
+    [[nodiscard]] constexpr const size& dimensions() const
+    {
+        return _dimensions;
+    }
+
+    /**
+     * @brief Indicates if each cell stores a 4-bit value or not.
+     */
+    [[nodiscard]] constexpr bool has_values() const
+    {
+        return _values_ptr;
+    }
+
+    /**
+     * @brief Indicates if the specified cell is solid or not.
+     * @param x Horizontal cell position.
+     * @param y Vertical cell position.
+     * @return `true` if the specified cell is inside the map and it is solid; `false` otherwise.
+     */
+    [[nodiscard]] constexpr bool solid(int x, int y) const
+    {
+        if(x < 0 || y < 0 || x >= _dimensions.width() || y >= _dimensions.height())
+        {
+            return false;
+        }
+
+        uint32_t word = _solid_rows_ptr[(y * _row_words()) + (x / 32)];
+        return (word >> (x % 32)) & 1;
+    }
+
+    /**
+     * @brief Returns the value of the specified cell.
+     * @param x Horizontal cell position.
+     * @param y Vertical cell position.
+     * @return 4-bit value of the specified cell if each cell stores a value;
+     * otherwise 1 if the specified cell is solid or 0 if it is empty.
+     */
+    [[nodiscard]] constexpr int cell(int x, int y) const
+    {
+        int width = _dimensions.width();
+        int height = _dimensions.height();
+        BN_ASSERT(x >= 0 && x < width, "Invalid x: ", x, " - ", width);
+        BN_ASSERT(y >= 0 && y < height, "Invalid y: ", y, " - ", height);
+
+        if(! _values_ptr)
+        {
+            return solid(x, y);
+        }
+
+        uint32_t word = _values_ptr[(y * ((width + 7) / 8)) + (x / 8)];
+        return int((word >> ((x % 8) * 4)) & 0xF);
+    }
+
+    /**
+     * @brief Indicates if any cell of the specified area is solid or not.
+     * @param x Horizontal position of the top-left cell of the area.
+     * @param y Vertical position of the top-left cell of the area.
+     * @param width Area width in cells.
+     * @param height Area height in cells.
+     * @return `true` if any cell of the specified area is solid; `false` otherwise.
+     */
+    [[nodiscard]] bool any_solid(int x, int y, int width, int height) const;
+
+    /**
+     * @brief Searches the leftmost solid cell of the given row.
+     * @param y Row to search.
+     * @param first_x First column of the search range.
+     * @param last_x Last column of the search range (inclusive).
+     * @return Column of the leftmost solid cell in the search range if any; -1 otherwise.
+     */
+    [[nodiscard]] int first_solid_in_row(int y, int first_x, int last_x) const;
+
+    /**
+     * @brief Searches the rightmost solid cell of the given row.
+     * @param y Row to search.
+     * @param first_x First column of the search range.
+     * @param last_x Last column of the search range (inclusive).
+     * @return Column of the rightmost solid cell in the search range if any; -1 otherwise.
+     */
+    [[nodiscard]] int last_solid_in_row(int y, int first_x, int last_x) const;
+
+    /**
+     * @brief Searches the topmost solid cell of the given column.
+     * @param x Column to search.
+     * @param first_y First row of the search range.
+     * @param last_y Last row of the search range (inclusive).
+     * @return Row of the topmost solid cell in the search range if any; -1 otherwise.
+     */
+    [[nodiscard]] int first_solid_in_column(int x, int first_y, int last_y) const;
+
+    /**
+     * @brief Searches the bottommost solid cell of the given column.
+     * @param x Column to search.
+     * @param first_y First row of the search range.
+     * @param last_y Last row of the search range (inclusive).
+     * @return Row of the bottommost solid cell in the search range if any; -1 otherwise.
+     */
+    [[nodiscard]] int last_solid_in_column(int x, int first_y, int last_y) const;
+
+    /**
+     * @brief Moves the given rectangle horizontally until it touches a solid cell.
+     * @param rect Rectangle in map pixels, which shouldn't overlap any solid cell.
+     * @param delta_x Horizontal movement in pixels.
+     * @return Horizontal movement in pixels which can be applied to the given rectangle
+     * without overlapping any solid cell.
+     */
+    [[nodiscard]] int sweep_x(const rect& rect, int delta_x) const;
+
+    /**
+     * @brief Moves the given rectangle vertically until it touches a solid cell.
+     * @param rect Rectangle in map pixels, which shouldn't overlap any solid cell.
+     * @param delta_y Vertical movement in pixels.
+     * @return Vertical movement in pixels which can be applied to the given rectangle
+     * without overlapping any solid cell.
+     */
+    [[nodiscard]] int sweep_y(const rect& rect, int delta_y) const;
+
+    /**
+     * @brief Searches the first solid cell crossed by a segment.
+     *
+     * The segment goes from the center of the start pixel to the center of the end pixel.
+     * If it crosses a cell corner, the vertically adjacent cell is tested before the diagonal one,
+     * so it can't pass between two diagonally adjacent solid cells.
+     *
+     * @param from Start position of the segment in map pixels.
+     * @param to End position of the segment in map pixels.
+     * @return Position in cells (not in pixels) of the first solid cell crossed by the given segment if any;
+     * bn::nullopt otherwise.
+     */
+    [[nodiscard]] optional<point> raycast(const point& from, const point& to) const;
+
+    /**
+     * @brief Default equal operator.
+     */
+    [[nodiscard]] constexpr friend bool operator==(const tile_collision_map& a,
+                                                   const tile_collision_map& b) = default;
+
+private:
+    const uint32_t* _solid_rows_ptr;
+    const uint32_t* _solid_columns_ptr;
+    const uint32_t* _values_ptr;
+    size _dimensions;
+
+    [[nodiscard]] constexpr int _row_words() const
+    {
+        return (_dimensions.width() + 31) / 32;
+    }
+
+    [[nodiscard]] constexpr int _column_words() const
+    {
+        return (_dimensions.height() + 31) / 32;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_TLSF_ALLOCATOR_H
+#define BN_TLSF_ALLOCATOR_H
+
+/**
+ * @file
+ * bn::tlsf_allocator header file.
+ *
+ * @ingroup allocator
+ */
+
+#include "bn_config_log.h"
+#include "bn_allocator_stats.h"
+#include "bn_config_doxygen.h"
+
+namespace bn
+{
+
+/**
+ * @brief Manages a chunk of memory with a two-level segregated fit (TLSF) allocation strategy.
+ *
+ * Unlike bn::best_fit_allocator, allocation and release are O(1) operations,
+ * so their cost doesn't grow with the number of allocated items.
+ *
+ * @ingroup allocator
+ */
+class tlsf_allocator
+{
+
+public:
+    using size_type = int; //!< Size type alias.
+
+    /**
+     * @brief Default constructor.
+     */
+    tlsf_allocator() = default;
+
+    /**
+     * @brief Constructor.
+     * @param start Pointer to the first element of the memory to manage.
+     * @param bytes Size in bytes of the memory to manage.
+     */
+    tlsf_allocator(void* start, size_type bytes)
+    {
+        reset(start, bytes);
+    }
+
+    tlsf_allocator(const tlsf_allocator&) = delete;
+
+    tlsf_allocator& operator=(const tlsf_allocator&) = delete;
+
+    /**
+     * @brief Destructor.
+     *
+     * It doesn't destroy its elements, they must be destroyed manually.
+     */
+    ~tlsf_allocator() noexcept;
+
+    /**
+     * @brief Returns the maximum size in bytes of the memory that can be managed.
+     */
+    [[nodiscard]] constexpr static size_type max_bytes()
+    {
+        return _max_block_size - 1;
+    }
+
+    /**
+     * @brief Returns the size in bytes of all allocated items.
+     */
+    [[nodiscard]] size_type used_bytes() const
+    {
+        return _total_bytes_count - _free_bytes_count;
+    }
+
+    /**
+     * @brief Returns the number of bytes that still can be allocated.
+     */
+    [[nodiscard]] size_type available_bytes() const
+    {
+        return _free_bytes_count;
+    }
+
+    /**
+     * @brief Indicates if it doesn't contain any item.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return used_bytes() == 0;
+    }
+
+    /**
+     * @brief Indicates if it can't contain any more items.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return available_bytes() == 0;
+    }
+
+    /**
+     * @brief Returns usage and fragmentation statistics.
+     *
+     * Fragmentation statistics are calculated by iterating all items, so this method is not fast.
+     */
+    [[nodiscard]] allocator_stats stats() const;
+
+    /**
+     * @brief Allocates uninitialized storage.
+     * @param bytes Bytes to allocate.
+     * @return On success, returns the pointer to the beginning of newly allocated memory.
+     * On failure, returns `nullptr`.
+     *
+     * To avoid a memory leak, the returned pointer must be deallocated with free.
+     */
+    [[nodiscard]] void* alloc(size_type bytes);
+
+    /**
+     * @brief Allocates storage for an array of num objects of bytes size
+     * and initializes all bytes in it to zero.
+     * @param num Number of objects.
+     * @param bytes Size in bytes of each object.
+     * @return On success, returns the pointer to the beginning of newly allocated memory.
+     * On failure, returns `nullptr`.
+     *
+     * To avoid a memory leak, the returned pointer must be deallocated with free.
+     */
+    [[nodiscard]] void* calloc(size_type num, size_type bytes);
+
+    /**
+     * @brief Reallocates the given storage.
+     * @param ptr Pointer to the storage to reallocate.
+     *
+     * If ptr was not previously allocated by alloc, calloc or realloc, the behavior is undefined.
+     *
+     * @param new_bytes New size in bytes of the reallocated storage.
+     * @return On success, returns the pointer to the beginning of newly allocated storage.
+     * On failure, returns `nullptr`.
+     *
+     * On success, the original pointer ptr is invalidated and any access to it is undefined behavior
+     * (even if reallocation was in-place).
+     *
+     * To avoid a memory leak, the returned pointer must be deallocated with free.
+     */
+    [[nodiscard]] void* realloc(void* ptr, size_type new_bytes);
+
+    /**
+     * @brief Deallocates the storage previously allocated by alloc, calloc or realloc.
+     * @param ptr Pointer to the storage to deallocate.
+     * It is invalidated and any access to it is undefined behavior.
+     *
+     * If ptr is `nullptr`, the function does nothing.
+     *
+     * If ptr was not previously allocated by alloc, calloc or realloc, the behavior is undefined.
+     */
+    void free(void* ptr);
+
+    /**
+     * @brief Constructs a value inside of the allocator.
+     * @param args Parameters of the value to construct.
+     * @return Reference to the new value.
+     */
+    template<typename Type, typename... Args>
+    [[nodiscard]] Type& create(Args&&... args)
+    {
+        auto result = reinterpret_cast<Type*>(alloc(sizeof(Type)));
+        BN_ASSERT(result, "Allocation failed");
+
+        ::new(result) Type(forward<Args>(args)...);
+        return *result;
+    }
+
+    /**
+     * @brief Destroys the given value, previously allocated with the create method.
+     */
+    template<typename Type>
+    void destroy(Type& value)
+    {
+        value.~Type();
+        free(&value);
+    }
+
+    /**
+     * @brief Setups the allocator to manage a new chunk of memory.
+     * @param start Pointer to the first element of the memory to manage.
+     * @param bytes Size in bytes of the memory to manage.
+     */
+    void reset(void* start, size_type bytes);
+
+    #if BN_CFG_LOG_ENABLED || BN_DOXYGEN
+        /**
+         * @brief Logs the current status of the allocator.
+         */
+        void log_status() const;
+    #endif
+
+private:
+    class item_type
+    {
+
+    public:
+        item_type* previous = nullptr;
+        size_type size: 30 = 0;
+        bool used: 1 = false;
+
+        // Only valid if the item is not used:
+        item_type* next_free = nullptr;
+        item_type* previous_free = nullptr;
+
+        [[nodiscard]] const item_type* next() const
+        {
+            const uint8_t* next_ptr = reinterpret_cast<const uint8_t*>(this) + size;
+            return reinterpret_cast<const item_type*>(next_ptr);
+        }
+
+        [[nodiscard]] item_type* next()
+        {
+            uint8_t* next_ptr = reinterpret_cast<uint8_t*>(this) + size;
+            return reinterpret_cast<item_type*>(next_ptr);
+        }
+    };
+
+    static constexpr size_type _sizeof_header = sizeof(item_type) - (sizeof(item_type*) * 2);
+    static constexpr size_type _min_item_size = sizeof(item_type);
+    static constexpr int _second_level_count_log2 = 4;
+    static constexpr int _second_level_count = 1 << _second_level_count_log2;
+    static constexpr int _first_level_shift = _second_level_count_log2 + 2;
+    static constexpr int _first_level_max = 19;
+    static constexpr int _first_level_count = _first_level_max - _first_level_shift + 1;
+    static constexpr size_type _small_item_size = 1 << _first_level_shift;
+    static constexpr size_type _max_block_size = 1 << _first_level_max;
+
+    uint8_t* _start_ptr = nullptr;
+    size_type _total_bytes_count = 0;
+    size_type _free_bytes_count = 0;
+    allocator_stats _stats;
+    unsigned _first_level_bitmap = 0;
+    uint16_t _second_level_bitmaps[_first_level_count] = {};
+    item_type* _free_items[_first_level_count][_second_level_count] = {};
+
+    [[nodiscard]] const item_type* _begin_item() const
+    {
+        return reinterpret_cast<const item_type*>(_start_ptr);
+    }
+
+    [[nodiscard]] item_type* _begin_item()
+    {
+        return reinterpret_cast<item_type*>(_start_ptr);
+    }
+
+    [[nodiscard]] const item_type* _end_item() const
+    {
+        return reinterpret_cast<const item_type*>(_start_ptr + _total_bytes_count);
+    }
+
+    [[nodiscard]] item_type* _end_item()
+    {
+        return reinterpret_cast<item_type*>(_start_ptr + _total_bytes_count);
+    }
+
+    [[nodiscard]] void* _alloc(size_type bytes);
+
+    static void _list_indexes(size_type size, int& first_level_index, int& second_level_index);
+
+    void _insert_free_item(item_type* item);
+
+    void _erase_free_item(item_type* item);
+
+    [[nodiscard]] item_type* _suitable_free_item(size_type bytes);
+};
+
+}
+
+#endif
@@ -17,7 +17,9 @@
 #include "bn_memory.h"
 #include "bn_iterator.h"
 #include "bn_algorithm.h"
+#include "bn_limits.h"
 #include "bn_power_of_two.h"
+#include "bn_config_unordered_containers.h"
 #include "bn_unordered_map_fwd.h"
 
 namespace bn
@@ -71,8 +73,14 @@ public:
         iterator& operator++()
         {
             size_type index = _index;
-            size_type last_valid_index = _map->_last_valid_index;
-            const bool* allocated = _map->_allocated;
+
+            #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+                size_type last_valid_index = min(_map->_last_valid_index, _last_index);
+            #else
+                size_type last_valid_index = _map->_last_valid_index;
+            #endif
+
+            const uint8_t* allocated = _map->_allocated;
             ++index;
 
             while(index <= last_valid_index && ! allocated[index])
@@ -97,7 +105,7 @@ public:
         {
             int index = _index;
             int first_valid_index = _map->_first_valid_index;
-            const bool* allocated = _map->_allocated;
+            const uint8_t* allocated = _map->_allocated;
             --index;
 
             while(index >= first_valid_index && ! allocated[index])
@@ -169,11 +177,29 @@ public:
         size_type _index;
         iunordered_map* _map;
 
+        #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+            // Elements after this index have already been visited
+            // (backward shift deletion can move them from the start of the storage to its end):
+            size_type _last_index;
+        #endif
+
         iterator(size_type index, iunordered_map& map) :
             _index(index),
             _map(&map)
         {
+            #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+                _last_index = map._max_size_minus_one;
+            #endif
         }
+
+        #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+            iterator(size_type index, size_type last_index, iunordered_map& map) :
+                _index(index),
+                _map(&map),
+                _last_index(last_index)
+            {
+            }
+        #endif
     };
 
     /**
@@ -207,6 +233,9 @@ public:
             _index(it._index),
             _map(it._map)
         {
+            #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+                _last_index = it._last_index;
+            #endif
         }
 
         /**
@@ -216,8 +245,14 @@ public:
         const_iterator& operator++()
         {
             size_type index = _index;
-            size_type last_valid_index = _map->_last_valid_index;
-            const bool* allocated = _map->_allocated;
+
+            #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+                size_type last_valid_index = min(_map->_last_valid_index, _last_index);
+            #else
+                size_type last_valid_index = _map->_last_valid_index;
+            #endif
+
+            const uint8_t* allocated = _map->_allocated;
             ++index;
 
             while(index <= last_valid_index && ! allocated[index])
@@ -242,7 +277,7 @@ public:
         {
             int index = _index;
             int first_valid_index = _map->_first_valid_index;
-            const bool* allocated = _map->_allocated;
+            const uint8_t* allocated = _map->_allocated;
             --index;
 
             while(index >= first_valid_index && ! allocated[index])
@@ -299,10 +334,17 @@ public:
         size_type _index;
         const iunordered_map* _map;
 
+        #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+            size_type _last_index;
+        #endif
+
         const_iterator(size_type index, const iunordered_map& map) :
             _index(index),
             _map(&map)
         {
+            #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+                _last_index = map._max_size_minus_one;
+            #endif
         }
     };
 
@@ -583,22 +625,40 @@ public:
         }
 
         const_pointer storage = _storage;
-        const bool* allocated = _allocated;
+        const uint8_t* allocated = _allocated;
         key_equal key_equal_functor;
         size_type index = _index(key_hash);
-        size_type max_size = _max_size_minus_one + 1;
-        size_type its = 0;
 
-        while(its < max_size && allocated[index])
-        {
-            if(key_equal_functor(key, storage[index].first))
+        #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+            // Elements are sorted by probe distance,
+            // so the search can stop when an element nearer to its ideal position is found:
+            int probe_distance = 1;
+
+            while(allocated[index] >= probe_distance)
             {
-                return iterator(index, *this);
+                if(allocated[index] == probe_distance && key_equal_functor(key, storage[index].first))
+                {
+                    return iterator(index, *this);
+                }
+
+                index = _index(index + 1);
+                ++probe_distance;
             }
+        #else
+            size_type max_size = _max_size_minus_one + 1;
+            size_type its = 0;
 
-            index = _index(index + 1);
-            ++its;
-        }
+            while(its < max_size && allocated[index])
+            {
+                if(key_equal_functor(key, storage[index].first))
+                {
+                    return iterator(index, *this);
+                }
+
+                index = _index(index + 1);
+                ++its;
+            }
+        #endif
 
         return end();
     }
@@ -709,29 +769,56 @@ public:
      */
     iterator insert_hash(hash_type key_hash, value_type&& value)
     {
+        // Maps without storage (like an empty bn::dynamic_unordered_map) can't be probed:
+        BN_ASSERT(max_size(), "Map without storage");
+
         size_type index = _index(key_hash);
         pointer storage = _storage;
-        bool* allocated = _allocated;
+        uint8_t* allocated = _allocated;
         key_equal key_equal_functor;
-        size_type current_index = index;
 
-        while(allocated[current_index])
-        {
-            if(key_equal_functor(value.first, storage[current_index].first))
+        #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+            int probe_distance = 1;
+
+            while(allocated[index] >= probe_distance)
             {
-                return end();
+                if(allocated[index] == probe_distance && key_equal_functor(value.first, storage[index].first))
+                {
+                    return end();
+                }
+
+                index = _index(index + 1);
+                ++probe_distance;
             }
 
-            current_index = _index(current_index + 1);
-            BN_ASSERT(current_index != index, "All indices are allocated");
-        }
+            BN_ASSERT(! full(), "All indices are allocated");
+
+            size_type last_index = _robin_hood_insert(index, probe_distance, move(value));
+            _first_valid_index = min(_first_valid_index, last_index);
+            _last_valid_index = max(_last_valid_index, last_index);
+            ++_size;
+            return iterator(index, *this);
+        #else
+            size_type current_index = index;
 
-        ::new(storage + current_index) value_type(move(value));
-        allocated[current_index] = true;
-        _first_valid_index = min(_first_valid_index, current_index);
-        _last_valid_index = max(_last_valid_index, current_index);
-        ++_size;
-        return iterator(current_index, *this);
+            while(allocated[current_index])
+            {
+                if(key_equal_functor(value.first, storage[current_index].first))
+                {
+                    return end();
+                }
+
+                current_index = _index(current_index + 1);
+                BN_ASSERT(current_index != index, "All indices are allocated");
+            }
+
+            ::new(storage + current_index) value_type(move(value));
+            allocated[current_index] = 1;
+            _first_valid_index = min(_first_valid_index, current_index);
+            _last_valid_index = max(_last_valid_index, current_index);
+            ++_size;
+            return iterator(current_index, *this);
+        #endif
     }
 
     /**
@@ -921,74 +1008,94 @@ public:
      */
     iterator erase(const const_iterator& position)
     {
-        bool* allocated = _allocated;
+        uint8_t* allocated = _allocated;
         size_type index = position._index;
         BN_ASSERT(allocated[index], "Index is not allocated: ", index);
 
-        pointer storage = _storage;
-        storage[index].~value_type();
-        allocated[index] = false;
-        --_size;
-
-        if(! _size)
-        {
-            _first_valid_index = max_size();
-            _last_valid_index = 0;
-            return end();
-        }
+        #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+            size_type last_index = position._last_index;
 
-        size_type first_valid_index = _first_valid_index;
+            if(_robin_hood_erase_moved_to_last_index(index, last_index))
+            {
+                --last_index;
+            }
 
-        if(index == first_valid_index)
-        {
-            while(! allocated[first_valid_index])
+            if(! _size)
             {
-                ++first_valid_index;
+                return end();
             }
 
-            _first_valid_index = first_valid_index;
-        }
+            size_type last_valid_index = min(_last_valid_index, last_index);
+        #else
+            pointer storage = _storage;
+            storage[index].~value_type();
+            allocated[index] = 0;
+            --_size;
 
-        size_type last_valid_index = _last_valid_index;
+            if(! _size)
+            {
+                _first_valid_index = max_size();
+                _last_valid_index = 0;
+                return end();
+            }
 
-        if(index == last_valid_index)
-        {
-            while(! allocated[last_valid_index])
+            size_type first_valid_index = _first_valid_index;
+
+            if(index == first_valid_index)
             {
-                --last_valid_index;
+                while(! allocated[first_valid_index])
+                {
+                    ++first_valid_index;
+                }
+
+                _first_valid_index = first_valid_index;
             }
 
-            _last_valid_index = last_valid_index;
-        }
+            size_type last_valid_index = _last_valid_index;
+
+            if(index == last_valid_index)
+            {
+                while(! allocated[last_valid_index])
+                {
+                    --last_valid_index;
+                }
 
-        size_type next_index = _index(index + 1);
-        int reinsert_count = 0;
+                _last_valid_index = last_valid_index;
+            }
 
-        while(allocated[next_index])
-        {
-            ++reinsert_count;
-            next_index = _index(next_index + 1);
-        }
+            size_type next_index = _index(index + 1);
+            int reinsert_count = 0;
 
-        next_index = _index(index + 1);
-        _size -= reinsert_count;
+            while(allocated[next_index])
+            {
+                ++reinsert_count;
+                next_index = _index(next_index + 1);
+            }
 
-        for(int reinsert_index = 0; reinsert_index < reinsert_count; ++reinsert_index)
-        {
-            value_type temp_value(move(storage[next_index]));
-            storage[next_index].~value_type();
-            allocated[next_index] = false;
-            insert(move(temp_value));
-            next_index = _index(next_index + 1);
-        }
+            next_index = _index(index + 1);
+            _size -= reinsert_count;
+
+            for(int reinsert_index = 0; reinsert_index < reinsert_count; ++reinsert_index)
+            {
+                value_type temp_value(move(storage[next_index]));
+                storage[next_index].~value_type();
+                allocated[next_index] = 0;
+                insert(move(temp_value));
+                next_index = _index(next_index + 1);
+            }
 
-        last_valid_index = _last_valid_index;
+            last_valid_index = _last_valid_index;
+        #endif
 
         while(index <= last_valid_index)
         {
             if(allocated[index])
             {
-                return iterator(index, *this);
+                #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+                    return iterator(index, last_index, *this);
+                #else
+                    return iterator(index, *this);
+                #endif
             }
 
             ++index;
@@ -1044,33 +1151,59 @@ public:
     template<class Pred>
     friend size_type erase_if(iunordered_map& map, const Pred& pred)
     {
-        size_type erased_count = 0;
-        pointer storage = map._storage;
-        bool* allocated = map._allocated;
-        size_type first_valid_index = map.max_size();
-        size_type last_valid_index = 0;
+        #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+            size_type erased_count = 0;
+            size_type index = map._first_valid_index;
+            size_type last_index = map._max_size_minus_one;
 
-        for(size_type index = map._first_valid_index, last = map._last_valid_index; index <= last; ++index)
-        {
-            if(allocated[index])
+            while(index <= min(map._last_valid_index, last_index))
             {
-                if(allocated[index] && pred(storage[index]))
+                if(map._allocated[index] && pred(map._storage[index]))
                 {
-                    storage[index].~value_type();
-                    allocated[index] = false;
+                    // Backward shift deletion can move the next element to this index, so it must be checked again,
+                    // and an already checked element to the last index, so it must be skipped:
+                    if(map._robin_hood_erase_moved_to_last_index(index, last_index))
+                    {
+                        --last_index;
+                    }
+
                     ++erased_count;
                 }
                 else
                 {
-                    first_valid_index = min(index, first_valid_index);
-                    last_valid_index = max(index, last_valid_index);
+                    ++index;
                 }
             }
-        }
+        #else
+            size_type erased_count = 0;
+            pointer storage = map._storage;
+            uint8_t* allocated = map._allocated;
+            size_type first_valid_index = map.max_size();
+            size_type last_valid_index = 0;
+
+            for(size_type index = map._first_valid_index, last = map._last_valid_index; index <= last; ++index)
+            {
+                if(allocated[index])
+                {
+                    if(allocated[index] && pred(storage[index]))
+                    {
+                        storage[index].~value_type();
+                        allocated[index] = 0;
+                        ++erased_count;
+                    }
+                    else
+                    {
+                        first_valid_index = min(index, first_valid_index);
+                        last_valid_index = max(index, last_valid_index);
+                    }
+                }
+            }
+
+            map._size -= erased_count;
+            map._first_valid_index = first_valid_index;
+            map._last_valid_index = last_valid_index;
+        #endif
 
-        map._size -= erased_count;
-        map._first_valid_index = first_valid_index;
-        map._last_valid_index = last_valid_index;
         return erased_count;
     }
 
@@ -1086,33 +1219,42 @@ public:
             BN_ASSERT(_max_size_minus_one == other._max_size_minus_one,
                        "Invalid max size: ", max_size(), " - ", other.max_size());
 
-            pointer storage = _storage;
-            pointer other_storage = other._storage;
-            bool* allocated = _allocated;
-            bool* other_allocated = other._allocated;
-            size_type size = _size;
-            size_type first_valid_index = min(_first_valid_index, other._first_valid_index);
-            size_type last_valid_index = max(_last_valid_index, other._last_valid_index);
-
-            for(size_type index = first_valid_index; index <= last_valid_index; ++index)
-            {
-                if(other_allocated[index])
+            #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+                // Elements can't be moved by index, since their positions depend on insertion order:
+                for(value_type& value : other)
                 {
-                    if(allocated[index])
-                    {
-                        storage[index] = move(other_storage[index]);
-                    }
-                    else
+                    insert_or_assign_hash(hasher()(value.first), move(value));
+                }
+            #else
+                pointer storage = _storage;
+                pointer other_storage = other._storage;
+                uint8_t* allocated = _allocated;
+                uint8_t* other_allocated = other._allocated;
+                size_type size = _size;
+                size_type first_valid_index = min(_first_valid_index, other._first_valid_index);
+                size_type last_valid_index = max(_last_valid_index, other._last_valid_index);
+
+                for(size_type index = first_valid_index; index <= last_valid_index; ++index)
+                {
+                    if(other_allocated[index])
                     {
-                        ::new(storage + index) value_type(move(other_storage[index]));
-                        ++size;
+                        if(allocated[index])
+                        {
+                            storage[index] = move(other_storage[index]);
+                        }
+                        else
+                        {
+                            ::new(storage + index) value_type(move(other_storage[index]));
+                            ++size;
+                        }
                     }
                 }
-            }
 
-            _size = size;
-            _first_valid_index = first_valid_index;
-            _last_valid_index = last_valid_index;
+                _size = size;
+                _first_valid_index = first_valid_index;
+                _last_valid_index = last_valid_index;
+            #endif
+
             other.clear();
         }
     }
@@ -1141,7 +1283,7 @@ public:
         if(_size)
         {
             pointer storage = _storage;
-            bool* allocated = _allocated;
+            uint8_t* allocated = _allocated;
             size_type first_valid_index = _first_valid_index;
             size_type last_valid_index = _last_valid_index;
 
@@ -1219,8 +1361,8 @@ public:
 
             pointer storage = _storage;
             pointer other_storage = other._storage;
-            bool* allocated = _allocated;
-            bool* other_allocated = other._allocated;
+            uint8_t* allocated = _allocated;
+            uint8_t* other_allocated = other._allocated;
             size_type first_valid_index = min(_first_valid_index, other._first_valid_index);
             size_type last_valid_index = max(_last_valid_index, other._last_valid_index);
 
@@ -1231,13 +1373,14 @@ public:
                     if(allocated[index])
                     {
                         bn::swap(storage[index], other_storage[index]);
+                        bn::swap(allocated[index], other_allocated[index]);
                     }
                     else
                     {
                         ::new(storage + index) value_type(move(other_storage[index]));
                         other_storage[index].~value_type();
-                        other_allocated[index] = false;
-                        allocated[index] = true;
+                        allocated[index] = other_allocated[index];
+                        other_allocated[index] = 0;
                     }
                 }
                 else
@@ -1246,8 +1389,8 @@ public:
                     {
                         ::new(other_storage + index) value_type(move(storage[index]));
                         storage[index].~value_type();
-                        allocated[index] = false;
-                        other_allocated[index] = true;
+                        other_allocated[index] = allocated[index];
+                        allocated[index] = 0;
                     }
                 }
             }
@@ -1289,8 +1432,8 @@ public:
 
         const_pointer a_storage = a._storage;
         const_pointer b_storage = b._storage;
-        const bool* a_allocated = a._allocated;
-        const bool* b_allocated = b._allocated;
+        const uint8_t* a_allocated = a._allocated;
+        const uint8_t* b_allocated = b._allocated;
 
         for(size_type index = first_valid_index; index <= last_valid_index; ++index)
         {
@@ -1370,7 +1513,7 @@ public:
 protected:
     /// @cond DO_NOT_DOCUMENT
 
-    iunordered_map(reference storage, bool& allocated, size_type max_size) :
+    iunordered_map(reference storage, uint8_t& allocated, size_type max_size) :
         _storage(&storage),
         _allocated(&allocated),
         _max_size_minus_one(max_size - 1),
@@ -1378,11 +1521,44 @@ protected:
     {
     }
 
+    iunordered_map() :
+        _storage(nullptr),
+        _allocated(nullptr),
+        _max_size_minus_one(-1),
+        _first_valid_index(0)
+    {
+    }
+
+    void _set_storage(pointer storage, uint8_t* allocated, size_type max_size)
+    {
+        _storage = storage;
+        _allocated = allocated;
+        _max_size_minus_one = max_size - 1;
+        _first_valid_index = max_size;
+        _last_valid_index = 0;
+        _size = 0;
+    }
+
+    [[nodiscard]] pointer _storage_data()
+    {
+        return _storage;
+    }
+
+    void _swap_storage(iunordered_map& other)
+    {
+        bn::swap(_storage, other._storage);
+        bn::swap(_allocated, other._allocated);
+        bn::swap(_max_size_minus_one, other._max_size_minus_one);
+        bn::swap(_first_valid_index, other._first_valid_index);
+        bn::swap(_last_valid_index, other._last_valid_index);
+        bn::swap(_size, other._size);
+    }
+
     void _assign(const iunordered_map& other)
     {
         const_pointer other_storage = other._storage;
         pointer storage = _storage;
-        bool* allocated = _allocated;
+        uint8_t* allocated = _allocated;
         size_type first_valid_index = other._first_valid_index;
         size_type last_valid_index = other._last_valid_index;
         memory::copy(*other._allocated, other.max_size(), *allocated);
@@ -1404,7 +1580,7 @@ protected:
     {
         pointer other_storage = other._storage;
         pointer storage = _storage;
-        bool* allocated = _allocated;
+        uint8_t* allocated = _allocated;
         size_type first_valid_index = other._first_valid_index;
         size_type last_valid_index = other._last_valid_index;
         int other_max_size = other.max_size();
@@ -1428,7 +1604,7 @@ protected:
 
 private:
     pointer _storage;
-    bool* _allocated;
+    uint8_t* _allocated;
     size_type _max_size_minus_one;
     size_type _first_valid_index;
     size_type _last_valid_index = 0;
@@ -1438,6 +1614,109 @@ private:
     {
         return key_hash & _max_size_minus_one;
     }
+
+    #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+        size_type _robin_hood_insert(size_type index, int probe_distance, value_type&& value)
+        {
+            pointer storage = _storage;
+            uint8_t* allocated = _allocated;
+            alignas(value_type) char carried_value_buffer[sizeof(value_type)];
+            pointer carried_value = ::new(carried_value_buffer) value_type(move(value));
+
+            while(allocated[index])
+            {
+                if(allocated[index] < probe_distance)
+                {
+                    // The carried element takes the place of the resident one, which is nearer to its ideal position:
+                    value_type resident_value(move(storage[index]));
+                    storage[index].~value_type();
+                    ::new(storage + index) value_type(move(*carried_value));
+                    carried_value->~value_type();
+                    ::new(carried_value) value_type(move(resident_value));
+
+                    int resident_probe_distance = allocated[index];
+                    allocated[index] = uint8_t(probe_distance);
+                    probe_distance = resident_probe_distance;
+                }
+
+                index = _index(index + 1);
+                ++probe_distance;
+                BN_ASSERT(probe_distance <= numeric_limits<uint8_t>::max(), "Max probe distance exceeded");
+            }
+
+            BN_ASSERT(probe_distance <= numeric_limits<uint8_t>::max(), "Max probe distance exceeded");
+
+            ::new(storage + index) value_type(move(*carried_value));
+            carried_value->~value_type();
+            allocated[index] = uint8_t(probe_distance);
+            return index;
+        }
+
+        // Returns true if an element has been moved to the given last index
+        // (from the next index, or from the first one if the last index is the end of the storage):
+        [[nodiscard]] bool _robin_hood_erase_moved_to_last_index(size_type index, size_type last_index)
+        {
+            size_type empty_index = _robin_hood_erase(index);
+            return empty_index > last_index || empty_index < index;
+        }
+
+        size_type _robin_hood_erase(size_type index)
+        {
+            pointer storage = _storage;
+            uint8_t* allocated = _allocated;
+            storage[index].~value_type();
+            --_size;
+
+            // Backward shift deletion: the following elements are moved one position back
+            // until an empty slot or an element in its ideal position is found:
+            size_type empty_index = index;
+            size_type next_index = _index(index + 1);
+
+            while(allocated[next_index] > 1)
+            {
+                ::new(storage + empty_index) value_type(move(storage[next_index]));
+                storage[next_index].~value_type();
+                allocated[empty_index] = uint8_t(allocated[next_index] - 1);
+                empty_index = next_index;
+                next_index = _index(next_index + 1);
+            }
+
+            allocated[empty_index] = 0;
+
+            if(! _size)
+            {
+                _first_valid_index = max_size();
+                _last_valid_index = 0;
+                return empty_index;
+            }
+
+            if(empty_index == _first_valid_index)
+            {
+                size_type first_valid_index = empty_index;
+
+                while(! allocated[first_valid_index])
+                {
+                    ++first_valid_index;
+                }
+
+                _first_valid_index = first_valid_index;
+            }
+
+            if(empty_index == _last_valid_index)
+            {
+                size_type last_valid_index = empty_index;
+
+                while(! allocated[last_valid_index])
+                {
+                    --last_valid_index;
+                }
+
+                _last_valid_index = last_valid_index;
+            }
+
+            return empty_index;
+        }
+    #endif
 };
 
 
@@ -1611,7 +1890,7 @@ private:
     static constexpr unsigned _alignment = alignof(value_type) > alignof(int) ? alignof(value_type) : alignof(int);
 
     alignas(_alignment) char _storage_buffer[sizeof(value_type) * MaxSize];
-    bool _allocated_buffer[MaxSize] = {};
+    uint8_t _allocated_buffer[MaxSize] = {};
 };
 
 }
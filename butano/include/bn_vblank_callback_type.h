@@ -8,14 +8,23 @@
 
 /**
  * @file
- * bn::vblank_callback_type header file.
+ * bn::vblank_callback_type and bn::vblank_function_type header file.
  *
  * @ingroup core
  */
 
+#include "bn_function_fwd.h"
+
 namespace bn
 {
     using vblank_callback_type = void(*)(); //!< V-Blank callback type alias.
+
+    /**
+     * @brief V-Blank callable object type alias.
+     *
+     * Unlike bn::vblank_callback_type, it can store lambdas with captures up to 16 bytes.
+     */
+    using vblank_function_type = function<void(), 16>;
 }
 
 #endif
@@ -827,6 +827,26 @@ protected:
     {
     }
 
+    ivector() :
+        _data(nullptr),
+        _size(0),
+        _max_size(0)
+    {
+    }
+
+    void _set_storage(pointer data, size_type max_size)
+    {
+        _data = data;
+        _max_size = max_size;
+    }
+
+    void _swap_storage(ivector& other)
+    {
+        bn::swap(_data, other._data);
+        bn::swap(_size, other._size);
+        bn::swap(_max_size, other._max_size);
+    }
+
     void _assign(const ivector& other)
     {
         pointer data = _data;
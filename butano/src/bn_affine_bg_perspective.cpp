@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_affine_bg_perspective.h"
+
+#include "bn_math.h"
+#include "../hw/include/bn_hw_affine_bg_perspective.h"
+
+namespace bn
+{
+
+affine_bg_perspective::affine_bg_perspective(const affine_bg_ptr& bg) :
+    _pa_hbe_ptr(affine_bg_pa_register_hbe_ptr::create(bg, _pa_values)),
+    _pc_hbe_ptr(affine_bg_pc_register_hbe_ptr::create(bg, _pc_values)),
+    _dx_hbe_ptr(affine_bg_dx_register_hbe_ptr::create(bg, _dx_values)),
+    _dy_hbe_ptr(affine_bg_dy_register_hbe_ptr::create(bg, _dy_values))
+{
+    update();
+}
+
+void affine_bg_perspective::set_camera_height(fixed camera_height)
+{
+    BN_ASSERT(camera_height >= 0 && camera_height < 1024, "Invalid camera height: ", camera_height);
+
+    _camera_height = camera_height;
+    _dirty = true;
+}
+
+void affine_bg_perspective::set_camera_angle(fixed camera_angle)
+{
+    BN_ASSERT(camera_angle >= 0 && camera_angle <= 360, "Camera angle must be in the range [0, 360]: ", camera_angle);
+
+    _camera_angle = camera_angle;
+    _dirty = true;
+}
+
+void affine_bg_perspective::set_horizon(int horizon)
+{
+    BN_ASSERT(horizon >= 0 && horizon < display::height() - 1, "Invalid horizon: ", horizon);
+
+    _horizon = int16_t(horizon);
+    _dirty = true;
+}
+
+void affine_bg_perspective::set_focal_distance(int focal_distance)
+{
+    BN_ASSERT(focal_distance >= 1 && focal_distance <= 256, "Invalid focal distance: ", focal_distance);
+
+    _focal_distance = int16_t(focal_distance);
+    _dirty = true;
+}
+
+void affine_bg_perspective::set_visible(bool visible)
+{
+    _pa_hbe_ptr.set_visible(visible);
+    _pc_hbe_ptr.set_visible(visible);
+    _dx_hbe_ptr.set_visible(visible);
+    _dy_hbe_ptr.set_visible(visible);
+}
+
+void affine_bg_perspective::update()
+{
+    if(_dirty)
+    {
+        pair<fixed, fixed> sin_and_cos = degrees_lut_sin_and_cos(_camera_angle);
+        hw::affine_bg_perspective::input input;
+        input.camera_x = _camera_position.x().data();
+        input.camera_y = _camera_position.y().data();
+        input.camera_height = _camera_height.data();
+        input.sin = sin_and_cos.first.data();
+        input.cos = sin_and_cos.second.data();
+        input.horizon = _horizon;
+        input.focal_distance = _focal_distance;
+        hw::affine_bg_perspective::calculate(input, _pa_values, _pc_values, _dx_values, _dy_values);
+
+        _pa_hbe_ptr.reload_values_ref();
+        _pc_hbe_ptr.reload_values_ref();
+        _dx_hbe_ptr.reload_values_ref();
+        _dy_hbe_ptr.reload_values_ref();
+        _dirty = false;
+    }
+}
+
+}
@@ -7,7 +7,10 @@
 
 #include "bn_memory.h"
 #include "bn_limits.h"
+#include "bn_algorithm.h"
 #include "bn_alignment.h"
+#include "bn_config_allocator.h"
+#include "../hw/include/bn_hw_timer.h"
 
 #if BN_CFG_LOG_ENABLED
     #include "bn_log.h"
@@ -36,7 +39,54 @@ best_fit_allocator::~best_fit_allocator() noexcept
     BN_ASSERT(empty(), "Allocator is not empty");
 }
 
+allocator_stats best_fit_allocator::stats() const
+{
+    allocator_stats result = _stats;
+    result._used_bytes = used_bytes();
+    result._available_bytes = available_bytes();
+
+    const item_type* item = _begin_item();
+    const item_type* end_item = _end_item();
+
+    while(item != end_item)
+    {
+        if(! item->used)
+        {
+            result._largest_free_bytes = max(result._largest_free_bytes, int(item->size));
+            ++result._free_items_count;
+        }
+
+        item = item->next();
+    }
+
+    return result;
+}
+
 void* best_fit_allocator::alloc(size_type bytes)
+{
+    #if BN_CFG_ALLOCATOR_STATS_ENABLED
+        unsigned start_ticks = hw::timer::ticks();
+        void* result = _alloc(bytes);
+        _stats._alloc_ticks += int(hw::timer::ticks() - start_ticks);
+
+        if(result)
+        {
+            ++_stats._alloc_count;
+            ++_stats._alloc_bytes_histogram[allocator_stats::histogram_index(bytes)];
+            _stats._peak_used_bytes = max(_stats._peak_used_bytes, used_bytes());
+        }
+        else
+        {
+            ++_stats._failed_alloc_count;
+        }
+
+        return result;
+    #else
+        return _alloc(bytes);
+    #endif
+}
+
+void* best_fit_allocator::_alloc(size_type bytes)
 {
     BN_ASSERT(bytes >= 0, "Invalid bytes: ", bytes);
 
@@ -135,6 +185,10 @@ void best_fit_allocator::free(void* ptr)
         return;
     }
 
+    #if BN_CFG_ALLOCATOR_STATS_ENABLED
+        ++_stats._free_count;
+    #endif
+
     uint8_t* item_ptr = static_cast<uint8_t*>(ptr) - _sizeof_item;
     auto item = reinterpret_cast<item_type*>(item_ptr);
     item->used = false;
@@ -172,6 +226,8 @@ void best_fit_allocator::reset(void* start, size_type bytes)
     BN_ASSERT(bytes >= 0 && bytes % size_type(sizeof(int)) == 0, "Invalid bytes: ", bytes);
     BN_ASSERT(empty(), "Allocator is not empty");
 
+    _stats = allocator_stats();
+
     if(bytes >= _sizeof_item)
     {
         BN_ASSERT(start, "Start is null");
@@ -5,11 +5,13 @@
 
 #include "bn_bg_blocks_manager.h"
 
+#include "bn_rect.h"
 #include "bn_limits.h"
 #include "bn_string_view.h"
 #include "bn_bgs_manager.h"
 #include "bn_unordered_map.h"
 #include "bn_config_bg_blocks.h"
+#include "bn_bitmap_bg_manager.h"
 #include "../hw/include/bn_hw_memory.h"
 #include "../hw/include/bn_hw_bg_blocks.h"
 
@@ -39,6 +41,9 @@ namespace
 {
     static_assert(BN_CFG_BG_BLOCKS_MAX_ITEMS > 0 && BN_CFG_BG_BLOCKS_MAX_ITEMS <= hw::bg_tiles::blocks_count());
     static_assert(power_of_two(BN_CFG_BG_BLOCKS_MAX_ITEMS));
+    static_assert(BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS == 0 || BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS >= 4);
+    static_assert(BN_CFG_BG_BLOCKS_MAX_DIRTY_ROWS > 0 && BN_CFG_BG_BLOCKS_MAX_DIRTY_ROWS < 256);
+    static_assert(BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES >= 0 && BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES <= 16384);
 
 
     #if BN_CFG_LOG_ENABLED
@@ -156,6 +161,7 @@ namespace
         bool is_tiles: 1 = false;
         bool is_affine: 1 = false;
         bool commit: 1 = false;
+        bool dirty: 1 = false;
 
         [[nodiscard]] status_type status() const
         {
@@ -322,6 +328,16 @@ namespace
             return iterator(_items[index].next_index, *this);
         }
 
+        void swap_after(int index)
+        {
+            auto first_index = int(_items[index].next_index);
+            auto second_index = int(_items[first_index].next_index);
+            auto next_index = int(_items[second_index].next_index);
+            _join(index, second_index);
+            _join(second_index, first_index);
+            _join(first_index, next_index);
+        }
+
     private:
         item_type _items[max_list_items];
         alignas(int) int8_t _free_indices_array[max_items] = {};
@@ -362,16 +378,85 @@ namespace
     };
 
 
+    #if BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+        constexpr int max_big_map_chunks = BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS;
+
+
+        class big_map_chunk_type
+        {
+
+        public:
+            alignas(int) uint16_t cells[regular_bg_map_item::chunk_cells()];
+            const uint16_t* data = nullptr;
+            unsigned last_use = 0;
+            int index = 0;
+        };
+    #endif
+
+
+    constexpr int max_dirty_rows = BN_CFG_BG_BLOCKS_MAX_DIRTY_ROWS;
+
+
+    class dirty_row_type
+    {
+
+    public:
+        uint8_t item_id;
+        uint8_t row; // VRAM row (32 cells per row).
+        uint8_t first_column;
+        uint8_t last_column;
+    };
+
+
+    #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+        constexpr int max_streamed_tiles = BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES;
+        constexpr int max_streamed_slots = 1024;
+        constexpr int streamed_vram_cells = 32 * 32;
+        constexpr uint16_t invalid_streamed_index = numeric_limits<uint16_t>::max();
+
+
+        class streamed_tiles_type
+        {
+
+        public:
+            const tile* pool = nullptr;
+            int pool_tiles_count = 0;
+            int slots_count = 0;
+            int tiles_id = -1;
+            int clock_hand = 0;
+            bool bpp_8 = false;
+            uint16_t pool_to_slot[max_streamed_tiles];
+            uint16_t slot_to_pool[max_streamed_slots];
+            uint16_t slot_references[max_streamed_slots];
+            bool slot_released[max_streamed_slots];
+            uint16_t vram_cell_slots[streamed_vram_cells];
+        };
+    #endif
+
+
     class static_data
     {
 
     public:
+        #if BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+            big_map_chunk_type big_map_chunks[max_big_map_chunks];
+            unsigned big_map_chunks_last_use = 0;
+        #endif
+
+        #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+            streamed_tiles_type streamed_tiles;
+        #endif
+
         items_list items;
         unordered_map<const void*, int, max_items * 2, identity_hasher> items_map;
         alignas(int) uint16_t to_commit_items_array[max_items];
+        dirty_row_type dirty_rows_array[max_dirty_rows];
+        dirty_row_type to_commit_dirty_rows_array[max_dirty_rows];
         int free_blocks_count = 0;
         int to_remove_blocks_count = 0;
         int to_commit_items_count = 0;
+        int dirty_rows_count = 0;
+        int to_commit_dirty_rows_count = 0;
         bool allow_tiles_offset = true;
         bool check_commit = false;
         bool delay_commit = false;
@@ -575,6 +660,8 @@ namespace
     [[nodiscard]] int _find_tiles_impl(const uint16_t* tiles_data, [[maybe_unused]] compression_type compression,
                                        [[maybe_unused]] int half_words, [[maybe_unused]] bool affine)
     {
+        BN_ASSERT(! bitmap_bg_manager::created(), "BG tiles and maps can't be used with a bitmap BG");
+
         auto items_map_iterator = data.items_map.find(tiles_data);
 
         if(items_map_iterator != data.items_map.end())
@@ -624,6 +711,8 @@ namespace
     [[nodiscard]] int _find_regular_map_impl(const regular_bg_map_item& map_item, const regular_bg_tiles_ptr& tiles,
                                              const bg_palette_ptr& palette)
     {
+        BN_ASSERT(! bitmap_bg_manager::created(), "BG tiles and maps can't be used with a bitmap BG");
+
         const regular_bg_map_cell* data_ptr = map_item.cells_ptr();
         auto items_map_iterator = data.items_map.find(data_ptr);
 
@@ -685,6 +774,8 @@ namespace
     [[nodiscard]] int _find_affine_map_impl(const affine_bg_map_item& map_item, const affine_bg_tiles_ptr& tiles,
                                             const bg_palette_ptr& palette)
     {
+        BN_ASSERT(! bitmap_bg_manager::created(), "BG tiles and maps can't be used with a bitmap BG");
+
         const affine_bg_map_cell* data_ptr = map_item.cells_ptr();
         auto items_map_iterator = data.items_map.find(data_ptr);
 
@@ -742,6 +833,398 @@ namespace
         return -1;
     }
 
+#if BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+    [[nodiscard]] const uint16_t* _big_map_chunk(const item_type& item, int chunk_x, int chunk_y)
+    {
+        const uint16_t* item_data = item.data;
+        int chunk_index = (chunk_y * (item.width / regular_bg_map_item::chunk_size())) + chunk_x;
+        unsigned use = ++data.big_map_chunks_last_use;
+        big_map_chunk_type* lru_chunk = data.big_map_chunks;
+
+        for(big_map_chunk_type& chunk : data.big_map_chunks)
+        {
+            if(chunk.data == item_data && chunk.index == chunk_index)
+            {
+                chunk.last_use = use;
+                return chunk.cells;
+            }
+
+            if(chunk.last_use < lru_chunk->last_use)
+            {
+                lru_chunk = &chunk;
+            }
+        }
+
+        regular_bg_map_item map_item(*reinterpret_cast<const regular_bg_map_cell*>(item_data),
+                                     size(item.width, item.height), item.compression());
+        map_item.decompress_chunk(chunk_x, chunk_y, *lru_chunk->cells);
+        lru_chunk->data = item_data;
+        lru_chunk->last_use = use;
+        lru_chunk->index = chunk_index;
+        return lru_chunk->cells;
+    }
+
+    void _invalidate_big_map_chunks(const uint16_t* item_data)
+    {
+        for(big_map_chunk_type& chunk : data.big_map_chunks)
+        {
+            if(chunk.data == item_data)
+            {
+                chunk.data = nullptr;
+            }
+        }
+    }
+
+    void _update_compressed_regular_map_row(const item_type& item, int x, int y, uint16_t* vram_data)
+    {
+        // Chunks have the same size as the VRAM map, so chunk coordinates match VRAM coordinates:
+        int chunk_x = x / regular_bg_map_item::chunk_size();
+        int chunk_y = y / regular_bg_map_item::chunk_size();
+        int x_separator = x & 31;
+        int elements = 32 - x_separator;
+        int row_offset = (y & 31) * 32;
+        const uint16_t* source_data = _big_map_chunk(item, chunk_x, chunk_y) + row_offset + x_separator;
+        uint16_t* dest_data = vram_data + row_offset + x_separator;
+        auto tiles_offset = unsigned(item.regular_tiles_offset());
+        auto palette_offset = unsigned(item.palette_offset());
+        uint16_t offset = 0;
+
+        if(tiles_offset || palette_offset)
+        {
+            offset = hw::bg_blocks::regular_map_cells_offset(tiles_offset, palette_offset);
+            hw::bg_blocks::commit_offset(source_data, elements, offset, dest_data);
+        }
+        else
+        {
+            hw::memory::copy_half_words(source_data, elements, dest_data);
+        }
+
+        if(x_separator && (chunk_x + 1) * regular_bg_map_item::chunk_size() < item.width)
+        {
+            source_data = _big_map_chunk(item, chunk_x + 1, chunk_y) + row_offset;
+            dest_data = vram_data + row_offset;
+
+            if(offset)
+            {
+                hw::bg_blocks::commit_offset(source_data, x_separator, offset, dest_data);
+            }
+            else
+            {
+                hw::memory::copy_half_words(source_data, x_separator, dest_data);
+            }
+        }
+    }
+
+    void _update_compressed_regular_map_col(const item_type& item, int x, int y)
+    {
+        // Chunks have the same size as the VRAM map, so chunk coordinates match VRAM coordinates:
+        int chunk_x = x / regular_bg_map_item::chunk_size();
+        int chunk_y = y / regular_bg_map_item::chunk_size();
+        int x_offset = x & 31;
+        int y_separator = y & 31;
+        uint16_t* vram_data = hw::bg_blocks::vram(item.start_block) + x_offset;
+        const uint16_t* source_data = _big_map_chunk(item, chunk_x, chunk_y) + x_offset;
+        auto tiles_offset = unsigned(item.regular_tiles_offset());
+        auto palette_offset = unsigned(item.palette_offset());
+        uint16_t offset = 0;
+
+        if(tiles_offset || palette_offset)
+        {
+            offset = hw::bg_blocks::regular_map_cells_offset(tiles_offset, palette_offset);
+        }
+
+        for(int iy = y_separator; iy < 32; ++iy)
+        {
+            vram_data[iy * 32] = source_data[iy * 32] + offset;
+        }
+
+        if(y_separator && (chunk_y + 1) * regular_bg_map_item::chunk_size() < item.height)
+        {
+            source_data = _big_map_chunk(item, chunk_x, chunk_y + 1) + x_offset;
+
+            for(int iy = 0; iy < y_separator; ++iy)
+            {
+                vram_data[iy * 32] = source_data[iy * 32] + offset;
+            }
+        }
+    }
+
+#else
+    void _invalidate_big_map_chunks([[maybe_unused]] const uint16_t* item_data)
+    {
+    }
+#endif
+
+#if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+    [[nodiscard]] bool _streamed_regular_map(const item_type& item)
+    {
+        int streamed_tiles_id = data.streamed_tiles.tiles_id;
+        return streamed_tiles_id >= 0 && item.regular_tiles && item.regular_tiles->id() == streamed_tiles_id;
+    }
+
+    [[nodiscard]] bool _streamed_tiles_used(int excluded_id)
+    {
+        if(data.streamed_tiles.tiles_id >= 0)
+        {
+            for(auto iterator = data.items.begin(), end = data.items.end(); iterator != end; ++iterator)
+            {
+                const item_type& item = *iterator;
+
+                if(iterator.id() != excluded_id && item.status() == status_type::USED && _streamed_regular_map(item))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void _reset_streamed_references()
+    {
+        streamed_tiles_type& streamed_tiles = data.streamed_tiles;
+
+        for(int slot = 0, limit = streamed_tiles.slots_count; slot < limit; ++slot)
+        {
+            streamed_tiles.slot_references[slot] = 0;
+            streamed_tiles.slot_released[slot] = true;
+        }
+
+        for(uint16_t& vram_cell_slot : streamed_tiles.vram_cell_slots)
+        {
+            vram_cell_slot = invalid_streamed_index;
+        }
+    }
+
+    [[nodiscard]] int _acquire_streamed_slot(int pool_tile)
+    {
+        streamed_tiles_type& streamed_tiles = data.streamed_tiles;
+        BN_ASSERT(pool_tile < streamed_tiles.pool_tiles_count,
+                  "Invalid pool tile: ", pool_tile, " - ", streamed_tiles.pool_tiles_count);
+
+        int slot = streamed_tiles.pool_to_slot[pool_tile];
+
+        if(slot == invalid_streamed_index)
+        {
+            // Clock algorithm: released slots get a second chance before being reused:
+            int slots_count = streamed_tiles.slots_count;
+            int clock_hand = streamed_tiles.clock_hand;
+
+            for(int iterations = slots_count * 2; iterations; --iterations)
+            {
+                int candidate_slot = clock_hand;
+                ++clock_hand;
+
+                if(clock_hand == slots_count)
+                {
+                    clock_hand = 0;
+                }
+
+                if(! streamed_tiles.slot_references[candidate_slot])
+                {
+                    if(streamed_tiles.slot_released[candidate_slot])
+                    {
+                        streamed_tiles.slot_released[candidate_slot] = false;
+                    }
+                    else
+                    {
+                        slot = candidate_slot;
+                        break;
+                    }
+                }
+            }
+
+            BN_ASSERT(slot != invalid_streamed_index, "No more streamed tiles available");
+
+            streamed_tiles.clock_hand = clock_hand;
+
+            if(int old_pool_tile = streamed_tiles.slot_to_pool[slot]; old_pool_tile != invalid_streamed_index)
+            {
+                streamed_tiles.pool_to_slot[old_pool_tile] = invalid_streamed_index;
+            }
+
+            streamed_tiles.slot_to_pool[slot] = uint16_t(pool_tile);
+            streamed_tiles.pool_to_slot[pool_tile] = uint16_t(slot);
+
+            const item_type& tiles_item = data.items.item(streamed_tiles.tiles_id);
+            int tile_words = streamed_tiles.bpp_8 ? 16 : 8;
+            auto source_tile_ptr = reinterpret_cast<const unsigned*>(streamed_tiles.pool) + (pool_tile * tile_words);
+            auto destination_tile_ptr = reinterpret_cast<unsigned*>(hw::bg_blocks::vram(tiles_item.start_block));
+            hw::memory::copy_words(source_tile_ptr, tile_words, destination_tile_ptr + (slot * tile_words));
+        }
+
+        ++streamed_tiles.slot_references[slot];
+        return slot;
+    }
+
+    void _write_streamed_cell(unsigned source_cell, uint16_t offset, int vram_cell, uint16_t* vram_data)
+    {
+        streamed_tiles_type& streamed_tiles = data.streamed_tiles;
+        int slot = _acquire_streamed_slot(int(source_cell & 0x3FFF));
+        int old_slot = streamed_tiles.vram_cell_slots[vram_cell];
+
+        if(old_slot != invalid_streamed_index)
+        {
+            if(! --streamed_tiles.slot_references[old_slot])
+            {
+                streamed_tiles.slot_released[old_slot] = true;
+            }
+        }
+
+        streamed_tiles.vram_cell_slots[vram_cell] = uint16_t(slot);
+        vram_data[vram_cell] = uint16_t(unsigned(slot) | ((source_cell >> 14) << 10)) + offset;
+    }
+
+    [[nodiscard]] uint16_t _streamed_cells_offset(const item_type& item)
+    {
+        auto tiles_offset = unsigned(item.regular_tiles_offset());
+        auto palette_offset = unsigned(item.palette_offset());
+
+        if(tiles_offset || palette_offset)
+        {
+            return hw::bg_blocks::regular_map_cells_offset(tiles_offset, palette_offset);
+        }
+
+        return 0;
+    }
+
+    void _update_streamed_regular_map_col(const item_type& item, int x, int y)
+    {
+        uint16_t* vram_data = hw::bg_blocks::vram(item.start_block);
+        const uint16_t* source_data = item.data + x;
+        uint16_t offset = _streamed_cells_offset(item);
+        int map_width = item.width;
+
+        for(int map_y = y, map_y_limit = min(y + 32, int(item.height)); map_y < map_y_limit; ++map_y)
+        {
+            int vram_cell = ((map_y & 31) * 32) + (x & 31);
+            _write_streamed_cell(source_data[map_y * map_width], offset, vram_cell, vram_data);
+        }
+    }
+
+    void _update_streamed_regular_map_row(const item_type& item, int x, int y, uint16_t offset,
+                                          uint16_t* vram_data)
+    {
+        const uint16_t* source_data = item.data + (y * item.width);
+        int vram_row = (y & 31) * 32;
+
+        for(int map_x = x, map_x_limit = min(x + 32, int(item.width)); map_x < map_x_limit; ++map_x)
+        {
+            _write_streamed_cell(source_data[map_x], offset, vram_row + (map_x & 31), vram_data);
+        }
+    }
+#endif
+
+    [[nodiscard]] int _regular_map_cell_index(const item_type& item, int x, int y)
+    {
+        int width = item.width;
+
+        if(_big_regular_map(width, item.height))
+        {
+            return (y * width) + x;
+        }
+
+        // Non big maps are stored in screenblocks order, as in VRAM:
+        int screenblock = ((y / 32) * (width / 32)) + (x / 32);
+        return (screenblock * 1024) + ((y % 32) * 32) + (x % 32);
+    }
+
+    void _add_dirty_row(int id, item_type& item, int cell_index, int cells_count)
+    {
+        if(item.commit)
+        {
+            return;
+        }
+
+        int row = cell_index / 32;
+        int first_column = cell_index % 32;
+        int last_column = first_column + cells_count - 1;
+        int dirty_rows_count = data.dirty_rows_count;
+
+        for(int index = 0; index < dirty_rows_count; ++index)
+        {
+            dirty_row_type& dirty_row = data.dirty_rows_array[index];
+
+            if(dirty_row.item_id == id && dirty_row.row == row)
+            {
+                dirty_row.first_column = uint8_t(min(int(dirty_row.first_column), first_column));
+                dirty_row.last_column = uint8_t(max(int(dirty_row.last_column), last_column));
+                return;
+            }
+        }
+
+        if(dirty_rows_count == max_dirty_rows)
+        {
+            // Too many dirty rows, so the whole map is uploaded:
+            item.commit = true;
+            item.dirty = false;
+            data.check_commit = true;
+            return;
+        }
+
+        data.dirty_rows_array[dirty_rows_count] = { uint8_t(id), uint8_t(row), uint8_t(first_column),
+                                                    uint8_t(last_column) };
+        data.dirty_rows_count = dirty_rows_count + 1;
+        item.dirty = true;
+        data.check_commit = true;
+    }
+
+    void _set_regular_map_cells_row(int id, item_type& item, int x, int y, const regular_bg_map_cell* cells_ptr,
+                                    int cells_count)
+    {
+        auto data_ptr = const_cast<uint16_t*>(item.data);
+        bool big_map = _big_regular_map(item.width, item.height);
+
+        while(cells_count)
+        {
+            // Non big map rows are split in 32 cells screenblock rows:
+            int cell_index = _regular_map_cell_index(item, x, y);
+            int row_cells_count = big_map ? cells_count : min(cells_count, 32 - (x % 32));
+
+            for(int index = 0; index < row_cells_count; ++index)
+            {
+                data_ptr[cell_index + index] = cells_ptr[index];
+            }
+
+            if(big_map)
+            {
+                // Big maps are committed from bgs_manager:
+                _invalidate_big_map_chunks(item.data);
+                item.commit = true;
+                data.check_commit = true;
+            }
+            else
+            {
+                _add_dirty_row(id, item, cell_index, row_cells_count);
+            }
+
+            x += row_cells_count;
+            cells_ptr += row_cells_count;
+            cells_count -= row_cells_count;
+        }
+    }
+
+    void _commit_dirty_row(const dirty_row_type& dirty_row)
+    {
+        const item_type& item = data.items.item(dirty_row.item_id);
+        int cell_index = (dirty_row.row * 32) + dirty_row.first_column;
+        int cells_count = dirty_row.last_column - dirty_row.first_column + 1;
+        const uint16_t* source_data_ptr = item.data + cell_index;
+        uint16_t* destination_vram_ptr = hw::bg_blocks::vram(item.start_block) + cell_index;
+        auto tiles_offset = unsigned(item.regular_tiles_offset());
+        auto palette_offset = unsigned(item.palette_offset());
+
+        if(tiles_offset || palette_offset)
+        {
+            uint16_t offset = hw::bg_blocks::regular_map_cells_offset(tiles_offset, palette_offset);
+            hw::bg_blocks::commit_offset(source_data_ptr, cells_count, offset, destination_vram_ptr);
+        }
+        else
+        {
+            hw::memory::copy_half_words(source_data_ptr, cells_count, destination_vram_ptr);
+        }
+    }
+
     void _commit_item(const item_type& item)
     {
         const uint16_t* source_data_ptr = item.data;
@@ -929,8 +1412,118 @@ namespace
         return id;
     }
 
+    [[nodiscard]] int _find_free_item(const create_data& create_data, int& padding_blocks_count)
+    {
+        // Tiles are placed in the first free item which fits them (as close to the start of VRAM as possible),
+        // and maps in the last one (as close to the end of VRAM as possible),
+        // so creating and destroying both kinds of items doesn't interleave them:
+        bool maps = create_data._create_type == create_type::MAP;
+        int blocks_count = create_data.blocks_count;
+        int result = -1;
+
+        for(auto iterator = data.items.begin(), end = data.items.end(); iterator != end; ++iterator)
+        {
+            const item_type& item = *iterator;
+
+            if(item.status() == status_type::FREE)
+            {
+                int item_padding_blocks_count = create_data.padding_blocks_count(item.start_block);
+
+                if(item.blocks_count >= blocks_count + item_padding_blocks_count)
+                {
+                    result = iterator.id();
+                    padding_blocks_count = item_padding_blocks_count;
+
+                    if(! maps)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] bool _movable_map(const item_type& item)
+    {
+        return item.status() == status_type::USED && ! item.is_tiles && item.data;
+    }
+
+    [[nodiscard]] bool _compact()
+    {
+        // Maps with source data are moved to the end of VRAM and committed again,
+        // so the free blocks between them are joined:
+        bool result = false;
+        bool moved = true;
+
+        while(moved)
+        {
+            moved = false;
+
+            auto end = data.items.end();
+            auto previous_iterator = data.items.before_begin();
+            auto iterator = previous_iterator;
+            ++iterator;
+
+            while(iterator != end)
+            {
+                auto next_iterator = iterator;
+                ++next_iterator;
+
+                if(next_iterator == end)
+                {
+                    break;
+                }
+
+                item_type& item = *iterator;
+                item_type& next_item = *next_iterator;
+
+                if(_movable_map(item) && next_item.status() == status_type::FREE)
+                {
+                    BN_BG_BLOCKS_LOG("bg_blocks_manager - MOVE MAP: ", iterator.id(), " - ", item.start_block,
+                                     " - ", item.start_block + next_item.blocks_count);
+
+                    int start_block = item.start_block;
+                    item.start_block = uint8_t(start_block + next_item.blocks_count);
+                    next_item.start_block = uint8_t(start_block);
+                    data.items.swap_after(previous_iterator.id());
+
+                    if(previous_iterator != data.items.before_begin() &&
+                            previous_iterator->status() == status_type::FREE)
+                    {
+                        previous_iterator->blocks_count += next_item.blocks_count;
+                        data.items.erase_after(previous_iterator.id());
+                    }
+
+                    if(item.is_affine)
+                    {
+                        bgs_manager::update_affine_map_sbb(item.start_block);
+                    }
+                    else
+                    {
+                        bgs_manager::update_regular_map_sbb(item.start_block);
+                    }
+
+                    item.commit = true;
+                    data.check_commit = true;
+                    moved = true;
+                    result = true;
+                    break;
+                }
+
+                previous_iterator = iterator;
+                iterator = next_iterator;
+            }
+        }
+
+        return result;
+    }
+
     [[nodiscard]] int _create_impl(create_data&& create_data)
     {
+        BN_ASSERT(! bitmap_bg_manager::created(), "BG tiles and maps can't be used with a bitmap BG");
+
         auto begin = data.items.begin();
         auto end = data.items.end();
         int blocks_count = create_data.blocks_count;
@@ -957,39 +1550,12 @@ namespace
 
         if(blocks_count <= data.free_blocks_count)
         {
-            auto smallest_iterator = end;
-            int smallest_blocks_count = numeric_limits<int>::max();
-            int smallest_padding_blocks_count = 0;
-
-            for(auto iterator = begin; iterator != end; ++iterator)
-            {
-                const item_type& item = *iterator;
-
-                if(item.status() == status_type::FREE)
-                {
-                    int padding_blocks_count = create_data.padding_blocks_count(item.start_block);
-                    int requested_blocks_count = blocks_count + padding_blocks_count;
+            int padding_blocks_count;
+            int id = _find_free_item(create_data, padding_blocks_count);
 
-                    if(item.blocks_count > requested_blocks_count)
-                    {
-                        if(item.blocks_count < smallest_blocks_count)
-                        {
-                            smallest_iterator = iterator;
-                            smallest_blocks_count = item.blocks_count;
-                            smallest_padding_blocks_count = padding_blocks_count;
-                        }
-                    }
-                    else if(item.blocks_count == requested_blocks_count)
-                    {
-                        return _create_item(iterator.id(), padding_blocks_count, data.delay_commit, move(create_data));
-                    }
-                }
-            }
-
-            if(smallest_iterator != end)
+            if(id >= 0)
             {
-                return _create_item(smallest_iterator.id(), smallest_padding_blocks_count, data.delay_commit,
-                                    move(create_data));
+                return _create_item(id, padding_blocks_count, data.delay_commit, move(create_data));
             }
         }
 
@@ -1000,53 +1566,33 @@ namespace
             return _create_impl(move(create_data));
         }
 
+        if(blocks_count <= data.free_blocks_count && _compact())
+        {
+            // Moved maps are committed in the next frame, so new items can't be committed before:
+            data.delay_commit = true;
+            return _create_impl(move(create_data));
+        }
+
         return -1;
     }
 
     [[nodiscard]] int _allocate_impl(create_data&& create_data)
     {
+        BN_ASSERT(! bitmap_bg_manager::created(), "BG tiles and maps can't be used with a bitmap BG");
+
         if(data.delay_commit)
         {
             return -1;
         }
 
-        int blocks_count = create_data.blocks_count;
-
-        if(blocks_count <= data.free_blocks_count)
+        if(create_data.blocks_count <= data.free_blocks_count)
         {
-            auto end = data.items.end();
-            auto smallest_iterator = end;
-            int smallest_blocks_count = numeric_limits<int>::max();
-            int smallest_padding_blocks_count = 0;
-
-            for(auto iterator = data.items.begin(); iterator != end; ++iterator)
-            {
-                const item_type& item = *iterator;
-
-                if(item.status() == status_type::FREE)
-                {
-                    int padding_blocks_count = create_data.padding_blocks_count(item.start_block);
-                    int requested_blocks_count = blocks_count + padding_blocks_count;
-
-                    if(item.blocks_count > requested_blocks_count)
-                    {
-                        if(item.blocks_count < smallest_blocks_count)
-                        {
-                            smallest_iterator = iterator;
-                            smallest_blocks_count = item.blocks_count;
-                            smallest_padding_blocks_count = padding_blocks_count;
-                        }
-                    }
-                    else if(item.blocks_count == requested_blocks_count)
-                    {
-                        return _create_item(iterator.id(), padding_blocks_count, false, move(create_data));
-                    }
-                }
-            }
+            int padding_blocks_count;
+            int id = _find_free_item(create_data, padding_blocks_count);
 
-            if(smallest_iterator != end)
+            if(id >= 0)
             {
-                return _create_item(smallest_iterator.id(), smallest_padding_blocks_count, false, move(create_data));
+                return _create_item(id, padding_blocks_count, false, move(create_data));
             }
         }
 
@@ -1379,8 +1925,19 @@ int create_regular_map(const regular_bg_map_item& map_item, regular_bg_tiles_ptr
     BN_ASSERT(aligned<4>(data_ptr), "Map cells are not aligned");
     BN_ASSERT(regular_bg_tiles_item::valid_tiles_count(tiles.tiles_count(), palette.bpp()),
               "Invalid tiles count: ", tiles.tiles_count(), " - ", int(palette.bpp()));
-    BN_ASSERT(compression == compression_type::NONE || ! _big_regular_map(dimensions.width(), dimensions.height()),
-              "Compressed big regular maps are not supported");
+
+    #if ! BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+        BN_ASSERT(compression == compression_type::NONE || ! _big_regular_map(dimensions.width(), dimensions.height()),
+                  "Compressed big regular maps are not supported");
+    #endif
+
+    #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+        BN_ASSERT(tiles.id() != data.streamed_tiles.tiles_id ||
+                  (map_item.big() && compression == compression_type::NONE),
+                  "Streamed regular tiles can only be used by uncompressed big maps");
+        BN_ASSERT(tiles.id() != data.streamed_tiles.tiles_id || ! _streamed_tiles_used(-1),
+                  "Streamed regular tiles can only be used by one map");
+    #endif
 
     result = _create_impl(
                 create_data::from_regular_map(data_ptr, dimensions, compression, move(tiles), move(palette)));
@@ -1570,8 +2127,19 @@ int create_new_regular_map(const regular_bg_map_item& map_item, regular_bg_tiles
     BN_ASSERT(aligned<4>(data_ptr), "Map cells are not aligned");
     BN_ASSERT(regular_bg_tiles_item::valid_tiles_count(tiles.tiles_count(), palette.bpp()),
               "Invalid tiles count: ", tiles.tiles_count(), " - ", int(palette.bpp()));
-    BN_ASSERT(compression == compression_type::NONE || ! _big_regular_map(dimensions.width(), dimensions.height()),
-              "Compressed big regular maps are not supported");
+
+    #if ! BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+        BN_ASSERT(compression == compression_type::NONE || ! _big_regular_map(dimensions.width(), dimensions.height()),
+                  "Compressed big regular maps are not supported");
+    #endif
+
+    #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+        BN_ASSERT(tiles.id() != data.streamed_tiles.tiles_id ||
+                  (map_item.big() && compression == compression_type::NONE),
+                  "Streamed regular tiles can only be used by uncompressed big maps");
+        BN_ASSERT(tiles.id() != data.streamed_tiles.tiles_id || ! _streamed_tiles_used(-1),
+                  "Streamed regular tiles can only be used by one map");
+    #endif
     BN_ASSERT(data.items_map.find(data_ptr) == data.items_map.end(),
               "Multiple copies of the same data not supported");
 
@@ -1693,6 +2261,45 @@ int allocate_regular_tiles(int tiles_count, bpp_mode bpp, bool optional)
     return result;
 }
 
+#if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+    int create_streamed_regular_tiles(const span<const tile>& tiles_pool, bpp_mode bpp, int cache_tiles_count)
+    {
+        streamed_tiles_type& streamed_tiles = data.streamed_tiles;
+        int pool_tiles_count = tiles_pool.size();
+        bool bpp_8 = bpp == bpp_mode::BPP_8;
+
+        BN_BG_BLOCKS_LOG("bg_blocks_manager - CREATE STREAMED REGULAR TILES: ", tiles_pool.data(), " - ",
+                         pool_tiles_count, " - ", int(bpp), " - ", cache_tiles_count);
+
+        BN_ASSERT(streamed_tiles.tiles_id < 0, "Streamed regular tiles already created");
+        BN_ASSERT(aligned<4>(tiles_pool.data()), "Tiles pool is not aligned");
+        BN_ASSERT(pool_tiles_count > 0 && pool_tiles_count <= max_streamed_tiles,
+                  "Invalid pool tiles count: ", pool_tiles_count, " - ", max_streamed_tiles);
+        BN_ASSERT(! bpp_8 || pool_tiles_count % 2 == 0, "Invalid pool tiles count: ", pool_tiles_count);
+
+        int result = allocate_regular_tiles(cache_tiles_count, bpp, false);
+        streamed_tiles.pool = tiles_pool.data();
+        streamed_tiles.pool_tiles_count = bpp_8 ? pool_tiles_count / 2 : pool_tiles_count;
+        streamed_tiles.slots_count = bpp_8 ? cache_tiles_count / 2 : cache_tiles_count;
+        streamed_tiles.tiles_id = result;
+        streamed_tiles.clock_hand = 0;
+        streamed_tiles.bpp_8 = bpp_8;
+
+        for(int pool_tile = 0; pool_tile < streamed_tiles.pool_tiles_count; ++pool_tile)
+        {
+            streamed_tiles.pool_to_slot[pool_tile] = invalid_streamed_index;
+        }
+
+        for(int slot = 0; slot < streamed_tiles.slots_count; ++slot)
+        {
+            streamed_tiles.slot_to_pool[slot] = invalid_streamed_index;
+        }
+
+        _reset_streamed_references();
+        return result;
+    }
+#endif
+
 int allocate_affine_tiles(int tiles_count, bool optional)
 {
     int half_words = _tiles_to_half_words(tiles_count);
@@ -1840,6 +2447,13 @@ void decrease_usages(int id)
         item.set_status(status_type::TO_REMOVE);
         data.to_remove_blocks_count += item.blocks_count;
 
+        #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+            if(id == data.streamed_tiles.tiles_id)
+            {
+                data.streamed_tiles.tiles_id = -1;
+            }
+        #endif
+
         item.regular_tiles.reset();
         item.affine_tiles.reset();
         item.palette.reset();
@@ -2039,8 +2653,11 @@ void set_regular_map_cells_ref(int id, const regular_bg_map_item& map_item)
               map_item.dimensions().width(), " - ", item.width);
     BN_ASSERT(map_item.dimensions().height() == item.height, "Map height does not match item map height: ",
               map_item.dimensions().height(), " - ", item.height);
-    BN_ASSERT(compression == compression_type::NONE || ! _big_regular_map(item.width, item.height),
-              "Compressed big regular maps are not supported");
+
+    #if ! BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+        BN_ASSERT(compression == compression_type::NONE || ! _big_regular_map(item.width, item.height),
+                  "Compressed big regular maps are not supported");
+    #endif
 
     if(item_data != data_ptr)
     {
@@ -2061,6 +2678,7 @@ void set_regular_map_cells_ref(int id, const regular_bg_map_item& map_item)
     }
     else if(compression != item.compression())
     {
+        _invalidate_big_map_chunks(item_data);
         item.set_compression(compression);
         item.commit = true;
         data.check_commit = true;
@@ -2121,12 +2739,50 @@ void reload(int id)
     item_type& item = data.items.item(id);
     BN_ASSERT(item.data, "Item has no data");
 
+    _invalidate_big_map_chunks(item.data);
     item.commit = true;
     data.check_commit = true;
 
     BN_BG_BLOCKS_LOG_STATUS();
 }
 
+void set_regular_map_cell(int id, int x, int y, regular_bg_map_cell cell)
+{
+    item_type& item = data.items.item(id);
+    BN_ASSERT(item.data, "Item has no data");
+    BN_ASSERT(item.compression() == compression_type::NONE, "Compressed maps not supported");
+    BN_ASSERT(! hw::memory::in_rom(item.data), "Map cells are stored in ROM");
+    BN_ASSERT(x >= 0 && x < item.width, "Invalid x: ", x, " - ", item.width);
+    BN_ASSERT(y >= 0 && y < item.height, "Invalid y: ", y, " - ", item.height);
+
+    _set_regular_map_cells_row(id, item, x, y, &cell, 1);
+}
+
+void set_regular_map_cells(int id, const rect& cells_rect, const span<const regular_bg_map_cell>& cells)
+{
+    item_type& item = data.items.item(id);
+    int left = cells_rect.left();
+    int top = cells_rect.top();
+    int width = cells_rect.width();
+    int height = cells_rect.height();
+    BN_ASSERT(item.data, "Item has no data");
+    BN_ASSERT(item.compression() == compression_type::NONE, "Compressed maps not supported");
+    BN_ASSERT(! hw::memory::in_rom(item.data), "Map cells are stored in ROM");
+    BN_ASSERT(left >= 0 && width >= 0 && left + width <= item.width,
+              "Invalid rect horizontal coordinates: ", left, " - ", width, " - ", item.width);
+    BN_ASSERT(top >= 0 && height >= 0 && top + height <= item.height,
+              "Invalid rect vertical coordinates: ", top, " - ", height, " - ", item.height);
+    BN_ASSERT(cells.size() == width * height, "Invalid cells count: ", cells.size(), " - ", width * height);
+
+    const regular_bg_map_cell* cells_ptr = cells.data();
+
+    for(int y = top, y_limit = top + height; y < y_limit; ++y)
+    {
+        _set_regular_map_cells_row(id, item, left, y, cells_ptr, width);
+        cells_ptr += width;
+    }
+}
+
 const regular_bg_tiles_ptr& regular_map_tiles(int id)
 {
     const item_type& item = data.items.item(id);
@@ -2148,6 +2804,11 @@ void set_regular_map_tiles(int id, regular_bg_tiles_ptr&& tiles)
         BN_ASSERT(regular_bg_tiles_item::valid_tiles_count(tiles.tiles_count(), item.palette->bpp()),
                   "Invalid tiles count: ", tiles.tiles_count(), " - ", int(item.palette->bpp()));
 
+        #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+            BN_ASSERT(tiles.id() != data.streamed_tiles.tiles_id || ! _streamed_tiles_used(id),
+                      "Streamed regular tiles can only be used by one map");
+        #endif
+
         int old_tiles_cbb;
         int old_tiles_offset;
 
@@ -2301,6 +2962,11 @@ void set_regular_map_tiles_and_palette(int id, regular_bg_tiles_ptr&& tiles, bg_
     BN_ASSERT(regular_bg_tiles_item::valid_tiles_count(tiles.tiles_count(), new_palette_bpp),
               "Invalid tiles count or palette BPP: ", tiles.tiles_count(), " - ", int(new_palette_bpp));
 
+    #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+        BN_ASSERT(tiles.id() != data.streamed_tiles.tiles_id || ! _streamed_tiles_used(id),
+                  "Streamed regular tiles can only be used by one map");
+    #endif
+
     int old_tiles_offset;
     int old_palette_offset;
 
@@ -2407,6 +3073,22 @@ void update_regular_map_col(int id, int x, int y)
         return;
     }
 
+    #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+        if(_streamed_regular_map(item))
+        {
+            _update_streamed_regular_map_col(item, x, y);
+            return;
+        }
+    #endif
+
+    #if BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+        if(item.compression() != compression_type::NONE)
+        {
+            _update_compressed_regular_map_col(item, x, y);
+            return;
+        }
+    #endif
+
     int map_width = item.width;
     source_data += ((y * map_width) + x);
 
@@ -2578,6 +3260,23 @@ void update_regular_map_row(int id, int x, int y)
         return;
     }
 
+    #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+        if(_streamed_regular_map(item))
+        {
+            _update_streamed_regular_map_row(item, x, y, _streamed_cells_offset(item),
+                                             hw::bg_blocks::vram(item.start_block));
+            return;
+        }
+    #endif
+
+    #if BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+        if(item.compression() != compression_type::NONE)
+        {
+            _update_compressed_regular_map_row(item, x, y, hw::bg_blocks::vram(item.start_block));
+            return;
+        }
+    #endif
+
     source_data += ((y * item.width) + x);
 
     int x_separator = x & 31;
@@ -2652,6 +3351,34 @@ void set_regular_map_position(int id, int x, int y)
     }
 
     uint16_t* vram_data = hw::bg_blocks::vram(item.start_block);
+
+    #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+        if(_streamed_regular_map(item))
+        {
+            uint16_t offset = _streamed_cells_offset(item);
+            _reset_streamed_references();
+
+            for(int row = y, row_limit = y + 22; row < row_limit; ++row)
+            {
+                _update_streamed_regular_map_row(item, x, row, offset, vram_data);
+            }
+
+            return;
+        }
+    #endif
+
+    #if BN_CFG_BG_BLOCKS_BIG_MAP_CACHED_CHUNKS
+        if(item.compression() != compression_type::NONE)
+        {
+            for(int row = y, row_limit = y + 22; row < row_limit; ++row)
+            {
+                _update_compressed_regular_map_row(item, x, row, vram_data);
+            }
+
+            return;
+        }
+    #endif
+
     int map_width = item.width;
     int x_separator = x & 31;
     int elements = 32 - x_separator;
@@ -2766,6 +3493,7 @@ void update()
                 item.height = 0;
                 item.set_status(status_type::FREE);
                 item.commit = false;
+                item.dirty = false;
                 data.free_blocks_count += item.blocks_count;
 
                 auto next_iterator = iterator;
@@ -2795,7 +3523,9 @@ void update()
             }
             else if(item.commit)
             {
+                // Whole map commits make dirty rows redundant:
                 item.commit = false;
+                item.dirty = false;
                 data.to_commit_items_array[commit_items_count] = iterator.id();
                 ++commit_items_count;
             }
@@ -2807,6 +3537,30 @@ void update()
 
         data.to_commit_items_count = commit_items_count;
 
+        if(int dirty_rows_count = data.dirty_rows_count)
+        {
+            int commit_dirty_rows_count = 0;
+            data.dirty_rows_count = 0;
+
+            for(int index = 0; index < dirty_rows_count; ++index)
+            {
+                const dirty_row_type& dirty_row = data.dirty_rows_array[index];
+
+                if(data.items.item(dirty_row.item_id).dirty)
+                {
+                    data.to_commit_dirty_rows_array[commit_dirty_rows_count] = dirty_row;
+                    ++commit_dirty_rows_count;
+                }
+            }
+
+            for(int index = 0; index < commit_dirty_rows_count; ++index)
+            {
+                data.items.item(data.to_commit_dirty_rows_array[index].item_id).dirty = false;
+            }
+
+            data.to_commit_dirty_rows_count = commit_dirty_rows_count;
+        }
+
         BN_BG_BLOCKS_LOG_STATUS();
     }
 
@@ -2829,6 +3583,16 @@ void commit()
 
         BN_BG_BLOCKS_LOG_STATUS();
     }
+
+    if(int commit_dirty_rows_count = data.to_commit_dirty_rows_count)
+    {
+        for(int index = 0; index < commit_dirty_rows_count; ++index)
+        {
+            _commit_dirty_row(data.to_commit_dirty_rows_array[index]);
+        }
+
+        data.to_commit_dirty_rows_count = 0;
+    }
 }
 
 }
@@ -9,11 +9,13 @@
 #include "bn_span.h"
 #include "bn_optional.h"
 #include "bn_config_log.h"
+#include "bn_config_bg_blocks.h"
 #include "bn_affine_bg_map_cell.h"
 #include "bn_regular_bg_map_cell.h"
 
 namespace bn
 {
+    class rect;
     class size;
     class tile;
     class bg_palette_ptr;
@@ -89,6 +91,11 @@ namespace bn::bg_blocks_manager
 
     [[nodiscard]] int allocate_affine_tiles(int tiles_count, bool optional);
 
+    #if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+        [[nodiscard]] int create_streamed_regular_tiles(const span<const tile>& tiles_pool, bpp_mode bpp,
+                                                        int cache_tiles_count);
+    #endif
+
     [[nodiscard]] int allocate_regular_map(const size& map_dimensions, regular_bg_tiles_ptr&& tiles,
                                            bg_palette_ptr&& palette, bool optional);
 
@@ -135,6 +142,10 @@ namespace bn::bg_blocks_manager
 
     void reload(int id);
 
+    void set_regular_map_cell(int id, int x, int y, regular_bg_map_cell cell);
+
+    void set_regular_map_cells(int id, const rect& cells_rect, const span<const regular_bg_map_cell>& cells);
+
     [[nodiscard]] const regular_bg_tiles_ptr& regular_map_tiles(int id);
 
     [[nodiscard]] const affine_bg_tiles_ptr& affine_map_tiles(int id);
@@ -34,6 +34,9 @@ namespace
 {
     static_assert(BN_CFG_BGS_MAX_ITEMS > 0);
 
+    // Map rows written when the visible window of a big map is fully committed:
+    constexpr int big_map_full_commit_rows = 22;
+
     class item_type
     {
 
@@ -49,6 +52,7 @@ namespace
         optional<regular_bg_map_ptr> regular_map;
         optional<affine_bg_map_ptr> affine_map;
         optional<camera_ptr> camera;
+        fixed_point camera_factor = fixed_point(1, 1);
         uint16_t hw_cnt;
         uint16_t old_big_map_x = 0;
         uint16_t old_big_map_y = 0;
@@ -231,8 +235,17 @@ namespace
             if(camera_ptr* camera_ptr = camera.get())
             {
                 const fixed_point& camera_position = camera_ptr->position();
-                real_x -= camera_position.x().right_shift_integer();
-                real_y -= camera_position.y().right_shift_integer();
+
+                if(camera_factor == fixed_point(1, 1))
+                {
+                    real_x -= camera_position.x().right_shift_integer();
+                    real_y -= camera_position.y().right_shift_integer();
+                }
+                else
+                {
+                    real_x -= (camera_position.x() * camera_factor.x()).right_shift_integer();
+                    real_y -= (camera_position.y() * camera_factor.y()).right_shift_integer();
+                }
             }
 
             int hw_x = -real_x - (display::width() / 2) + half_dimensions.width();
@@ -370,6 +383,7 @@ namespace
         pool<item_type, BN_CFG_BGS_MAX_ITEMS> items_pool;
         vector<item_type*, BN_CFG_BGS_MAX_ITEMS> items_vector;
         hw::bgs::commit_data commit_data;
+        int8_t bitmap_mode = 0;
         bool rebuild_handles = false;
         bool commit = false;
     };
@@ -494,20 +508,32 @@ namespace
 
                 int map_handle = item_regular_map ? item_regular_map->handle() : item->affine_map->handle();
                 bool full_commit_big_map = item->full_commit_big_map || bg_blocks_manager::must_commit(map_handle);
+
+                if(! item->visible)
+                {
+                    // Hidden big maps are fully committed when they are shown again:
+                    item->full_commit_big_map = full_commit_big_map || item->commit_big_map;
+                    item->commit_big_map = false;
+                    continue;
+                }
+
                 bool commit_big_map = full_commit_big_map;
 
-                if(! commit_big_map && item->commit_big_map && item->visible)
+                if(! commit_big_map && item->commit_big_map)
                 {
                     commit_big_map = old_map_x != new_map_x || old_map_y != new_map_y;
                 }
 
                 if(commit_big_map)
                 {
+                    // Columns are weighted twice since their VRAM writes are not contiguous.
+                    // If updating the moved rows and columns is more expensive than rewriting the visible window,
+                    // the visible window is rewritten, so a camera jump is never slower than a full commit:
+                    int commit_rows = (bn::abs(new_map_x - old_map_x) * 2) + bn::abs(new_map_y - old_map_y);
                     item->new_big_map_x = uint16_t(new_map_x);
                     item->new_big_map_y = uint16_t(new_map_y);
                     item->commit_big_map = true;
-                    item->full_commit_big_map = full_commit_big_map || bn::abs(new_map_x - old_map_x) > 8 ||
-                            bn::abs(new_map_y - old_map_y) > 8;
+                    item->full_commit_big_map = full_commit_big_map || commit_rows >= big_map_full_commit_rows;
                 }
             }
         }
@@ -1467,6 +1493,28 @@ void remove_camera(id_type id)
     }
 }
 
+const fixed_point& camera_factor(id_type id)
+{
+    auto item = static_cast<const item_type*>(id);
+    return item->camera_factor;
+}
+
+void set_regular_camera_factor(id_type id, const fixed_point& camera_factor)
+{
+    auto item = static_cast<item_type*>(id);
+
+    if(camera_factor != item->camera_factor)
+    {
+        item->camera_factor = camera_factor;
+
+        if(item->camera)
+        {
+            item->update_regular_hw_position();
+            _update_item_hw_regular_offset(*item);
+        }
+    }
+}
+
 void update_cameras()
 {
     for(item_type* item : data.items_vector)
@@ -1515,6 +1563,34 @@ void update_affine_map_tiles_cbb(int map_id, int tiles_cbb)
     }
 }
 
+void update_regular_map_sbb(int map_id)
+{
+    for(item_type* item : data.items_vector)
+    {
+        regular_bg_map_ptr* item_regular_map = item->regular_map.get();
+
+        if(item_regular_map && item_regular_map->id() == map_id)
+        {
+            hw::bgs::set_map_sbb(map_id, item->hw_cnt);
+            _update_item_hw_cnt(*item);
+        }
+    }
+}
+
+void update_affine_map_sbb(int map_id)
+{
+    for(item_type* item : data.items_vector)
+    {
+        affine_bg_map_ptr* item_affine_map = item->affine_map.get();
+
+        if(item_affine_map && item_affine_map->id() == map_id)
+        {
+            hw::bgs::set_map_sbb(map_id, item->hw_cnt);
+            _update_item_hw_cnt(*item);
+        }
+    }
+}
+
 void update_regular_map_palette_bpp(int map_id, bpp_mode bpp)
 {
     for(item_type* item : data.items_vector)
@@ -1529,6 +1605,12 @@ void update_regular_map_palette_bpp(int map_id, bpp_mode bpp)
     }
 }
 
+void set_bitmap_mode(int mode)
+{
+    data.bitmap_mode = int8_t(mode);
+    data.rebuild_handles = true;
+}
+
 void reload()
 {
     data.commit = true;
@@ -1552,6 +1634,32 @@ void fill_hblank_effect_regular_positions(int base_position, const fixed* positi
     }
 }
 
+void fill_hblank_effect_regular_horizontal_parallax_positions(id_type id, const fixed* factors_ptr,
+                                                              uint16_t* dest_ptr)
+{
+    auto item = static_cast<const item_type*>(id);
+    int base_position = item->hw_position.x();
+
+    if(const camera_ptr* item_camera = item->camera.get())
+    {
+        // Each line replaces the camera offset applied with the background factor with its own one:
+        fixed camera_x = item_camera->x();
+        base_position -= (camera_x * item->camera_factor.x()).right_shift_integer();
+
+        for(int index = 0, limit = display::height(); index < limit; ++index)
+        {
+            dest_ptr[index] = uint16_t(base_position + (camera_x * factors_ptr[index]).right_shift_integer());
+        }
+    }
+    else
+    {
+        for(int index = 0, limit = display::height(); index < limit; ++index)
+        {
+            dest_ptr[index] = uint16_t(base_position);
+        }
+    }
+}
+
 void fill_hblank_effect_pivot_horizontal_positions(id_type id, const fixed* positions_ptr, unsigned* dest_ptr)
 {
     constexpr int right_shift = fixed::precision() - hw::bgs::affine_precision();
@@ -1636,6 +1744,26 @@ void rebuild_handles()
         data.rebuild_handles = false;
         data.commit = true;
 
+        if(int bitmap_mode = data.bitmap_mode)
+        {
+            display_manager::set_mode(bitmap_mode);
+            display_manager::disable_all_bgs();
+            display_manager::update_windows_visible_bgs();
+            display_manager::set_bg_enabled(2, true);
+            data.commit_data.cnts[2] = 0;
+            hw::bgs::set_priority(hw::bgs::count() - 1, data.commit_data.cnts[2]);
+            data.commit_data.affine_attribute_sets[0] = hw::bgs::affine_attributes();
+
+            for(item_type* item : data.items_vector)
+            {
+                BN_ASSERT(! item->visible, "Regular and affine BGs can't be shown with a bitmap BG");
+
+                item->handles_index = -1;
+            }
+
+            return;
+        }
+
         for(item_type* item : data.items_vector)
         {
             if(item->affine_map && item->visible)
@@ -182,18 +182,31 @@ namespace bgs_manager
 
     void remove_camera(id_type id);
 
+    [[nodiscard]] const fixed_point& camera_factor(id_type id);
+
+    void set_regular_camera_factor(id_type id, const fixed_point& camera_factor);
+
     void update_cameras();
 
     void update_regular_map_tiles_cbb(int map_id, int tiles_cbb);
 
     void update_affine_map_tiles_cbb(int map_id, int tiles_cbb);
 
+    void update_regular_map_sbb(int map_id);
+
+    void update_affine_map_sbb(int map_id);
+
     void update_regular_map_palette_bpp(int map_id, bpp_mode bpp);
 
+    void set_bitmap_mode(int mode);
+
     void reload();
 
     void fill_hblank_effect_regular_positions(int base_position, const fixed* positions_ptr, uint16_t* dest_ptr);
 
+    void fill_hblank_effect_regular_horizontal_parallax_positions(id_type id, const fixed* factors_ptr,
+                                                                  uint16_t* dest_ptr);
+
     void fill_hblank_effect_pivot_horizontal_positions(id_type id, const fixed* positions_ptr, unsigned* dest_ptr);
 
     void fill_hblank_effect_pivot_vertical_positions(id_type id, const fixed* positions_ptr, unsigned* dest_ptr);
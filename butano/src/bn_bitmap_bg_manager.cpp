@@ -0,0 +1,596 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_bitmap_bg_manager.h"
+
+#include "bn_rect.h"
+#include "bn_memory.h"
+#include "bn_algorithm.h"
+#include "bn_config_bgs.h"
+#include "bn_bgs_manager.h"
+#include "bn_bitmap_bg_mode.h"
+#include "bn_display_manager.h"
+#include "bn_bg_blocks_manager.h"
+#include "bn_sprite_tiles_manager.h"
+#include "../hw/include/bn_hw_dma.h"
+#include "../hw/include/bn_hw_memory.h"
+#include "../hw/include/bn_hw_bitmap_bg.h"
+
+#include "bn_bitmap_bg_ptr.cpp.h"
+
+namespace bn::bitmap_bg_manager
+{
+
+namespace
+{
+    constexpr int max_width = 240;
+    constexpr int max_height = 160;
+
+
+    class static_data
+    {
+
+    public:
+        uint16_t* canvas = nullptr;
+        int16_t dirty_first_x[max_height];
+        int16_t dirty_last_x[max_height];
+        int dirty_first_y = max_height;
+        int dirty_last_y = 0;
+        int commit_y = 0;
+        unsigned usages = 0;
+        int sprite_tiles_id = -1;
+        int width = 0;
+        int height = 0;
+        int back_page = 1;
+        bitmap_bg_mode mode = bitmap_bg_mode::MODE_3;
+        bool flip_pending = false;
+    };
+
+    BN_DATA_EWRAM static_data data;
+
+
+    [[nodiscard]] bool _bpp_8()
+    {
+        return data.mode == bitmap_bg_mode::MODE_4;
+    }
+
+    [[nodiscard]] int _pitch()
+    {
+        return data.width;
+    }
+
+    [[nodiscard]] uint16_t* _pixels_ptr()
+    {
+        return data.mode == bitmap_bg_mode::MODE_3 ? data.canvas : hw::bitmap_bg::page_vram(data.back_page);
+    }
+
+    [[nodiscard]] uint16_t* _row_ptr(int y)
+    {
+        int row_half_words = _bpp_8() ? _pitch() / 2 : _pitch();
+        return _pixels_ptr() + (y * row_half_words);
+    }
+
+    void _reset_dirty_row(int y)
+    {
+        data.dirty_first_x[y] = int16_t(max_width);
+        data.dirty_last_x[y] = 0;
+    }
+
+    void _reset_dirty()
+    {
+        for(int y = data.dirty_first_y; y < data.dirty_last_y; ++y)
+        {
+            _reset_dirty_row(y);
+        }
+
+        data.dirty_first_y = max_height;
+        data.dirty_last_y = 0;
+    }
+
+    void _set_dirty(int x, int y, int width, int height)
+    {
+        if(data.mode == bitmap_bg_mode::MODE_3)
+        {
+            int x_limit = x + width;
+            int y_limit = y + height;
+            data.dirty_first_y = min(data.dirty_first_y, y);
+            data.dirty_last_y = max(data.dirty_last_y, y_limit);
+
+            for(; y < y_limit; ++y)
+            {
+                data.dirty_first_x[y] = int16_t(min(int(data.dirty_first_x[y]), x));
+                data.dirty_last_x[y] = int16_t(max(int(data.dirty_last_x[y]), x_limit));
+            }
+        }
+    }
+
+    [[nodiscard]] bool _clip(int& x, int& y, int& width, int& height)
+    {
+        if(x < 0)
+        {
+            width += x;
+            x = 0;
+        }
+
+        if(y < 0)
+        {
+            height += y;
+            y = 0;
+        }
+
+        width = min(width, data.width - x);
+        height = min(height, data.height - y);
+        return width > 0 && height > 0;
+    }
+
+    [[nodiscard]] int _line_outcode(int x, int y)
+    {
+        int result = 0;
+
+        if(x < -1)
+        {
+            result |= 1;
+        }
+        else if(x > data.width)
+        {
+            result |= 2;
+        }
+
+        if(y < -1)
+        {
+            result |= 4;
+        }
+        else if(y > data.height)
+        {
+            result |= 8;
+        }
+
+        return result;
+    }
+
+    // Lines are drawn with the nearest pixels, so clipped coordinates must be rounded the same way:
+    [[nodiscard]] int _line_rounded_division(int64_t numerator, int64_t denominator)
+    {
+        if(denominator < 0)
+        {
+            numerator = -numerator;
+            denominator = -denominator;
+        }
+
+        int64_t half_denominator = denominator / 2;
+        return int(numerator >= 0 ? (numerator + half_denominator) / denominator :
+                                    -((half_denominator - numerator) / denominator));
+    }
+
+    // Cohen-Sutherland line clipping, so off-screen endpoints don't require stepping hidden pixels.
+    // Lines are clipped to the canvas plus a one pixel border, so rounding doesn't hide pixels near the edges
+    // (pixels outside the canvas are discarded when drawing the line):
+    [[nodiscard]] bool _clip_line(int& x0, int& y0, int& x1, int& y1)
+    {
+        int outcode0 = _line_outcode(x0, y0);
+        int outcode1 = _line_outcode(x1, y1);
+
+        // Each endpoint is clipped at most twice (once per axis).
+        // If more clips are required, rounding made the line miss a corner, so it can be discarded:
+        for(int clips = 0; clips <= 4; ++clips)
+        {
+            if(! (outcode0 | outcode1))
+            {
+                return true;
+            }
+
+            if(outcode0 & outcode1)
+            {
+                return false;
+            }
+
+            int outcode = outcode0 ? outcode0 : outcode1;
+            int64_t delta_x = x1 - x0;
+            int64_t delta_y = y1 - y0;
+            int x;
+            int y;
+
+            if(outcode & 8)
+            {
+                y = data.height;
+                x = x0 + _line_rounded_division(delta_x * (y - y0), delta_y);
+            }
+            else if(outcode & 4)
+            {
+                y = -1;
+                x = x0 + _line_rounded_division(delta_x * (y - y0), delta_y);
+            }
+            else if(outcode & 2)
+            {
+                x = data.width;
+                y = y0 + _line_rounded_division(delta_y * (x - x0), delta_x);
+            }
+            else
+            {
+                x = -1;
+                y = y0 + _line_rounded_division(delta_y * (x - x0), delta_x);
+            }
+
+            if(outcode == outcode0)
+            {
+                x0 = x;
+                y0 = y;
+                outcode0 = _line_outcode(x0, y0);
+            }
+            else
+            {
+                x1 = x;
+                y1 = y;
+                outcode1 = _line_outcode(x1, y1);
+            }
+        }
+
+        return false;
+    }
+
+    void _release()
+    {
+        if(data.canvas)
+        {
+            memory::ewram_free(data.canvas);
+            data.canvas = nullptr;
+        }
+
+        _reset_dirty();
+        sprite_tiles_manager::decrease_usages(data.sprite_tiles_id);
+        data.sprite_tiles_id = -1;
+        data.flip_pending = false;
+        bgs_manager::set_bitmap_mode(0);
+        display_manager::set_bitmap_page(0);
+    }
+}
+
+int create(bitmap_bg_mode mode, bool optional)
+{
+    BN_ASSERT(! data.usages, "There's already a bitmap BG");
+    BN_ASSERT(! bg_blocks_manager::used_tiles_count() && ! bg_blocks_manager::used_map_cells_count(),
+              "BG tiles and maps can't be used with a bitmap BG: ",
+              bg_blocks_manager::used_tiles_count(), " - ", bg_blocks_manager::used_map_cells_count());
+
+    int sprite_tiles_id = sprite_tiles_manager::reserve_first_tiles(hw::bitmap_bg::reserved_sprite_tiles_count());
+
+    if(sprite_tiles_id < 0)
+    {
+        BN_ASSERT(optional, "Sprite tiles overlapped by the bitmap BG are in use");
+
+        return -1;
+    }
+
+    data.sprite_tiles_id = sprite_tiles_id;
+    data.mode = mode;
+
+    if(mode == bitmap_bg_mode::MODE_3)
+    {
+        int canvas_half_words = max_width * max_height;
+        data.canvas = static_cast<uint16_t*>(memory::ewram_alloc(canvas_half_words * 2));
+
+        if(! data.canvas)
+        {
+            _release();
+            BN_ASSERT(optional, "Not enough EWRAM for the bitmap BG canvas");
+
+            return -1;
+        }
+
+        hw::memory::set_half_words(0, canvas_half_words, data.canvas);
+    }
+
+    if(mode == bitmap_bg_mode::MODE_5)
+    {
+        data.width = 160;
+        data.height = 128;
+    }
+    else
+    {
+        data.width = max_width;
+        data.height = max_height;
+    }
+
+    hw::memory::set_half_words(0, hw::bitmap_bg::page_half_words() * 2, hw::bitmap_bg::page_vram(0));
+    data.dirty_first_y = 0;
+    data.dirty_last_y = max_height;
+    _reset_dirty();
+
+    data.usages = 1;
+    data.back_page = 1;
+    data.flip_pending = false;
+    bgs_manager::set_bitmap_mode(int(mode) + 3);
+    display_manager::set_bitmap_page(0);
+    return 0;
+}
+
+bool created()
+{
+    return data.usages;
+}
+
+void increase_usages([[maybe_unused]] int id)
+{
+    ++data.usages;
+}
+
+void decrease_usages([[maybe_unused]] int id)
+{
+    --data.usages;
+
+    if(! data.usages)
+    {
+        _release();
+    }
+}
+
+bitmap_bg_mode mode([[maybe_unused]] int id)
+{
+    return data.mode;
+}
+
+size dimensions([[maybe_unused]] int id)
+{
+    return size(data.width, data.height);
+}
+
+span<uint16_t> pixels([[maybe_unused]] int id)
+{
+    int half_words = data.width * data.height;
+
+    if(_bpp_8())
+    {
+        half_words /= 2;
+    }
+
+    return span<uint16_t>(_pixels_ptr(), half_words);
+}
+
+void set_dirty([[maybe_unused]] int id, const rect& dirty_rect)
+{
+    int x = dirty_rect.left();
+    int y = dirty_rect.top();
+    int width = dirty_rect.width();
+    int height = dirty_rect.height();
+
+    if(_clip(x, y, width, height))
+    {
+        _set_dirty(x, y, width, height);
+    }
+}
+
+void clear([[maybe_unused]] int id, unsigned value)
+{
+    if(_bpp_8())
+    {
+        hw::memory::set_half_words(uint16_t(value | (value << 8)), data.width * data.height / 2, _pixels_ptr());
+    }
+    else
+    {
+        hw::memory::set_half_words(uint16_t(value), data.width * data.height, _pixels_ptr());
+    }
+
+    _set_dirty(0, 0, data.width, data.height);
+}
+
+void fill_rect([[maybe_unused]] int id, const rect& fill_rect, unsigned value)
+{
+    int x = fill_rect.left();
+    int y = fill_rect.top();
+    int width = fill_rect.width();
+    int height = fill_rect.height();
+
+    if(_clip(x, y, width, height))
+    {
+        if(_bpp_8())
+        {
+            hw::bitmap_bg::fill_8(value, x, width, height, _pitch(), _row_ptr(y));
+        }
+        else
+        {
+            hw::bitmap_bg::fill_16(value, width, height, _pitch(), _row_ptr(y) + x);
+        }
+
+        _set_dirty(x, y, width, height);
+    }
+}
+
+void draw_line([[maybe_unused]] int id, const point& a, const point& b, unsigned value)
+{
+    int x0 = a.x();
+    int y0 = a.y();
+    int x1 = b.x();
+    int y1 = b.y();
+
+    if(! _clip_line(x0, y0, x1, y1))
+    {
+        return;
+    }
+
+    if(_bpp_8())
+    {
+        hw::bitmap_bg::line_8(value, x0, y0, x1, y1, data.width, data.height, _pitch(), _pixels_ptr());
+    }
+    else
+    {
+        hw::bitmap_bg::line_16(value, x0, y0, x1, y1, data.width, data.height, _pitch(), _pixels_ptr());
+    }
+
+    int x = min(x0, x1);
+    int y = min(y0, y1);
+    int width = max(x0, x1) - x + 1;
+    int height = max(y0, y1) - y + 1;
+
+    if(_clip(x, y, width, height))
+    {
+        _set_dirty(x, y, width, height);
+    }
+}
+
+void copy([[maybe_unused]] int id, const uint16_t* image_pixels, const size& image_dimensions,
+          const point& position)
+{
+    int x = position.x();
+    int y = position.y();
+    int width = image_dimensions.width();
+    int height = image_dimensions.height();
+
+    if(_clip(x, y, width, height))
+    {
+        int image_width = image_dimensions.width();
+        const uint16_t* source_ptr = image_pixels + ((y - position.y()) * image_width) + (x - position.x());
+        hw::bitmap_bg::copy_16(source_ptr, image_width, width, height, _pitch(), _row_ptr(y) + x);
+        _set_dirty(x, y, width, height);
+    }
+}
+
+void copy([[maybe_unused]] int id, const uint8_t* image_pixels, const size& image_dimensions,
+          const point& position)
+{
+    int x = position.x();
+    int y = position.y();
+    int width = image_dimensions.width();
+    int height = image_dimensions.height();
+
+    if(_clip(x, y, width, height))
+    {
+        int image_width = image_dimensions.width();
+        const uint8_t* source_ptr = image_pixels + ((y - position.y()) * image_width) + (x - position.x());
+        hw::bitmap_bg::copy_8(source_ptr, image_width, x, width, height, _pitch(), _row_ptr(y));
+        _set_dirty(x, y, width, height);
+    }
+}
+
+void scaled_copy([[maybe_unused]] int id, const uint16_t* image_pixels, const size& image_dimensions,
+                 const rect& destination_rect)
+{
+    int left = destination_rect.left();
+    int top = destination_rect.top();
+    int x = left;
+    int y = top;
+    int width = destination_rect.width();
+    int height = destination_rect.height();
+
+    if(_clip(x, y, width, height))
+    {
+        unsigned x_step = (unsigned(image_dimensions.width()) << 16) / unsigned(destination_rect.width());
+        unsigned y_step = (unsigned(image_dimensions.height()) << 16) / unsigned(destination_rect.height());
+        unsigned source_x = unsigned(x - left) * x_step;
+        unsigned source_y = unsigned(y - top) * y_step;
+        hw::bitmap_bg::scaled_copy_16(image_pixels, image_dimensions.width(), source_x, source_y, x_step, y_step,
+                                      width, height, _pitch(), _row_ptr(y) + x);
+        _set_dirty(x, y, width, height);
+    }
+}
+
+void scaled_copy([[maybe_unused]] int id, const uint8_t* image_pixels, const size& image_dimensions,
+                 const rect& destination_rect)
+{
+    int left = destination_rect.left();
+    int top = destination_rect.top();
+    int x = left;
+    int y = top;
+    int width = destination_rect.width();
+    int height = destination_rect.height();
+
+    if(_clip(x, y, width, height))
+    {
+        unsigned x_step = (unsigned(image_dimensions.width()) << 16) / unsigned(destination_rect.width());
+        unsigned y_step = (unsigned(image_dimensions.height()) << 16) / unsigned(destination_rect.height());
+        unsigned source_x = unsigned(x - left) * x_step;
+        unsigned source_y = unsigned(y - top) * y_step;
+        hw::bitmap_bg::scaled_copy_8(image_pixels, image_dimensions.width(), source_x, source_y, x_step, y_step,
+                                     x, width, height, _pitch(), _row_ptr(y));
+        _set_dirty(x, y, width, height);
+    }
+}
+
+bool flip_pending([[maybe_unused]] int id)
+{
+    return data.flip_pending;
+}
+
+void flip([[maybe_unused]] int id)
+{
+    BN_ASSERT(data.mode != bitmap_bg_mode::MODE_3, "MODE_3 bitmap BGs have only one page");
+
+    data.flip_pending = true;
+}
+
+void update()
+{
+    if(data.flip_pending)
+    {
+        data.flip_pending = false;
+        data.back_page ^= 1;
+        display_manager::set_bitmap_page(data.back_page ^ 1);
+    }
+}
+
+void commit(bool use_dma)
+{
+    if(data.dirty_first_y < data.dirty_last_y)
+    {
+        // A whole MODE_3 canvas doesn't fit in a VBlank, so big redraws are uploaded in several frames.
+        // Rows are visited round-robin from the last uploaded one, so rows modified every frame
+        // don't prevent the other dirty rows from being uploaded:
+        uint16_t* vram_ptr = hw::bitmap_bg::page_vram(0);
+        int remaining_pixels = BN_CFG_BGS_BITMAP_MAX_COMMITTED_PIXELS;
+        int first_y = data.dirty_first_y;
+        int last_y = data.dirty_last_y;
+        int rows = last_y - first_y;
+        int visited_rows = 0;
+        int y = data.commit_y;
+
+        if(y < first_y || y >= last_y)
+        {
+            y = first_y;
+        }
+
+        while(visited_rows < rows && remaining_pixels > 0)
+        {
+            int first_x = data.dirty_first_x[y];
+            int half_words = data.dirty_last_x[y] - first_x;
+
+            if(half_words > 0)
+            {
+                int offset = (y * max_width) + first_x;
+
+                if(use_dma)
+                {
+                    hw::dma::copy_half_words(data.canvas + offset, half_words, vram_ptr + offset);
+                }
+                else
+                {
+                    hw::memory::copy_half_words(data.canvas + offset, half_words, vram_ptr + offset);
+                }
+
+                remaining_pixels -= half_words;
+            }
+
+            _reset_dirty_row(y);
+            ++visited_rows;
+            ++y;
+
+            if(y == last_y)
+            {
+                y = first_y;
+            }
+        }
+
+        if(visited_rows < rows)
+        {
+            data.commit_y = y;
+        }
+        else
+        {
+            data.dirty_first_y = max_height;
+            data.dirty_last_y = 0;
+            data.commit_y = 0;
+        }
+    }
+}
+
+}
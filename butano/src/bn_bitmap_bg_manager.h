@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_BITMAP_BG_MANAGER_H
+#define BN_BITMAP_BG_MANAGER_H
+
+#include "bn_span.h"
+
+namespace bn
+{
+    class rect;
+    class size;
+    class point;
+    enum class bitmap_bg_mode : uint8_t;
+}
+
+namespace bn::bitmap_bg_manager
+{
+    [[nodiscard]] int create(bitmap_bg_mode mode, bool optional);
+
+    [[nodiscard]] bool created();
+
+    void increase_usages(int id);
+
+    void decrease_usages(int id);
+
+    [[nodiscard]] bitmap_bg_mode mode(int id);
+
+    [[nodiscard]] size dimensions(int id);
+
+    [[nodiscard]] span<uint16_t> pixels(int id);
+
+    void set_dirty(int id, const rect& dirty_rect);
+
+    void clear(int id, unsigned value);
+
+    void fill_rect(int id, const rect& fill_rect, unsigned value);
+
+    void draw_line(int id, const point& a, const point& b, unsigned value);
+
+    void copy(int id, const uint16_t* image_pixels, const size& image_dimensions, const point& position);
+
+    void copy(int id, const uint8_t* image_pixels, const size& image_dimensions, const point& position);
+
+    void scaled_copy(int id, const uint16_t* image_pixels, const size& image_dimensions,
+                     const rect& destination_rect);
+
+    void scaled_copy(int id, const uint8_t* image_pixels, const size& image_dimensions,
+                     const rect& destination_rect);
+
+    [[nodiscard]] bool flip_pending(int id);
+
+    void flip(int id);
+
+    void update();
+
+    void commit(bool use_dma);
+}
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_bitmap_bg_ptr.h"
+
+#include "bn_rect.h"
+#include "bn_bitmap_bg_manager.h"
+
+namespace bn
+{
+
+bitmap_bg_ptr bitmap_bg_ptr::create(bitmap_bg_mode mode)
+{
+    return bitmap_bg_ptr(bitmap_bg_manager::create(mode, false));
+}
+
+optional<bitmap_bg_ptr> bitmap_bg_ptr::create_optional(bitmap_bg_mode mode)
+{
+    int handle = bitmap_bg_manager::create(mode, true);
+    optional<bitmap_bg_ptr> result;
+
+    if(handle >= 0)
+    {
+        result = bitmap_bg_ptr(handle);
+    }
+
+    return result;
+}
+
+bitmap_bg_ptr::bitmap_bg_ptr(const bitmap_bg_ptr& other) :
+    bitmap_bg_ptr(other._handle)
+{
+    bitmap_bg_manager::increase_usages(_handle);
+}
+
+bitmap_bg_ptr& bitmap_bg_ptr::operator=(const bitmap_bg_ptr& other)
+{
+    if(_handle != other._handle)
+    {
+        if(_handle >= 0)
+        {
+            bitmap_bg_manager::decrease_usages(_handle);
+        }
+
+        _handle = other._handle;
+        bitmap_bg_manager::increase_usages(_handle);
+    }
+
+    return *this;
+}
+
+bitmap_bg_ptr::~bitmap_bg_ptr()
+{
+    if(_handle >= 0)
+    {
+        bitmap_bg_manager::decrease_usages(_handle);
+    }
+}
+
+bitmap_bg_mode bitmap_bg_ptr::mode() const
+{
+    return bitmap_bg_manager::mode(_handle);
+}
+
+size bitmap_bg_ptr::dimensions() const
+{
+    return bitmap_bg_manager::dimensions(_handle);
+}
+
+span<uint16_t> bitmap_bg_ptr::pixels()
+{
+    return bitmap_bg_manager::pixels(_handle);
+}
+
+void bitmap_bg_ptr::set_dirty(const rect& dirty_rect)
+{
+    bitmap_bg_manager::set_dirty(_handle, dirty_rect);
+}
+
+void bitmap_bg_ptr::clear(color color)
+{
+    BN_ASSERT(mode() != bitmap_bg_mode::MODE_4, "Color indexes must be used in MODE_4");
+
+    bitmap_bg_manager::clear(_handle, unsigned(color.data()));
+}
+
+void bitmap_bg_ptr::clear(int color_index)
+{
+    BN_ASSERT(mode() == bitmap_bg_mode::MODE_4, "Color indexes can be used in MODE_4 only");
+    BN_ASSERT(color_index >= 0 && color_index < 256, "Invalid color index: ", color_index);
+
+    bitmap_bg_manager::clear(_handle, unsigned(color_index));
+}
+
+void bitmap_bg_ptr::fill_rect(const rect& fill_rect, color color)
+{
+    BN_ASSERT(mode() != bitmap_bg_mode::MODE_4, "Color indexes must be used in MODE_4");
+
+    bitmap_bg_manager::fill_rect(_handle, fill_rect, unsigned(color.data()));
+}
+
+void bitmap_bg_ptr::fill_rect(const rect& fill_rect, int color_index)
+{
+    BN_ASSERT(mode() == bitmap_bg_mode::MODE_4, "Color indexes can be used in MODE_4 only");
+    BN_ASSERT(color_index >= 0 && color_index < 256, "Invalid color index: ", color_index);
+
+    bitmap_bg_manager::fill_rect(_handle, fill_rect, unsigned(color_index));
+}
+
+void bitmap_bg_ptr::draw_line(const point& a, const point& b, color color)
+{
+    BN_ASSERT(mode() != bitmap_bg_mode::MODE_4, "Color indexes must be used in MODE_4");
+
+    bitmap_bg_manager::draw_line(_handle, a, b, unsigned(color.data()));
+}
+
+void bitmap_bg_ptr::draw_line(const point& a, const point& b, int color_index)
+{
+    BN_ASSERT(mode() == bitmap_bg_mode::MODE_4, "Color indexes can be used in MODE_4 only");
+    BN_ASSERT(color_index >= 0 && color_index < 256, "Invalid color index: ", color_index);
+
+    bitmap_bg_manager::draw_line(_handle, a, b, unsigned(color_index));
+}
+
+void bitmap_bg_ptr::copy(const span<const color>& image_pixels, const size& image_dimensions,
+                         const point& position)
+{
+    BN_ASSERT(mode() != bitmap_bg_mode::MODE_4, "Color indexes must be used in MODE_4");
+    BN_ASSERT(image_dimensions.width() > 0 && image_dimensions.height() > 0,
+              "Invalid image dimensions: ", image_dimensions.width(), " - ", image_dimensions.height());
+    BN_ASSERT(image_pixels.size() >= image_dimensions.width() * image_dimensions.height(),
+              "Invalid image pixels count: ", image_pixels.size(), " - ",
+              image_dimensions.width() * image_dimensions.height());
+
+    bitmap_bg_manager::copy(_handle, reinterpret_cast<const uint16_t*>(image_pixels.data()), image_dimensions,
+                            position);
+}
+
+void bitmap_bg_ptr::copy(const span<const uint8_t>& image_pixels, const size& image_dimensions,
+                         const point& position)
+{
+    BN_ASSERT(mode() == bitmap_bg_mode::MODE_4, "Color indexes can be used in MODE_4 only");
+    BN_ASSERT(image_dimensions.width() > 0 && image_dimensions.height() > 0,
+              "Invalid image dimensions: ", image_dimensions.width(), " - ", image_dimensions.height());
+    BN_ASSERT(image_pixels.size() >= image_dimensions.width() * image_dimensions.height(),
+              "Invalid image pixels count: ", image_pixels.size(), " - ",
+              image_dimensions.width() * image_dimensions.height());
+
+    bitmap_bg_manager::copy(_handle, image_pixels.data(), image_dimensions, position);
+}
+
+void bitmap_bg_ptr::scaled_copy(const span<const color>& image_pixels, const size& image_dimensions,
+                                const rect& destination_rect)
+{
+    BN_ASSERT(mode() != bitmap_bg_mode::MODE_4, "Color indexes must be used in MODE_4");
+    BN_ASSERT(image_dimensions.width() > 0 && image_dimensions.height() > 0,
+              "Invalid image dimensions: ", image_dimensions.width(), " - ", image_dimensions.height());
+    BN_ASSERT(image_pixels.size() >= image_dimensions.width() * image_dimensions.height(),
+              "Invalid image pixels count: ", image_pixels.size(), " - ",
+              image_dimensions.width() * image_dimensions.height());
+
+    bitmap_bg_manager::scaled_copy(_handle, reinterpret_cast<const uint16_t*>(image_pixels.data()),
+                                   image_dimensions, destination_rect);
+}
+
+void bitmap_bg_ptr::scaled_copy(const span<const uint8_t>& image_pixels, const size& image_dimensions,
+                                const rect& destination_rect)
+{
+    BN_ASSERT(mode() == bitmap_bg_mode::MODE_4, "Color indexes can be used in MODE_4 only");
+    BN_ASSERT(image_dimensions.width() > 0 && image_dimensions.height() > 0,
+              "Invalid image dimensions: ", image_dimensions.width(), " - ", image_dimensions.height());
+    BN_ASSERT(image_pixels.size() >= image_dimensions.width() * image_dimensions.height(),
+              "Invalid image pixels count: ", image_pixels.size(), " - ",
+              image_dimensions.width() * image_dimensions.height());
+
+    bitmap_bg_manager::scaled_copy(_handle, image_pixels.data(), image_dimensions, destination_rect);
+}
+
+bool bitmap_bg_ptr::flip_pending() const
+{
+    return bitmap_bg_manager::flip_pending(_handle);
+}
+
+void bitmap_bg_ptr::flip()
+{
+    bitmap_bg_manager::flip(_handle);
+}
+
+}
@@ -10,6 +10,7 @@
 #include "bn_keypad.h"
 #include "bn_timers.h"
 #include "bn_version.h"
+#include "bn_function.h"
 #include "bn_profiler.h"
 #include "bn_system_font.h"
 #include "bn_bgs_manager.h"
@@ -24,6 +25,7 @@
 #include "bn_cameras_manager.h"
 #include "bn_palettes_manager.h"
 #include "bn_bg_blocks_manager.h"
+#include "bn_bitmap_bg_manager.h"
 #include "bn_sprite_tiles_manager.h"
 #include "bn_hblank_effects_manager.h"
 #include "../hw/include/bn_hw_irq.h"
@@ -112,6 +114,7 @@ namespace
 
     public:
         vblank_callback_type vblank_callback = nullptr;
+        vblank_function_type vblank_function;
         timer cpu_usage_timer;
         ticks last_ticks;
         bn::system_font system_font;
@@ -198,6 +201,10 @@ namespace
         palettes_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
+        BN_PROFILER_ENGINE_DETAILED_START("eng_bitmap_bg_update");
+        bitmap_bg_manager::update();
+        BN_PROFILER_ENGINE_DETAILED_STOP();
+
         BN_PROFILER_ENGINE_DETAILED_START("eng_display_update");
         display_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
@@ -265,11 +272,19 @@ namespace
         bg_blocks_manager::commit();
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
+        BN_PROFILER_ENGINE_DETAILED_START("eng_bitmap_bg_commit");
+        bitmap_bg_manager::commit(use_dma);
+        BN_PROFILER_ENGINE_DETAILED_STOP();
+
         BN_PROFILER_ENGINE_DETAILED_START("eng_vblank_callback");
         if(vblank_callback_type vblank_callback = data.vblank_callback)
         {
             vblank_callback();
         }
+        else if(data.vblank_function)
+        {
+            data.vblank_function();
+        }
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
         result.vblank_usage_ticks = data.cpu_usage_timer.elapsed_ticks();
@@ -295,6 +310,11 @@ void init()
 
 void init(const string_view& keypad_commands)
 {
+    #if BN_CFG_STACK_IWRAM_PAINTING_ENABLED
+        // Paint stack before enabling interrupts:
+        memory_manager::paint_stack_iwram();
+    #endif
+
     // Init irq system:
     hw::irq::init();
     hw::irq::set_isr(hw::irq::id::HBLANK, hw::hblank_effects::_intr);
@@ -378,6 +398,12 @@ void update()
     BN_PROFILER_ENGINE_DETAILED_START("eng_keypad");
     keypad_manager::update();
     BN_PROFILER_ENGINE_DETAILED_STOP();
+
+    memory_manager::reset_frame_arenas();
+
+    #if BN_CFG_STACK_IWRAM_PAINTING_ENABLED
+        memory_manager::update_stack_iwram();
+    #endif
 }
 
 void on_vblank()
@@ -473,6 +499,13 @@ vblank_callback_type vblank_callback()
 void set_vblank_callback(vblank_callback_type vblank_callback)
 {
     data.vblank_callback = vblank_callback;
+    data.vblank_function.reset();
+}
+
+void set_vblank_callback(const ifunction<void()>& vblank_callback)
+{
+    data.vblank_callback = nullptr;
+    data.vblank_function = vblank_callback;
 }
 
 bool slow_game_pak()
@@ -30,6 +30,7 @@ namespace
 
     public:
         int mode = 0;
+        int bitmap_page = 0;
         bool enabled_bgs[hw::bgs::count()] = {};
         fixed sprites_mosaic_horizontal_stretch;
         fixed sprites_mosaic_vertical_stretch;
@@ -133,6 +134,16 @@ void set_mode(int mode)
     }
 }
 
+void set_bitmap_page(int page)
+{
+    if(data.bitmap_page != page)
+    {
+        data.bitmap_page = page;
+        data.commit_display = true;
+        data.commit = true;
+    }
+}
+
 bool bg_enabled(int bg)
 {
     return data.enabled_bgs[bg];
@@ -830,7 +841,8 @@ void update()
     {
         if(data.commit_display)
         {
-            hw::display::set_display(data.mode, data.enabled_bgs, data.inside_windows_enabled, data.display_cnt);
+            hw::display::set_display(data.mode, data.bitmap_page, data.enabled_bgs, data.inside_windows_enabled,
+                                     data.display_cnt);
         }
 
         if(data.commit_mosaic)
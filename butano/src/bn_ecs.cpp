@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_ecs.h"
+
+#include "bn_sprite_ptr.h"
+#include "bn_fixed_point.h"
+
+namespace bn::ecs
+{
+
+void set_sprite_positions(const icomponent_set<fixed_point>& positions, icomponent_set<sprite_ptr>& sprites)
+{
+    for_each([](entity, const fixed_point& position, sprite_ptr& sprite)
+    {
+        sprite.set_position(position);
+    }, positions, sprites);
+}
+
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_frame_arena.h"
+
+#include "bn_memory_manager.h"
+
+namespace bn::frame_arena
+{
+
+void* ewram_alloc(int bytes)
+{
+    return memory_manager::frame_arena_ewram_alloc(bytes);
+}
+
+void* iwram_alloc(int bytes)
+{
+    return memory_manager::frame_arena_iwram_alloc(bytes);
+}
+
+int used_ewram()
+{
+    return memory_manager::used_frame_arena_ewram();
+}
+
+int available_ewram()
+{
+    return memory_manager::available_frame_arena_ewram();
+}
+
+int used_iwram()
+{
+    return memory_manager::used_frame_arena_iwram();
+}
+
+int available_iwram()
+{
+    return memory_manager::available_frame_arena_iwram();
+}
+
+}
@@ -19,6 +19,7 @@
 #include "bn_regular_bg_attributes_hbe_handler.h"
 #include "bn_affine_bg_attributes_hbe_handler.h"
 #include "bn_regular_bg_horizontal_position_hbe_handler.h"
+#include "bn_regular_bg_horizontal_parallax_hbe_handler.h"
 #include "bn_affine_bg_pivot_horizontal_position_hbe_handler.h"
 #include "bn_regular_bg_vertical_position_hbe_handler.h"
 #include "bn_affine_bg_pivot_vertical_position_hbe_handler.h"
@@ -125,6 +126,9 @@ namespace
         case handler_type::REGULAR_BG_HORIZONTAL_POSITION:
             return false;
 
+        case handler_type::REGULAR_BG_HORIZONTAL_PARALLAX:
+            return false;
+
         case handler_type::AFFINE_BG_PIVOT_HORIZONTAL_POSITION:
             return true;
 
@@ -305,6 +309,10 @@ namespace
                 regular_bg_horizontal_position_hbe_handler::setup_target(target_id, target_last_value);
                 break;
 
+            case handler_type::REGULAR_BG_HORIZONTAL_PARALLAX:
+                regular_bg_horizontal_parallax_hbe_handler::setup_target(target_id, target_last_value);
+                break;
+
             case handler_type::AFFINE_BG_PIVOT_HORIZONTAL_POSITION:
                 affine_bg_pivot_horizontal_position_hbe_handler::setup_target(target_id, target_last_value);
                 break;
@@ -472,6 +480,9 @@ namespace
             case handler_type::REGULAR_BG_HORIZONTAL_POSITION:
                 return _check_update_impl<regular_bg_horizontal_position_hbe_handler>(updated);
 
+            case handler_type::REGULAR_BG_HORIZONTAL_PARALLAX:
+                return _check_update_impl<regular_bg_horizontal_parallax_hbe_handler>(updated);
+
             case handler_type::AFFINE_BG_PIVOT_HORIZONTAL_POSITION:
                 return _check_update_impl<affine_bg_pivot_horizontal_position_hbe_handler>(updated);
 
@@ -647,6 +658,10 @@ namespace
                 regular_bg_horizontal_position_hbe_handler::show(target_id);
                 break;
 
+            case handler_type::REGULAR_BG_HORIZONTAL_PARALLAX:
+                regular_bg_horizontal_parallax_hbe_handler::show(target_id);
+                break;
+
             case handler_type::AFFINE_BG_PIVOT_HORIZONTAL_POSITION:
                 affine_bg_pivot_horizontal_position_hbe_handler::show(target_id);
                 break;
@@ -822,6 +837,10 @@ namespace
                 regular_bg_horizontal_position_hbe_handler::cleanup(target_id);
                 break;
 
+            case handler_type::REGULAR_BG_HORIZONTAL_PARALLAX:
+                regular_bg_horizontal_parallax_hbe_handler::cleanup(target_id);
+                break;
+
             case handler_type::AFFINE_BG_PIVOT_HORIZONTAL_POSITION:
                 affine_bg_pivot_horizontal_position_hbe_handler::cleanup(target_id);
                 break;
@@ -23,6 +23,7 @@ namespace bn::hblank_effects_manager
         REGULAR_BG_ATTRIBUTES,
         AFFINE_BG_ATTRIBUTES,
         REGULAR_BG_HORIZONTAL_POSITION,
+        REGULAR_BG_HORIZONTAL_PARALLAX,
         AFFINE_BG_PIVOT_HORIZONTAL_POSITION,
         REGULAR_BG_VERTICAL_POSITION,
         AFFINE_BG_PIVOT_VERTICAL_POSITION,
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_iwram_overlay.h"
+
+#include "bn_assert.h"
+
+namespace bn::iwram_overlay
+{
+
+namespace
+{
+    class static_data
+    {
+
+    public:
+        optional<int> loaded_id;
+    };
+
+    BN_DATA_EWRAM static_data data;
+}
+
+int window_size()
+{
+    return hw::iwram_overlay::window_size();
+}
+
+int size(int id)
+{
+    BN_ASSERT(id >= 0 && id < count(), "Invalid id: ", id);
+
+    return hw::iwram_overlay::size(id);
+}
+
+optional<int> loaded_id()
+{
+    return data.loaded_id;
+}
+
+void load(int id)
+{
+    BN_ASSERT(id >= 0 && id < count(), "Invalid id: ", id);
+
+    if(data.loaded_id != id)
+    {
+        hw::iwram_overlay::load(id);
+        data.loaded_id = id;
+    }
+}
+
+}
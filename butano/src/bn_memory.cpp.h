@@ -120,13 +120,30 @@ int available_alloc_ewram()
     {
         memory_manager::log_alloc_ewram_status();
     }
+
+    void log_alloc_ewram_stats()
+    {
+        memory_manager::log_alloc_ewram_stats();
+    }
 #endif
 
+allocator_stats alloc_ewram_stats()
+{
+    return memory_manager::alloc_ewram_stats();
+}
+
 int used_stack_iwram()
 {
     return hw::memory::used_stack_iwram(hw::memory::stack_address());
 }
 
+#if BN_CFG_STACK_IWRAM_PAINTING_ENABLED
+    int max_used_stack_iwram()
+    {
+        return memory_manager::max_used_stack_iwram();
+    }
+#endif
+
 int used_static_iwram()
 {
     return hw::memory::used_static_iwram();
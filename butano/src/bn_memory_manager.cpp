@@ -5,26 +5,98 @@
 
 #include "bn_memory_manager.h"
 
-#include "bn_best_fit_allocator.h"
+#include "bn_algorithm.h"
+#include "bn_config_ewram.h"
+#include "bn_config_frame_arena.h"
 #include "../hw/include/bn_hw_memory.h"
 
+#if BN_CFG_EWRAM_ALLOCATOR == BN_EWRAM_ALLOCATOR_TLSF
+    #include "bn_tlsf_allocator.h"
+#else
+    #include "bn_best_fit_allocator.h"
+#endif
+
+#if BN_CFG_LOG_ENABLED
+    #include "bn_log.h"
+#endif
+
+#if BN_CFG_EWRAM_ALLOC_FAILURES_LOG_ENABLED
+    static_assert(BN_CFG_LOG_ENABLED, "Log is not enabled");
+#endif
+
+#if BN_CFG_STACK_IWRAM_MAX_USED_BYTES > 0
+    static_assert(BN_CFG_STACK_IWRAM_PAINTING_ENABLED, "Stack painting is not enabled");
+#endif
+
 #include "bn_memory.cpp.h"
 #include "bn_cstdlib.cpp.h"
 #include "bn_cstring.cpp.h"
+#include "bn_frame_arena.cpp.h"
 
 namespace bn::memory_manager
 {
 
 namespace
 {
+    static_assert(BN_CFG_EWRAM_ALLOCATOR == BN_EWRAM_ALLOCATOR_BEST_FIT ||
+            BN_CFG_EWRAM_ALLOCATOR == BN_EWRAM_ALLOCATOR_TLSF);
+
+    #if BN_CFG_EWRAM_ALLOCATOR == BN_EWRAM_ALLOCATOR_TLSF
+        using allocator_type = tlsf_allocator;
+    #else
+        using allocator_type = best_fit_allocator;
+    #endif
+
+
+    static_assert(BN_CFG_FRAME_ARENA_EWRAM_BYTES >= 0 && BN_CFG_FRAME_ARENA_EWRAM_BYTES % 4 == 0);
+    static_assert(BN_CFG_FRAME_ARENA_IWRAM_BYTES >= 0 && BN_CFG_FRAME_ARENA_IWRAM_BYTES % 4 == 0);
+
+    constexpr int frame_arena_ewram_bytes = BN_CFG_FRAME_ARENA_EWRAM_BYTES;
+    constexpr int frame_arena_iwram_bytes = BN_CFG_FRAME_ARENA_IWRAM_BYTES;
+
+
     class static_data
     {
 
     public:
-        best_fit_allocator allocator;
+        allocator_type allocator;
+        int frame_arena_ewram[max(frame_arena_ewram_bytes / 4, 1)];
+        int frame_arena_ewram_used_bytes = 0;
+        int frame_arena_iwram_used_bytes = 0;
+
+        #if BN_CFG_STACK_IWRAM_PAINTING_ENABLED
+            int max_used_stack_iwram = 0;
+        #endif
     };
 
     BN_DATA_EWRAM static_data data;
+
+    int frame_arena_iwram[max(frame_arena_iwram_bytes / 4, 1)];
+
+
+    [[nodiscard]] void* _frame_arena_alloc(int bytes, int arena_bytes, int& used_bytes, int* arena)
+    {
+        BN_ASSERT(bytes >= 0, "Invalid bytes: ", bytes);
+
+        int old_used_bytes = used_bytes;
+        int new_used_bytes = old_used_bytes + ((bytes + 3) & ~3);
+
+        if(new_used_bytes > arena_bytes)
+        {
+            return nullptr;
+        }
+
+        used_bytes = new_used_bytes;
+        return reinterpret_cast<uint8_t*>(arena) + old_used_bytes;
+    }
+
+    #if BN_CFG_EWRAM_ALLOC_FAILURES_LOG_ENABLED
+        void _log_alloc_failure(int bytes)
+        {
+            BN_LOG("EWRAM alloc failed: ", bytes, " bytes");
+            log_alloc_ewram_stats();
+        }
+    #endif
 }
 
 void init()
@@ -36,17 +108,44 @@ void init()
 
 void* ewram_alloc(int bytes)
 {
-    return data.allocator.alloc(bytes);
+    void* result = data.allocator.alloc(bytes);
+
+    #if BN_CFG_EWRAM_ALLOC_FAILURES_LOG_ENABLED
+        if(! result)
+        {
+            _log_alloc_failure(bytes);
+        }
+    #endif
+
+    return result;
 }
 
 void* ewram_calloc(int num, int bytes)
 {
-    return data.allocator.calloc(num, bytes);
+    void* result = data.allocator.calloc(num, bytes);
+
+    #if BN_CFG_EWRAM_ALLOC_FAILURES_LOG_ENABLED
+        if(! result)
+        {
+            _log_alloc_failure(num * bytes);
+        }
+    #endif
+
+    return result;
 }
 
 void* ewram_realloc(void* ptr, int new_bytes)
 {
-    return data.allocator.realloc(ptr, new_bytes);
+    void* result = data.allocator.realloc(ptr, new_bytes);
+
+    #if BN_CFG_EWRAM_ALLOC_FAILURES_LOG_ENABLED
+        if(! result)
+        {
+            _log_alloc_failure(new_bytes);
+        }
+    #endif
+
+    return result;
 }
 
 void ewram_free(void* ptr)
@@ -64,11 +163,106 @@ int available_alloc_ewram()
     return data.allocator.available_bytes();
 }
 
+allocator_stats alloc_ewram_stats()
+{
+    return data.allocator.stats();
+}
+
+void* frame_arena_ewram_alloc(int bytes)
+{
+    return _frame_arena_alloc(bytes, frame_arena_ewram_bytes, data.frame_arena_ewram_used_bytes,
+                              data.frame_arena_ewram);
+}
+
+void* frame_arena_iwram_alloc(int bytes)
+{
+    return _frame_arena_alloc(bytes, frame_arena_iwram_bytes, data.frame_arena_iwram_used_bytes,
+                              frame_arena_iwram);
+}
+
+int used_frame_arena_ewram()
+{
+    return data.frame_arena_ewram_used_bytes;
+}
+
+int available_frame_arena_ewram()
+{
+    return frame_arena_ewram_bytes - data.frame_arena_ewram_used_bytes;
+}
+
+int used_frame_arena_iwram()
+{
+    return data.frame_arena_iwram_used_bytes;
+}
+
+int available_frame_arena_iwram()
+{
+    return frame_arena_iwram_bytes - data.frame_arena_iwram_used_bytes;
+}
+
+void reset_frame_arenas()
+{
+    data.frame_arena_ewram_used_bytes = 0;
+    data.frame_arena_iwram_used_bytes = 0;
+}
+
+#if BN_CFG_STACK_IWRAM_PAINTING_ENABLED
+    void paint_stack_iwram()
+    {
+        hw::memory::paint_stack_iwram(hw::memory::stack_address());
+        data.max_used_stack_iwram = 0;
+    }
+
+    void update_stack_iwram()
+    {
+        int max_used_stack_iwram = hw::memory::max_used_stack_iwram(data.max_used_stack_iwram);
+        data.max_used_stack_iwram = max_used_stack_iwram;
+
+        #if BN_CFG_STACK_IWRAM_MAX_USED_BYTES > 0
+            BN_ASSERT(max_used_stack_iwram <= BN_CFG_STACK_IWRAM_MAX_USED_BYTES,
+                      "Max used IWRAM stack exceeded: ", max_used_stack_iwram, " - ",
+                      BN_CFG_STACK_IWRAM_MAX_USED_BYTES);
+        #endif
+    }
+
+    int max_used_stack_iwram()
+    {
+        return data.max_used_stack_iwram;
+    }
+#endif
+
 #if BN_CFG_LOG_ENABLED
     void log_alloc_ewram_status()
     {
         data.allocator.log_status();
     }
+
+    void log_alloc_ewram_stats()
+    {
+        allocator_stats stats = data.allocator.stats();
+        BN_LOG("used_bytes: ", stats.used_bytes());
+        BN_LOG("available_bytes: ", stats.available_bytes());
+        BN_LOG("peak_used_bytes: ", stats.peak_used_bytes());
+        BN_LOG("largest_free_bytes: ", stats.largest_free_bytes());
+        BN_LOG("free_items_count: ", stats.free_items_count());
+        BN_LOG("alloc_count: ", stats.alloc_count());
+        BN_LOG("failed_alloc_count: ", stats.failed_alloc_count());
+        BN_LOG("free_count: ", stats.free_count());
+        BN_LOG("alloc_ticks: ", stats.alloc_ticks());
+        BN_LOG("alloc_bytes_histogram: ");
+        BN_LOG('[');
+
+        span<const int> histogram = stats.alloc_bytes_histogram();
+
+        for(int index = 0, limit = histogram.size() - 1; index < limit; ++index)
+        {
+            BN_LOG("    <= ", 8 << index, " bytes: ", histogram[index]);
+        }
+
+        BN_LOG("    > ", 8 << (histogram.size() - 2), " bytes: ", histogram.back());
+
+        BN_LOG(']');
+    }
 #endif
 
 }
@@ -7,6 +7,12 @@
 #define BN_MEMORY_MANAGER_H
 
 #include "bn_config_log.h"
+#include "bn_config_stack.h"
+
+namespace bn
+{
+    class allocator_stats;
+}
 
 namespace bn::memory_manager
 {
@@ -24,8 +30,34 @@ namespace bn::memory_manager
 
     [[nodiscard]] int available_alloc_ewram();
 
+    [[nodiscard]] allocator_stats alloc_ewram_stats();
+
+    [[nodiscard]] void* frame_arena_ewram_alloc(int bytes);
+
+    [[nodiscard]] void* frame_arena_iwram_alloc(int bytes);
+
+    [[nodiscard]] int used_frame_arena_ewram();
+
+    [[nodiscard]] int available_frame_arena_ewram();
+
+    [[nodiscard]] int used_frame_arena_iwram();
+
+    [[nodiscard]] int available_frame_arena_iwram();
+
+    void reset_frame_arenas();
+
+    #if BN_CFG_STACK_IWRAM_PAINTING_ENABLED
+        void paint_stack_iwram();
+
+        void update_stack_iwram();
+
+        [[nodiscard]] int max_used_stack_iwram();
+    #endif
+
     #if BN_CFG_LOG_ENABLED
         void log_alloc_ewram_status();
+
+        void log_alloc_ewram_stats();
     #endif
 }
 
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_REGULAR_BG_HORIZONTAL_PARALLAX_HBE_HANDLER_H
+#define BN_REGULAR_BG_HORIZONTAL_PARALLAX_HBE_HANDLER_H
+
+#include "bn_any.h"
+#include "bn_camera_ptr.h"
+#include "bn_fixed_point.h"
+#include "bn_bgs_manager.h"
+#include "../hw/include/bn_hw_bgs.h"
+
+namespace bn
+{
+
+class regular_bg_horizontal_parallax_hbe_handler
+{
+
+public:
+    static void setup_target(intptr_t, iany& target_last_value)
+    {
+        target_last_value = pair<int, int>();
+    }
+
+    [[nodiscard]] static bool target_visible(intptr_t target_id)
+    {
+        auto handle = reinterpret_cast<void*>(target_id);
+        return bgs_manager::hw_id(handle) >= 0;
+    }
+
+    [[nodiscard]] static bool target_updated(intptr_t target_id, iany& target_last_value)
+    {
+        pair<int, int>& last_value = target_last_value.value<pair<int, int>>();
+        auto handle = reinterpret_cast<void*>(target_id);
+        const optional<camera_ptr>& camera = bgs_manager::camera(handle);
+        pair<int, int> new_value(bgs_manager::hw_position(handle).x(), camera ? camera->x().data() : 0);
+        bool updated = last_value != new_value;
+        last_value = new_value;
+        return updated;
+    }
+
+    [[nodiscard]] static uint16_t* output_register(intptr_t target_id)
+    {
+        auto handle = reinterpret_cast<void*>(target_id);
+        return hw::bgs::regular_horizontal_position_register(bgs_manager::hw_id(handle));
+    }
+
+    static void write_output_values(intptr_t target_id, const iany&, const void* input_values_ptr,
+                                    uint16_t* output_values_ptr)
+    {
+        auto handle = reinterpret_cast<void*>(target_id);
+        auto fixed_values_ptr = reinterpret_cast<const fixed*>(input_values_ptr);
+        bgs_manager::fill_hblank_effect_regular_horizontal_parallax_positions(
+                    handle, fixed_values_ptr, output_values_ptr);
+    }
+
+    static void show(intptr_t)
+    {
+    }
+
+    static void cleanup(intptr_t)
+    {
+        bgs_manager::reload();
+    }
+};
+
+}
+
+#endif
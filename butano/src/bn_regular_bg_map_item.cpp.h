@@ -7,7 +7,9 @@
 
 #include "bn_bg_palette_ptr.h"
 #include "bn_regular_bg_map_ptr.h"
+#include "bn_memory.h"
 #include "bn_regular_bg_tiles_ptr.h"
+#include "../hw/include/bn_hw_memory.h"
 #include "../hw/include/bn_hw_decompress.h"
 
 namespace bn
@@ -26,6 +28,37 @@ regular_bg_map_item regular_bg_map_item::decompress(regular_bg_map_cell& decompr
 
     regular_bg_map_item result = *this;
 
+    if(chunked())
+    {
+        int width = _dimensions.width();
+        int chunks_x = width / chunk_size();
+        int chunks_y = _dimensions.height() / chunk_size();
+        auto chunk_cells_ptr = static_cast<regular_bg_map_cell*>(memory::ewram_alloc(chunk_cells() * 2));
+        BN_ASSERT(chunk_cells_ptr, "Chunk allocation failed");
+
+        for(int chunk_y = 0; chunk_y < chunks_y; ++chunk_y)
+        {
+            for(int chunk_x = 0; chunk_x < chunks_x; ++chunk_x)
+            {
+                decompress_chunk(chunk_x, chunk_y, *chunk_cells_ptr);
+
+                regular_bg_map_cell* dest_cells_ptr = &decompressed_cells_ref +
+                        (chunk_y * chunk_size() * width) + (chunk_x * chunk_size());
+
+                for(int row = 0; row < chunk_size(); ++row)
+                {
+                    hw::memory::copy_half_words(chunk_cells_ptr + (row * chunk_size()), chunk_size(),
+                                                dest_cells_ptr + (row * width));
+                }
+            }
+        }
+
+        memory::ewram_free(chunk_cells_ptr);
+        result._cells_ptr = &decompressed_cells_ref;
+        result._compression = compression_type::NONE;
+        return result;
+    }
+
     switch(_compression)
     {
 
@@ -58,6 +91,39 @@ regular_bg_map_item regular_bg_map_item::decompress(regular_bg_map_cell& decompr
     return result;
 }
 
+void regular_bg_map_item::decompress_chunk(int chunk_x, int chunk_y,
+                                           regular_bg_map_cell& decompressed_cells_ref) const
+{
+    int chunks_x = _dimensions.width() / chunk_size();
+    BN_ASSERT(chunked(), "Map is not chunked");
+    BN_ASSERT(chunk_x >= 0 && chunk_x < chunks_x, "Invalid chunk x: ", chunk_x, " - ", chunks_x);
+    BN_ASSERT(chunk_y >= 0 && chunk_y < _dimensions.height() / chunk_size(), "Invalid chunk y: ", chunk_y);
+    BN_ASSERT(aligned<4>(&decompressed_cells_ref), "Destination map cells are not aligned");
+
+    auto chunk_offsets = reinterpret_cast<const unsigned*>(_cells_ptr);
+    auto chunk_data = reinterpret_cast<const uint8_t*>(_cells_ptr) + chunk_offsets[(chunk_y * chunks_x) + chunk_x];
+
+    switch(_compression)
+    {
+
+    case compression_type::LZ77:
+        hw::decompress::lz77_wram(chunk_data, &decompressed_cells_ref);
+        break;
+
+    case compression_type::RUN_LENGTH:
+        hw::decompress::rl_wram(chunk_data, &decompressed_cells_ref);
+        break;
+
+    case compression_type::HUFFMAN:
+        hw::decompress::huff(chunk_data, &decompressed_cells_ref);
+        break;
+
+    default:
+        BN_ERROR("Unknown compression type: ", int(_compression));
+        break;
+    }
+}
+
 optional<regular_bg_map_ptr> regular_bg_map_item::find_map(
         const regular_bg_tiles_ptr& tiles, const bg_palette_ptr& palette) const
 {
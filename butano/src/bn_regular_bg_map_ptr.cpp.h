@@ -251,6 +251,16 @@ void regular_bg_map_ptr::reload_cells_ref()
     bg_blocks_manager::reload(_handle);
 }
 
+void regular_bg_map_ptr::set_cell(int map_x, int map_y, regular_bg_map_cell cell)
+{
+    bg_blocks_manager::set_regular_map_cell(_handle, map_x, map_y, cell);
+}
+
+void regular_bg_map_ptr::set_cells(const rect& cells_rect, const span<const regular_bg_map_cell>& cells)
+{
+    bg_blocks_manager::set_regular_map_cells(_handle, cells_rect, cells);
+}
+
 const regular_bg_tiles_ptr& regular_bg_map_ptr::tiles() const
 {
     return bg_blocks_manager::regular_map_tiles(_handle);
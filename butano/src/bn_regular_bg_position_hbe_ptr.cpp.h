@@ -57,6 +57,29 @@ optional<regular_bg_position_hbe_ptr> regular_bg_position_hbe_ptr::create_vertic
     return result;
 }
 
+regular_bg_position_hbe_ptr regular_bg_position_hbe_ptr::create_horizontal_parallax(
+        regular_bg_ptr bg, const span<const fixed>& factors_ref)
+{
+    int id = hblank_effects_manager::create(factors_ref.data(), factors_ref.size(), intptr_t(bg.handle()),
+                                            hblank_effects_manager::handler_type::REGULAR_BG_HORIZONTAL_PARALLAX);
+    return regular_bg_position_hbe_ptr(id, move(bg));
+}
+
+optional<regular_bg_position_hbe_ptr> regular_bg_position_hbe_ptr::create_horizontal_parallax_optional(
+        regular_bg_ptr bg, const span<const fixed>& factors_ref)
+{
+    int id = hblank_effects_manager::create_optional(factors_ref.data(), factors_ref.size(), intptr_t(bg.handle()),
+                                                     hblank_effects_manager::handler_type::REGULAR_BG_HORIZONTAL_PARALLAX);
+    optional<regular_bg_position_hbe_ptr> result;
+
+    if(id >= 0)
+    {
+        result = regular_bg_position_hbe_ptr(id, move(bg));
+    }
+
+    return result;
+}
+
 span<const fixed> regular_bg_position_hbe_ptr::deltas_ref() const
 {
     auto values_ptr = reinterpret_cast<const fixed*>(hblank_effects_manager::values_ref(id()));
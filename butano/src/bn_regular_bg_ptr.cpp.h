@@ -432,6 +432,16 @@ void regular_bg_ptr::remove_camera()
     bgs_manager::remove_camera(_handle);
 }
 
+const fixed_point& regular_bg_ptr::camera_factor() const
+{
+    return bgs_manager::camera_factor(_handle);
+}
+
+void regular_bg_ptr::set_camera_factor(const fixed_point& camera_factor)
+{
+    bgs_manager::set_regular_camera_factor(_handle, camera_factor);
+}
+
 regular_bg_attributes regular_bg_ptr::attributes() const
 {
     return bgs_manager::regular_attributes(_handle);
@@ -39,6 +39,15 @@ regular_bg_tiles_ptr regular_bg_tiles_ptr::allocate(int tiles_count, bpp_mode bp
     return regular_bg_tiles_ptr(bg_blocks_manager::allocate_regular_tiles(tiles_count, bpp, false));
 }
 
+#if BN_CFG_BG_BLOCKS_MAX_STREAMED_TILES
+    regular_bg_tiles_ptr regular_bg_tiles_ptr::create_streamed(const span<const tile>& tiles_pool, bpp_mode bpp,
+                                                               int cache_tiles_count)
+    {
+        return regular_bg_tiles_ptr(bg_blocks_manager::create_streamed_regular_tiles(tiles_pool, bpp,
+                                                                                     cache_tiles_count));
+    }
+#endif
+
 optional<regular_bg_tiles_ptr> regular_bg_tiles_ptr::create_optional(const regular_bg_tiles_item& tiles_item)
 {
     int handle = bg_blocks_manager::create_regular_tiles(tiles_item, true);
@@ -267,6 +267,15 @@ void sprite_ptr::set_tiles(const sprite_tiles_item& tiles_item)
 
 void sprite_ptr::set_tiles(const sprite_tiles_item& tiles_item, int graphics_index)
 {
+    const sprite_tiles_ptr& current_tiles = sprites_manager::tiles(_handle);
+
+    if(current_tiles.streamed())
+    {
+        sprite_tiles_ptr streamed_tiles = current_tiles;
+        streamed_tiles.set_tiles_ref(tiles_item, graphics_index);
+        return;
+    }
+
     optional<sprite_tiles_ptr> tiles = tiles_item.find_tiles(graphics_index);
 
     if(sprite_tiles_ptr* tiles_ptr = tiles.get())
@@ -607,9 +607,8 @@ namespace
                 }
 
                 const sprite_tiles_item& tiles_item = _generator.font().item().tiles_item();
-                const tile* source_tiles_data = tiles_item.tiles_ref().data();
-                int source_y = graphics_index * _character_height;
-                hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y, _sprite_column, tiles_vram);
+                const tile* source_tiles_data = tiles_item.graphics_tiles_ref(graphics_index).data();
+                hw::sprite_tiles::plot_tiles(width, source_tiles_data, 0, _sprite_column, tiles_vram);
 
                 _current_position.set_x(_current_position.x() + width_with_space);
                 _sprite_column += width_with_space;
@@ -807,10 +806,9 @@ namespace
                 }
 
                 const sprite_tiles_item& tiles_item = _generator.font().item().tiles_item();
-                const tile* source_tiles_data = tiles_item.tiles_ref().data();
-                int source_y = graphics_index * _character_height;
-                hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y, _sprite_column, tiles_vram);
-                hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y + (_character_height / 2),
+                const tile* source_tiles_data = tiles_item.graphics_tiles_ref(graphics_index).data();
+                hw::sprite_tiles::plot_tiles(width, source_tiles_data, 0, _sprite_column, tiles_vram);
+                hw::sprite_tiles::plot_tiles(width, source_tiles_data, _character_height / 2,
                                              _sprite_column + (_character_height * 2), tiles_vram);
 
                 _current_position.set_x(_current_position.x() + width_with_space);
@@ -899,23 +897,22 @@ namespace
                 }
 
                 const sprite_tiles_item& tiles_item = _generator.font().item().tiles_item();
-                const tile* source_tiles_data = tiles_item.tiles_ref().data();
-                int source_y = graphics_index * _character_height * 2;
+                const tile* source_tiles_data = tiles_item.graphics_tiles_ref(graphics_index).data();
 
                 if(width > 8)
                 {
-                    hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y,
+                    hw::sprite_tiles::plot_tiles(width, source_tiles_data, 0,
                                                  _sprite_column, tiles_vram);
-                    hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y + _character_height,
+                    hw::sprite_tiles::plot_tiles(width, source_tiles_data, _character_height,
                                                  _sprite_column + (_character_height * 2), tiles_vram);
                     source_tiles_data += 1;
                     tiles_vram += 1;
                     width -= 8;
                 }
 
-                hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y,
+                hw::sprite_tiles::plot_tiles(width, source_tiles_data, 0,
                                              _sprite_column, tiles_vram);
-                hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y + _character_height,
+                hw::sprite_tiles::plot_tiles(width, source_tiles_data, _character_height,
                                              _sprite_column + (_character_height * 2), tiles_vram);
 
                 _current_position.set_x(_current_position.x() + width_with_space);
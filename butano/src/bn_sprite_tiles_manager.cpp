@@ -79,6 +79,10 @@ namespace
     public:
         bool commit: 1 = false;
         bool commit_if_recovered: 1 = false;
+        bool double_buffered: 1 = false;
+        bool second_buffer: 1 = false;
+        bool flip_pending: 1 = false;
+        bool streamed: 1 = false;
 
         [[nodiscard]] status_type status() const
         {
@@ -99,6 +103,16 @@ namespace
         {
             _compression = unsigned(compression);
         }
+
+        [[nodiscard]] int buffer_tiles_count() const
+        {
+            return double_buffered ? int(tiles_count) / 2 : int(tiles_count);
+        }
+
+        [[nodiscard]] int buffer_start_tile() const
+        {
+            return second_buffer ? int(start_tile) + buffer_tiles_count() : int(start_tile);
+        }
     };
 
 
@@ -277,6 +291,7 @@ namespace
         vector<uint16_t, max_items> to_remove_items;
         vector<uint16_t, max_items> to_commit_uncompressed_items;
         vector<uint16_t, max_items> to_commit_compressed_items;
+        vector<uint16_t, max_items> to_flip_items;
         uint16_t free_tiles_count = 0;
         uint16_t to_remove_tiles_count = 0;
         bool delay_commit = false;
@@ -301,7 +316,9 @@ namespace
                         " - tiles_count: ", item.tiles_count,
                         " - compression: ", int(item.compression()),
                         " - usages: ", item.usages,
-                        (item.commit ? " - commit" : " - no_commit"));
+                        (item.commit ? " - commit" : " - no_commit"),
+                        (item.double_buffered ? " - double_buffered" : ""),
+                        (item.flip_pending ? " - flip_pending" : ""));
             }
 
             BN_LOG(']');
@@ -348,6 +365,7 @@ namespace
 
             BN_LOG(']');
 
+            BN_LOG("to_flip_items: ", data.to_flip_items.size());
             BN_LOG("free_tiles_count: ", data.free_tiles_count);
             BN_LOG("to_remove_tiles_count: ", data.to_remove_tiles_count);
             BN_LOG("delay_commit: ", (data.delay_commit ? "true" : "false"));
@@ -469,8 +487,8 @@ namespace
                       tiles_data, " - ", item.data);
             BN_ASSERT(compression == item.compression(), "Tiles compression does not match item tiles compression: ",
                       int(compression), " - ", int(item.compression()));
-            BN_ASSERT(tiles_count == item.tiles_count, "Tiles count does not match item tiles count: ",
-                      tiles_count, " - ", item.tiles_count);
+            BN_ASSERT(tiles_count == item.buffer_tiles_count(), "Tiles count does not match item tiles count: ",
+                      tiles_count, " - ", item.buffer_tiles_count());
 
             switch(item.status())
             {
@@ -512,8 +530,8 @@ namespace
         return -1;
     }
 
-    [[nodiscard]] int _create_item(
-            int id, const tile* tiles_data, compression_type compression, int tiles_count, bool delay_commit)
+    [[nodiscard]] int _create_item(int id, const tile* tiles_data, compression_type compression, int tiles_count,
+                                   bool double_buffered, bool delay_commit)
     {
         item_type& item = data.items.item(id);
         int new_item_tiles_count = int(item.tiles_count) - tiles_count;
@@ -531,7 +549,12 @@ namespace
 
         case status_type::TO_REMOVE:
             item.commit_if_recovered = false;
-            data.items_map.erase(item.data);
+
+            if(! item.streamed)
+            {
+                data.items_map.erase(item.data);
+            }
+
             data.to_remove_tiles_count -= tiles_count;
             break;
 
@@ -544,6 +567,10 @@ namespace
         item.set_compression(compression);
         item.tiles_count = uint16_t(tiles_count);
         item.usages = 1;
+        item.double_buffered = double_buffered;
+        item.second_buffer = false;
+        item.flip_pending = false;
+        item.streamed = false;
         item.set_status(status_type::USED);
 
         if(tiles_data)
@@ -554,7 +581,7 @@ namespace
             }
             else
             {
-                hw::sprite_tiles::commit(tiles_data, compression, int(item.start_tile), tiles_count);
+                hw::sprite_tiles::commit(tiles_data, compression, int(item.start_tile), item.buffer_tiles_count());
             }
         }
 
@@ -579,7 +606,8 @@ namespace
         return new_free_item_id;
     }
 
-    [[nodiscard]] int _create_impl(const tile* tiles_data, compression_type compression, int tiles_count)
+    [[nodiscard]] int _create_impl(const tile* tiles_data, compression_type compression, int tiles_count,
+                                   bool double_buffered)
     {
         int to_remove_tiles_count = data.to_remove_tiles_count;
 
@@ -600,7 +628,8 @@ namespace
                 {
                     data.to_remove_items.erase(to_remove_items_it);
 
-                    int new_free_item_id = _create_item(id, tiles_data, compression, tiles_count, true);
+                    int new_free_item_id = _create_item(id, tiles_data, compression, tiles_count, double_buffered,
+                                                        true);
 
                     if(new_free_item_id >= 0)
                     {
@@ -621,7 +650,8 @@ namespace
             if(free_items_it != free_items_end)
             {
                 int id = *free_items_it;
-                int new_free_item_id = _create_item(id, tiles_data, compression, tiles_count, data.delay_commit);
+                int new_free_item_id = _create_item(id, tiles_data, compression, tiles_count, double_buffered,
+                                                    data.delay_commit);
 
                 if(new_free_item_id >= 0)
                 {
@@ -638,7 +668,7 @@ namespace
         {
             update();
             data.delay_commit = true;
-            return _create_impl(tiles_data, compression, tiles_count);
+            return _create_impl(tiles_data, compression, tiles_count, double_buffered);
         }
 
         return -1;
@@ -660,7 +690,7 @@ namespace
             if(free_items_it != free_items_end)
             {
                 int id = *free_items_it;
-                int new_free_item_id = _create_item(id, nullptr, compression_type::NONE, tiles_count, false);
+                int new_free_item_id = _create_item(id, nullptr, compression_type::NONE, tiles_count, false, false);
 
                 if(new_free_item_id >= 0)
                 {
@@ -675,6 +705,19 @@ namespace
 
         return -1;
     }
+
+    void _commit_back_buffer(int id, item_type& item)
+    {
+        if(! item.flip_pending)
+        {
+            item.second_buffer = ! item.second_buffer;
+            item.flip_pending = true;
+            data.to_flip_items.push_back(uint16_t(id));
+        }
+
+        _erase_to_commit_item(id, item);
+        hw::sprite_tiles::commit(item.data, item.compression(), item.buffer_start_tile(), item.buffer_tiles_count());
+    }
 }
 
 void init()
@@ -763,7 +806,7 @@ int create(const span<const tile>& tiles_ref, compression_type compression)
         return result;
     }
 
-    result = _create_impl(tiles_data, compression, tiles_count);
+    result = _create_impl(tiles_data, compression, tiles_count, false);
 
     if(result >= 0)
     {
@@ -801,7 +844,7 @@ int create_new(const span<const tile>& tiles_ref, compression_type compression)
     BN_ASSERT(data.items_map.find(tiles_data) == data.items_map.end(),
               "Multiple copies of the same tiles data not supported");
 
-    int result = _create_impl(tiles_data, compression, tiles_count);
+    int result = _create_impl(tiles_data, compression, tiles_count, false);
 
     if(result >= 0)
     {
@@ -828,6 +871,78 @@ int create_new(const span<const tile>& tiles_ref, compression_type compression)
     return result;
 }
 
+int create_new_double_buffered(const span<const tile>& tiles_ref, compression_type compression)
+{
+    const tile* tiles_data = tiles_ref.data();
+    int tiles_count = tiles_ref.size();
+
+    BN_SPRITE_TILES_LOG("sprite_tiles_manager - CREATE NEW DOUBLE BUFFERED: ", tiles_data, " - ", tiles_count, " - ",
+                        int(compression));
+
+    BN_ASSERT(data.items_map.find(tiles_data) == data.items_map.end(),
+              "Multiple copies of the same tiles data not supported");
+
+    int result = _create_impl(tiles_data, compression, tiles_count * 2, true);
+
+    if(result >= 0)
+    {
+        data.items_map.insert(tiles_data, result);
+
+        BN_SPRITE_TILES_LOG("CREATED. start_tile: ", data.items.item(result).start_tile);
+        BN_SPRITE_TILES_LOG_STATUS();
+    }
+    else
+    {
+        BN_SPRITE_TILES_LOG("NOT CREATED");
+
+        #if BN_CFG_LOG_ENABLED
+            log_status();
+        #endif
+
+        BN_ERROR("Sprite tiles create new double buffered failed:",
+                 "\n\tTiles data: ", tiles_data,
+                 "\n\tTiles count: ", tiles_count,
+                 "\n\nThere's no more available VRAM.",
+                 _status_log_message);
+    }
+
+    return result;
+}
+
+int create_streamed(const span<const tile>& tiles_ref)
+{
+    const tile* tiles_data = tiles_ref.data();
+    int tiles_count = tiles_ref.size();
+
+    BN_SPRITE_TILES_LOG("sprite_tiles_manager - CREATE STREAMED: ", tiles_data, " - ", tiles_count);
+
+    int result = _create_impl(tiles_data, compression_type::NONE, tiles_count, false);
+
+    if(result >= 0)
+    {
+        data.items.item(result).streamed = true;
+
+        BN_SPRITE_TILES_LOG("CREATED. start_tile: ", data.items.item(result).start_tile);
+        BN_SPRITE_TILES_LOG_STATUS();
+    }
+    else
+    {
+        BN_SPRITE_TILES_LOG("NOT CREATED");
+
+        #if BN_CFG_LOG_ENABLED
+            log_status();
+        #endif
+
+        BN_ERROR("Sprite tiles create streamed failed:",
+                 "\n\tTiles data: ", tiles_data,
+                 "\n\tTiles count: ", tiles_count,
+                 "\n\nThere's no more available VRAM.",
+                 _status_log_message);
+    }
+
+    return result;
+}
+
 int allocate(int tiles_count, bpp_mode bpp)
 {
     BN_SPRITE_TILES_LOG("sprite_tiles_manager - ALLOCATE: ", tiles_count, " - ", int(bpp));
@@ -873,7 +988,7 @@ int create_optional(const span<const tile>& tiles_ref, compression_type compress
         return result;
     }
 
-    result = _create_impl(tiles_data, compression, tiles_count);
+    result = _create_impl(tiles_data, compression, tiles_count, false);
 
     if(result >= 0)
     {
@@ -901,7 +1016,7 @@ int create_new_optional(const span<const tile>& tiles_ref, compression_type comp
     BN_ASSERT(data.items_map.find(tiles_data) == data.items_map.end(),
               "Multiple copies of the same tiles data not supported");
 
-    int result = _create_impl(tiles_data, compression, tiles_count);
+    int result = _create_impl(tiles_data, compression, tiles_count, false);
 
     if(result >= 0)
     {
@@ -918,6 +1033,58 @@ int create_new_optional(const span<const tile>& tiles_ref, compression_type comp
     return result;
 }
 
+int create_new_double_buffered_optional(const span<const tile>& tiles_ref, compression_type compression)
+{
+    const tile* tiles_data = tiles_ref.data();
+    int tiles_count = tiles_ref.size();
+
+    BN_SPRITE_TILES_LOG("sprite_tiles_manager - CREATE NEW DOUBLE BUFFERED OPTIONAL: ", tiles_data, " - ",
+                        tiles_count, " - ", int(compression));
+
+    BN_ASSERT(data.items_map.find(tiles_data) == data.items_map.end(),
+              "Multiple copies of the same tiles data not supported");
+
+    int result = _create_impl(tiles_data, compression, tiles_count * 2, true);
+
+    if(result >= 0)
+    {
+        data.items_map.insert(tiles_data, result);
+
+        BN_SPRITE_TILES_LOG("CREATED. start_tile: ", data.items.item(result).start_tile);
+        BN_SPRITE_TILES_LOG_STATUS();
+    }
+    else
+    {
+        BN_SPRITE_TILES_LOG("NOT CREATED");
+    }
+
+    return result;
+}
+
+int create_streamed_optional(const span<const tile>& tiles_ref)
+{
+    const tile* tiles_data = tiles_ref.data();
+    int tiles_count = tiles_ref.size();
+
+    BN_SPRITE_TILES_LOG("sprite_tiles_manager - CREATE STREAMED OPTIONAL: ", tiles_data, " - ", tiles_count);
+
+    int result = _create_impl(tiles_data, compression_type::NONE, tiles_count, false);
+
+    if(result >= 0)
+    {
+        data.items.item(result).streamed = true;
+
+        BN_SPRITE_TILES_LOG("CREATED. start_tile: ", data.items.item(result).start_tile);
+        BN_SPRITE_TILES_LOG_STATUS();
+    }
+    else
+    {
+        BN_SPRITE_TILES_LOG("NOT CREATED");
+    }
+
+    return result;
+}
+
 int allocate_optional(int tiles_count, bpp_mode bpp)
 {
     BN_SPRITE_TILES_LOG("sprite_tiles_manager - ALLOCATE OPTIONAL: ", tiles_count, " - ", int(bpp));
@@ -940,6 +1107,39 @@ int allocate_optional(int tiles_count, bpp_mode bpp)
     return result;
 }
 
+int reserve_first_tiles(int tiles_count)
+{
+    BN_SPRITE_TILES_LOG("sprite_tiles_manager - RESERVE FIRST TILES: ", tiles_count);
+
+    if(data.to_remove_tiles_count)
+    {
+        update();
+    }
+
+    int result = data.items.begin().id();
+    const item_type& item = data.items.item(result);
+
+    if(item.status() != status_type::FREE || int(item.tiles_count) < tiles_count)
+    {
+        BN_SPRITE_TILES_LOG("NOT RESERVED");
+        return -1;
+    }
+
+    _erase_free_item(result);
+
+    int new_free_item_id = _create_item(result, nullptr, compression_type::NONE, tiles_count, false, false);
+
+    if(new_free_item_id >= 0)
+    {
+        _insert_free_item(new_free_item_id);
+    }
+
+    BN_SPRITE_TILES_LOG("RESERVED");
+    BN_SPRITE_TILES_LOG_STATUS();
+
+    return result;
+}
+
 void increase_usages(int id)
 {
     item_type& item = data.items.item(id);
@@ -973,12 +1173,22 @@ void decrease_usages(int id)
 
 int start_tile(int id)
 {
-    return int(data.items.item(id).start_tile);
+    return data.items.item(id).buffer_start_tile();
 }
 
 int tiles_count(int id)
 {
-    return int(data.items.item(id).tiles_count);
+    return data.items.item(id).buffer_tiles_count();
+}
+
+bool double_buffered(int id)
+{
+    return data.items.item(id).double_buffered;
+}
+
+bool streamed(int id)
+{
+    return data.items.item(id).streamed;
 }
 
 compression_type compression(int id)
@@ -993,7 +1203,7 @@ optional<span<const tile>> tiles_ref(int id)
 
     if(item.data)
     {
-        result.emplace(item.data, item.tiles_count);
+        result.emplace(item.data, item.buffer_tiles_count());
     }
 
     return result;
@@ -1008,8 +1218,21 @@ void set_tiles_ref(int id, const span<const tile>& tiles_ref, compression_type c
     BN_SPRITE_TILES_LOG("sprite_tiles_manager - SET_TILES_REF: ", item.start_tile, " - ", new_tiles_data,
                         " - ", tiles_ref.size(), " - ", int(compression));
 
-    BN_ASSERT(int(item.tiles_count) == tiles_ref.size(), "Tiles count does not match item tiles count: ",
-              int(item.tiles_count), " - ", tiles_ref.size());
+    BN_ASSERT(item.buffer_tiles_count() == tiles_ref.size(), "Tiles count does not match item tiles count: ",
+              item.buffer_tiles_count(), " - ", tiles_ref.size());
+
+    if(item.streamed)
+    {
+        BN_ASSERT(compression == compression_type::NONE, "Streamed tiles can't be compressed");
+
+        if(item.data != new_tiles_data)
+        {
+            item.data = new_tiles_data;
+            _insert_to_commit_item(id, item);
+        }
+
+        return;
+    }
 
     compression_type item_compression = item.compression();
 
@@ -1033,7 +1256,15 @@ void set_tiles_ref(int id, const span<const tile>& tiles_ref, compression_type c
         }
 
         item.data = new_tiles_data;
-        _insert_to_commit_item(id, item);
+
+        if(item.double_buffered)
+        {
+            _commit_back_buffer(id, item);
+        }
+        else
+        {
+            _insert_to_commit_item(id, item);
+        }
 
         BN_SPRITE_TILES_LOG_STATUS();
     }
@@ -1045,7 +1276,15 @@ void set_tiles_ref(int id, const span<const tile>& tiles_ref, compression_type c
         }
 
         item.set_compression(compression);
-        _insert_to_commit_item(id, item);
+
+        if(item.double_buffered)
+        {
+            _commit_back_buffer(id, item);
+        }
+        else
+        {
+            _insert_to_commit_item(id, item);
+        }
 
         BN_SPRITE_TILES_LOG_STATUS();
     }
@@ -1059,7 +1298,14 @@ void reload_tiles_ref(int id)
 
     BN_ASSERT(item.data, "Item has no data");
 
-    _insert_to_commit_item(id, item);
+    if(item.double_buffered)
+    {
+        _commit_back_buffer(id, item);
+    }
+    else
+    {
+        _insert_to_commit_item(id, item);
+    }
 
     BN_SPRITE_TILES_LOG_STATUS();
 }
@@ -1093,12 +1339,19 @@ void update()
 
             if(item.data)
             {
-                data.items_map.erase(item.data);
+                if(! item.streamed)
+                {
+                    data.items_map.erase(item.data);
+                }
+
                 item.data = nullptr;
             }
 
             item.set_status(status_type::FREE);
             item.commit_if_recovered = false;
+            item.double_buffered = false;
+            item.second_buffer = false;
+            item.streamed = false;
             data.free_tiles_count += item.tiles_count;
 
             auto next_iterator = iterator;
@@ -1146,6 +1399,26 @@ void update()
     data.delay_commit = false;
 }
 
+bool pending_flips()
+{
+    return ! data.to_flip_items.empty();
+}
+
+bool pending_flip(int id)
+{
+    return data.items.item(id).flip_pending;
+}
+
+void clear_pending_flips()
+{
+    for(int item_index : data.to_flip_items)
+    {
+        data.items.item(item_index).flip_pending = false;
+    }
+
+    data.to_flip_items.clear();
+}
+
 void commit_uncompressed(bool use_dma)
 {
     if(! data.to_commit_uncompressed_items.empty())
@@ -1157,7 +1430,7 @@ void commit_uncompressed(bool use_dma)
             for(int item_index : data.to_commit_uncompressed_items)
             {
                 item_type& item = data.items.item(item_index);
-                hw::sprite_tiles::commit_with_dma(item.data, int(item.start_tile), int(item.tiles_count));
+                hw::sprite_tiles::commit_with_dma(item.data, item.buffer_start_tile(), item.buffer_tiles_count());
                 item.commit = false;
             }
         }
@@ -1166,7 +1439,7 @@ void commit_uncompressed(bool use_dma)
             for(int item_index : data.to_commit_uncompressed_items)
             {
                 item_type& item = data.items.item(item_index);
-                hw::sprite_tiles::commit_with_cpu(item.data, int(item.start_tile), int(item.tiles_count));
+                hw::sprite_tiles::commit_with_cpu(item.data, item.buffer_start_tile(), item.buffer_tiles_count());
                 item.commit = false;
             }
         }
@@ -1186,7 +1459,8 @@ void commit_compressed()
         for(int item_index : data.to_commit_compressed_items)
         {
             item_type& item = data.items.item(item_index);
-            hw::sprite_tiles::commit(item.data, item.compression(), int(item.start_tile), int(item.tiles_count));
+            hw::sprite_tiles::commit(item.data, item.compression(), item.buffer_start_tile(),
+                                     item.buffer_tiles_count());
             item.commit = false;
         }
 
@@ -39,14 +39,25 @@ namespace bn::sprite_tiles_manager
 
     [[nodiscard]] int create_new(const span<const tile>& tiles_ref, compression_type compression);
 
+    [[nodiscard]] int create_new_double_buffered(const span<const tile>& tiles_ref, compression_type compression);
+
+    [[nodiscard]] int create_streamed(const span<const tile>& tiles_ref);
+
     [[nodiscard]] int allocate(int tiles_count, bpp_mode bpp);
 
     [[nodiscard]] int create_optional(const span<const tile>& tiles_ref, compression_type compression);
 
     [[nodiscard]] int create_new_optional(const span<const tile>& tiles_ref, compression_type compression);
 
+    [[nodiscard]] int create_new_double_buffered_optional(const span<const tile>& tiles_ref,
+                                                          compression_type compression);
+
+    [[nodiscard]] int create_streamed_optional(const span<const tile>& tiles_ref);
+
     [[nodiscard]] int allocate_optional(int tiles_count, bpp_mode bpp);
 
+    [[nodiscard]] int reserve_first_tiles(int tiles_count);
+
     void increase_usages(int id);
 
     void decrease_usages(int id);
@@ -55,6 +66,10 @@ namespace bn::sprite_tiles_manager
 
     [[nodiscard]] int tiles_count(int id);
 
+    [[nodiscard]] bool double_buffered(int id);
+
+    [[nodiscard]] bool streamed(int id);
+
     [[nodiscard]] compression_type compression(int id);
 
     [[nodiscard]] optional<span<const tile>> tiles_ref(int id);
@@ -67,6 +82,12 @@ namespace bn::sprite_tiles_manager
 
     void update();
 
+    [[nodiscard]] bool pending_flips();
+
+    [[nodiscard]] bool pending_flip(int id);
+
+    void clear_pending_flips();
+
     void commit_uncompressed(bool use_dma);
 
     void commit_compressed();
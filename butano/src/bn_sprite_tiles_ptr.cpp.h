@@ -64,6 +64,35 @@ sprite_tiles_ptr sprite_tiles_ptr::create_new(const sprite_tiles_item& tiles_ite
     return sprite_tiles_ptr(handle);
 }
 
+sprite_tiles_ptr sprite_tiles_ptr::create_new_double_buffered(const sprite_tiles_item& tiles_item)
+{
+    int handle = sprite_tiles_manager::create_new_double_buffered(tiles_item.graphics_tiles_ref(),
+                                                                  tiles_item.compression());
+    return sprite_tiles_ptr(handle);
+}
+
+sprite_tiles_ptr sprite_tiles_ptr::create_new_double_buffered(const sprite_tiles_item& tiles_item,
+                                                              int graphics_index)
+{
+    int handle = sprite_tiles_manager::create_new_double_buffered(tiles_item.graphics_tiles_ref(graphics_index),
+                                                                  tiles_item.compression());
+    return sprite_tiles_ptr(handle);
+}
+
+sprite_tiles_ptr sprite_tiles_ptr::create_streamed(const sprite_tiles_item& tiles_item)
+{
+    BN_ASSERT(tiles_item.compression() == compression_type::NONE, "Streamed tiles can't be compressed");
+
+    return sprite_tiles_ptr(sprite_tiles_manager::create_streamed(tiles_item.graphics_tiles_ref()));
+}
+
+sprite_tiles_ptr sprite_tiles_ptr::create_streamed(const sprite_tiles_item& tiles_item, int graphics_index)
+{
+    BN_ASSERT(tiles_item.compression() == compression_type::NONE, "Streamed tiles can't be compressed");
+
+    return sprite_tiles_ptr(sprite_tiles_manager::create_streamed(tiles_item.graphics_tiles_ref(graphics_index)));
+}
+
 sprite_tiles_ptr sprite_tiles_ptr::allocate(int tiles_count, bpp_mode bpp)
 {
     return sprite_tiles_ptr(sprite_tiles_manager::allocate(tiles_count, bpp));
@@ -126,6 +155,67 @@ optional<sprite_tiles_ptr> sprite_tiles_ptr::create_new_optional(
     return result;
 }
 
+optional<sprite_tiles_ptr> sprite_tiles_ptr::create_new_double_buffered_optional(
+        const sprite_tiles_item& tiles_item)
+{
+    int handle = sprite_tiles_manager::create_new_double_buffered_optional(tiles_item.graphics_tiles_ref(),
+                                                                           tiles_item.compression());
+    optional<sprite_tiles_ptr> result;
+
+    if(handle >= 0)
+    {
+        result = sprite_tiles_ptr(handle);
+    }
+
+    return result;
+}
+
+optional<sprite_tiles_ptr> sprite_tiles_ptr::create_new_double_buffered_optional(
+        const sprite_tiles_item& tiles_item, int graphics_index)
+{
+    int handle = sprite_tiles_manager::create_new_double_buffered_optional(
+                tiles_item.graphics_tiles_ref(graphics_index), tiles_item.compression());
+    optional<sprite_tiles_ptr> result;
+
+    if(handle >= 0)
+    {
+        result = sprite_tiles_ptr(handle);
+    }
+
+    return result;
+}
+
+optional<sprite_tiles_ptr> sprite_tiles_ptr::create_streamed_optional(const sprite_tiles_item& tiles_item)
+{
+    BN_ASSERT(tiles_item.compression() == compression_type::NONE, "Streamed tiles can't be compressed");
+
+    int handle = sprite_tiles_manager::create_streamed_optional(tiles_item.graphics_tiles_ref());
+    optional<sprite_tiles_ptr> result;
+
+    if(handle >= 0)
+    {
+        result = sprite_tiles_ptr(handle);
+    }
+
+    return result;
+}
+
+optional<sprite_tiles_ptr> sprite_tiles_ptr::create_streamed_optional(
+        const sprite_tiles_item& tiles_item, int graphics_index)
+{
+    BN_ASSERT(tiles_item.compression() == compression_type::NONE, "Streamed tiles can't be compressed");
+
+    int handle = sprite_tiles_manager::create_streamed_optional(tiles_item.graphics_tiles_ref(graphics_index));
+    optional<sprite_tiles_ptr> result;
+
+    if(handle >= 0)
+    {
+        result = sprite_tiles_ptr(handle);
+    }
+
+    return result;
+}
+
 optional<sprite_tiles_ptr> sprite_tiles_ptr::allocate_optional(int tiles_count, bpp_mode bpp)
 {
     int handle = sprite_tiles_manager::allocate_optional(tiles_count, bpp);
@@ -179,6 +269,16 @@ int sprite_tiles_ptr::tiles_count() const
     return sprite_tiles_manager::tiles_count(_handle);
 }
 
+bool sprite_tiles_ptr::double_buffered() const
+{
+    return sprite_tiles_manager::double_buffered(_handle);
+}
+
+bool sprite_tiles_ptr::streamed() const
+{
+    return sprite_tiles_manager::streamed(_handle);
+}
+
 compression_type sprite_tiles_ptr::compression() const
 {
     return sprite_tiles_manager::compression(_handle);
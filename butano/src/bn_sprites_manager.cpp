@@ -9,6 +9,7 @@
 #include "bn_sprite_first_attributes.h"
 #include "bn_sprite_regular_second_attributes.h"
 #include "bn_sorted_sprites.h"
+#include "bn_sprite_tiles_manager.h"
 #include "../hw/include/bn_hw_sprite_affine_mats_constants.h"
 
 #include "bn_sprites.cpp.h"
@@ -219,6 +220,29 @@ namespace
         }
     }
 
+    void _update_flipped_tiles()
+    {
+        if(sprite_tiles_manager::pending_flips())
+        {
+            for(sorted_sprites::layer& layer : data.sorter.layers())
+            {
+                for(item_type& item : layer.items())
+                {
+                    if(const sprite_tiles_ptr* tiles = item.tiles.get())
+                    {
+                        if(sprite_tiles_manager::pending_flip(tiles->handle()))
+                        {
+                            hw::sprites::set_tiles(tiles->id(), item.handle);
+                            _update_indexes_to_commit(item);
+                        }
+                    }
+                }
+            }
+
+            sprite_tiles_manager::clear_pending_flips();
+        }
+    }
+
     void _check_items_on_screen()
     {
         if(data.check_items_on_screen)
@@ -1344,6 +1368,7 @@ void update_affine_mat_double_size(id_type id, int affine_mat_id)
 
 void update()
 {
+    _update_flipped_tiles();
     sprite_affine_mats_manager::update();
     _check_items_on_screen();
     _rebuild_handles();
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_tile_collision_map.h"
+
+#include "bn_bit.h"
+#include "bn_rect.h"
+#include "bn_math.h"
+#include "bn_algorithm.h"
+
+namespace bn
+{
+
+namespace
+{
+    constexpr int cell_size = 8;
+    constexpr int cell_shift = 3;
+
+    [[nodiscard]] int _first_bit(const uint32_t* words_ptr, int first, int last)
+    {
+        int word_index = first / 32;
+        int last_word_index = last / 32;
+        uint32_t word = words_ptr[word_index] & (0xFFFFFFFF << (first % 32));
+
+        while(word_index < last_word_index)
+        {
+            if(word)
+            {
+                return (word_index * 32) + countr_zero(word);
+            }
+
+            ++word_index;
+            word = words_ptr[word_index];
+        }
+
+        word &= 0xFFFFFFFF >> (31 - (last % 32));
+        return word ? (word_index * 32) + countr_zero(word) : -1;
+    }
+
+    [[nodiscard]] int _last_bit(const uint32_t* words_ptr, int first, int last)
+    {
+        int word_index = last / 32;
+        int first_word_index = first / 32;
+        uint32_t word = words_ptr[word_index] & (0xFFFFFFFF >> (31 - (last % 32)));
+
+        while(word_index > first_word_index)
+        {
+            if(word)
+            {
+                return (word_index * 32) + 31 - countl_zero(word);
+            }
+
+            --word_index;
+            word = words_ptr[word_index];
+        }
+
+        word &= 0xFFFFFFFF << (first % 32);
+        return word ? (word_index * 32) + 31 - countl_zero(word) : -1;
+    }
+
+    // Lines are the rows or the columns of the map, and the movement is done along them:
+    [[nodiscard]] int _sweep(const uint32_t* lines_ptr, int line_words, int lines_count, int line_cells,
+                             int start, int end, int first_line_pixel, int last_line_pixel, int delta)
+    {
+        int first_line = max(first_line_pixel >> cell_shift, 0);
+        int last_line = min((last_line_pixel - 1) >> cell_shift, lines_count - 1);
+        int result = delta;
+
+        if(delta > 0)
+        {
+            int first_cell = max(((end - 1) >> cell_shift) + 1, 0);
+            int last_cell = min((end - 1 + delta) >> cell_shift, line_cells - 1);
+
+            for(int line = first_line; line <= last_line && first_cell <= last_cell; ++line)
+            {
+                int cell = _first_bit(lines_ptr + (line * line_words), first_cell, last_cell);
+
+                if(cell >= 0)
+                {
+                    result = (cell << cell_shift) - end;
+                    last_cell = cell - 1;
+                }
+            }
+        }
+        else if(delta < 0)
+        {
+            int first_cell = max((start + delta) >> cell_shift, 0);
+            int last_cell = min((start >> cell_shift) - 1, line_cells - 1);
+
+            for(int line = first_line; line <= last_line && first_cell <= last_cell; ++line)
+            {
+                int cell = _last_bit(lines_ptr + (line * line_words), first_cell, last_cell);
+
+                if(cell >= 0)
+                {
+                    result = ((cell + 1) << cell_shift) - start;
+                    first_cell = cell + 1;
+                }
+            }
+        }
+
+        return result;
+    }
+}
+
+bool tile_collision_map::any_solid(int x, int y, int width, int height) const
+{
+    int first_x = max(x, 0);
+    int last_x = min(x + width, _dimensions.width()) - 1;
+    int first_y = max(y, 0);
+    int last_y = min(y + height, _dimensions.height()) - 1;
+
+    if(first_x > last_x)
+    {
+        return false;
+    }
+
+    int row_words = _row_words();
+
+    for(int row = first_y; row <= last_y; ++row)
+    {
+        if(_first_bit(_solid_rows_ptr + (row * row_words), first_x, last_x) >= 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int tile_collision_map::first_solid_in_row(int y, int first_x, int last_x) const
+{
+    BN_ASSERT(y >= 0 && y < _dimensions.height(), "Invalid y: ", y, " - ", _dimensions.height());
+    BN_ASSERT(first_x >= 0 && first_x <= last_x && last_x < _dimensions.width(),
+              "Invalid range: ", first_x, " - ", last_x, " - ", _dimensions.width());
+
+    return _first_bit(_solid_rows_ptr + (y * _row_words()), first_x, last_x);
+}
+
+int tile_collision_map::last_solid_in_row(int y, int first_x, int last_x) const
+{
+    BN_ASSERT(y >= 0 && y < _dimensions.height(), "Invalid y: ", y, " - ", _dimensions.height());
+    BN_ASSERT(first_x >= 0 && first_x <= last_x && last_x < _dimensions.width(),
+              "Invalid range: ", first_x, " - ", last_x, " - ", _dimensions.width());
+
+    return _last_bit(_solid_rows_ptr + (y * _row_words()), first_x, last_x);
+}
+
+int tile_collision_map::first_solid_in_column(int x, int first_y, int last_y) const
+{
+    BN_ASSERT(x >= 0 && x < _dimensions.width(), "Invalid x: ", x, " - ", _dimensions.width());
+    BN_ASSERT(first_y >= 0 && first_y <= last_y && last_y < _dimensions.height(),
+              "Invalid range: ", first_y, " - ", last_y, " - ", _dimensions.height());
+
+    return _first_bit(_solid_columns_ptr + (x * _column_words()), first_y, last_y);
+}
+
+int tile_collision_map::last_solid_in_column(int x, int first_y, int last_y) const
+{
+    BN_ASSERT(x >= 0 && x < _dimensions.width(), "Invalid x: ", x, " - ", _dimensions.width());
+    BN_ASSERT(first_y >= 0 && first_y <= last_y && last_y < _dimensions.height(),
+              "Invalid range: ", first_y, " - ", last_y, " - ", _dimensions.height());
+
+    return _last_bit(_solid_columns_ptr + (x * _column_words()), first_y, last_y);
+}
+
+int tile_collision_map::sweep_x(const rect& rect, int delta_x) const
+{
+    return _sweep(_solid_rows_ptr, _row_words(), _dimensions.height(), _dimensions.width(),
+                  rect.left(), rect.left() + rect.width(), rect.top(), rect.top() + rect.height(), delta_x);
+}
+
+int tile_collision_map::sweep_y(const rect& rect, int delta_y) const
+{
+    return _sweep(_solid_columns_ptr, _column_words(), _dimensions.width(), _dimensions.height(),
+                  rect.top(), rect.top() + rect.height(), rect.left(), rect.left() + rect.width(), delta_y);
+}
+
+optional<point> tile_collision_map::raycast(const point& from, const point& to) const
+{
+    int x = from.x() >> cell_shift;
+    int y = from.y() >> cell_shift;
+    int end_x = to.x() >> cell_shift;
+    int end_y = to.y() >> cell_shift;
+    int delta_x = abs(to.x() - from.x());
+    int delta_y = abs(to.y() - from.y());
+    int step_x = to.x() > from.x() ? 1 : -1;
+    int step_y = to.y() > from.y() ? 1 : -1;
+
+    // Distances in half pixels from the center of the start pixel to the next cell boundary of each axis:
+    int boundary_x = step_x > 0 ? ((x + 1) << (cell_shift + 1)) - (from.x() * 2) - 1 :
+                                  (from.x() * 2) + 1 - (x << (cell_shift + 1));
+    int boundary_y = step_y > 0 ? ((y + 1) << (cell_shift + 1)) - (from.y() * 2) - 1 :
+                                  (from.y() * 2) + 1 - (y << (cell_shift + 1));
+    optional<point> result;
+
+    while(true)
+    {
+        if(solid(x, y))
+        {
+            result = point(x, y);
+            break;
+        }
+
+        bool x_done = x == end_x;
+        bool y_done = y == end_y;
+
+        if(x_done && y_done)
+        {
+            break;
+        }
+
+        // The next crossed boundary is the one with the smallest distance relative to its axis delta
+        // (at corners the vertical one is crossed first, so rays can't pass between diagonal solid cells):
+        if(y_done || (! x_done && boundary_x * delta_y < boundary_y * delta_x))
+        {
+            x += step_x;
+            boundary_x += cell_size * 2;
+        }
+        else
+        {
+            y += step_y;
+            boundary_y += cell_size * 2;
+        }
+    }
+
+    return result;
+}
+
+}
@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_tlsf_allocator.h"
+
+#include "bn_memory.h"
+#include "bn_algorithm.h"
+#include "bn_alignment.h"
+#include "bn_config_allocator.h"
+#include "../hw/include/bn_hw_timer.h"
+
+#if BN_CFG_LOG_ENABLED
+    #include "bn_log.h"
+#endif
+
+namespace bn
+{
+
+namespace
+{
+    constexpr tlsf_allocator::size_type alignment_bytes = sizeof(int);
+
+    [[nodiscard]] tlsf_allocator::size_type _aligned_bytes(tlsf_allocator::size_type bytes)
+    {
+        if(tlsf_allocator::size_type extra_bytes = bytes % alignment_bytes)
+        {
+            bytes += alignment_bytes - extra_bytes;
+        }
+
+        return bytes;
+    }
+
+    [[nodiscard]] int _last_bit_index(unsigned value)
+    {
+        return 31 - __builtin_clz(value);
+    }
+
+    [[nodiscard]] int _first_bit_index(unsigned value)
+    {
+        return __builtin_ctz(value);
+    }
+}
+
+tlsf_allocator::~tlsf_allocator() noexcept
+{
+    BN_ASSERT(empty(), "Allocator is not empty");
+}
+
+allocator_stats tlsf_allocator::stats() const
+{
+    allocator_stats result = _stats;
+    result._used_bytes = used_bytes();
+    result._available_bytes = available_bytes();
+
+    const item_type* item = _begin_item();
+    const item_type* end_item = _end_item();
+
+    while(item != end_item)
+    {
+        if(! item->used)
+        {
+            result._largest_free_bytes = max(result._largest_free_bytes, int(item->size));
+            ++result._free_items_count;
+        }
+
+        item = item->next();
+    }
+
+    return result;
+}
+
+void* tlsf_allocator::alloc(size_type bytes)
+{
+    #if BN_CFG_ALLOCATOR_STATS_ENABLED
+        unsigned start_ticks = hw::timer::ticks();
+        void* result = _alloc(bytes);
+        _stats._alloc_ticks += int(hw::timer::ticks() - start_ticks);
+
+        if(result)
+        {
+            ++_stats._alloc_count;
+            ++_stats._alloc_bytes_histogram[allocator_stats::histogram_index(bytes)];
+            _stats._peak_used_bytes = max(_stats._peak_used_bytes, used_bytes());
+        }
+        else
+        {
+            ++_stats._failed_alloc_count;
+        }
+
+        return result;
+    #else
+        return _alloc(bytes);
+    #endif
+}
+
+void* tlsf_allocator::_alloc(size_type bytes)
+{
+    BN_ASSERT(bytes >= 0, "Invalid bytes: ", bytes);
+
+    bytes = _aligned_bytes(bytes) + _sizeof_header;
+
+    if(bytes < _min_item_size)
+    {
+        bytes = _min_item_size;
+    }
+
+    if(bytes > _free_bytes_count)
+    {
+        return nullptr;
+    }
+
+    item_type* item = _suitable_free_item(bytes);
+
+    if(! item)
+    {
+        return nullptr;
+    }
+
+    _erase_free_item(item);
+
+    size_type new_item_size = item->size - bytes;
+
+    if(new_item_size >= _min_item_size)
+    {
+        item->size = bytes;
+
+        item_type* new_item = item->next();
+        new_item->previous = item;
+        new_item->size = new_item_size;
+        new_item->used = false;
+
+        item_type* new_next_item = new_item->next();
+
+        if(new_next_item != _end_item())
+        {
+            new_next_item->previous = new_item;
+        }
+
+        _insert_free_item(new_item);
+    }
+
+    item->used = true;
+    _free_bytes_count -= item->size;
+    return reinterpret_cast<uint8_t*>(item) + _sizeof_header;
+}
+
+void* tlsf_allocator::calloc(size_type num, size_type bytes)
+{
+    BN_ASSERT(num >= 0, "Invalid num: ", num);
+    BN_ASSERT(bytes >= 0, "Invalid bytes: ", bytes);
+
+    bytes *= num;
+
+    void* result = alloc(bytes);
+
+    if(result)
+    {
+        auto int_result = reinterpret_cast<int*>(result);
+        memory::clear(_aligned_bytes(bytes) / size_type(sizeof(int)), *int_result);
+    }
+
+    return result;
+}
+
+void* tlsf_allocator::realloc(void* ptr, size_type new_bytes)
+{
+    if(! ptr)
+    {
+        return alloc(new_bytes);
+    }
+
+    BN_ASSERT(new_bytes >= 0, "Invalid new bytes: ", new_bytes);
+
+    uint8_t* item_ptr = static_cast<uint8_t*>(ptr) - _sizeof_header;
+    auto item = reinterpret_cast<item_type*>(item_ptr);
+    size_type old_bytes = item->size - _sizeof_header;
+
+    if(new_bytes <= old_bytes)
+    {
+        return ptr;
+    }
+
+    void* new_ptr = alloc(new_bytes);
+
+    if(! new_ptr)
+    {
+        return nullptr;
+    }
+
+    auto old_ptr_data = reinterpret_cast<const int*>(ptr);
+    auto new_ptr_data = reinterpret_cast<int*>(new_ptr);
+    memory::copy(*old_ptr_data, old_bytes / 4, *new_ptr_data);
+    free(ptr);
+    return new_ptr;
+}
+
+void tlsf_allocator::free(void* ptr)
+{
+    if(! ptr)
+    {
+        return;
+    }
+
+    #if BN_CFG_ALLOCATOR_STATS_ENABLED
+        ++_stats._free_count;
+    #endif
+
+    uint8_t* item_ptr = static_cast<uint8_t*>(ptr) - _sizeof_header;
+    auto item = reinterpret_cast<item_type*>(item_ptr);
+    item->used = false;
+    _free_bytes_count += item->size;
+
+    if(item_type* previous_item = item->previous)
+    {
+        if(! previous_item->used)
+        {
+            _erase_free_item(previous_item);
+            previous_item->size += item->size;
+            item = previous_item;
+        }
+    }
+
+    item_type* next_item = item->next();
+    item_type* end_item = _end_item();
+
+    if(next_item != end_item)
+    {
+        if(! next_item->used)
+        {
+            _erase_free_item(next_item);
+            item->size += next_item->size;
+            next_item = item->next();
+        }
+
+        if(next_item != end_item)
+        {
+            next_item->previous = item;
+        }
+    }
+
+    _insert_free_item(item);
+}
+
+void tlsf_allocator::reset(void* start, size_type bytes)
+{
+    BN_ASSERT(bytes >= 0 && bytes % size_type(sizeof(int)) == 0, "Invalid bytes: ", bytes);
+    BN_ASSERT(bytes <= max_bytes(), "Too many bytes: ", bytes, " - ", max_bytes());
+    BN_ASSERT(empty(), "Allocator is not empty");
+
+    _stats = allocator_stats();
+    _first_level_bitmap = 0;
+
+    for(int first_level_index = 0; first_level_index < _first_level_count; ++first_level_index)
+    {
+        _second_level_bitmaps[first_level_index] = 0;
+
+        for(int second_level_index = 0; second_level_index < _second_level_count; ++second_level_index)
+        {
+            _free_items[first_level_index][second_level_index] = nullptr;
+        }
+    }
+
+    if(bytes >= _min_item_size)
+    {
+        BN_ASSERT(start, "Start is null");
+        BN_ASSERT(aligned<alignment_bytes>(start), "Start is not aligned");
+
+        _start_ptr = static_cast<uint8_t*>(start);
+        _total_bytes_count = bytes;
+        _free_bytes_count = bytes;
+
+        auto first_item = reinterpret_cast<item_type*>(start);
+        first_item->previous = nullptr;
+        first_item->size = bytes;
+        first_item->used = false;
+        _insert_free_item(first_item);
+    }
+    else
+    {
+        _start_ptr = nullptr;
+        _total_bytes_count = 0;
+        _free_bytes_count = 0;
+    }
+}
+
+#if BN_CFG_LOG_ENABLED
+    void tlsf_allocator::log_status() const
+    {
+        BN_LOG("items: ");
+        BN_LOG('[');
+
+        const item_type* item = _begin_item();
+        const item_type* end_item = _end_item();
+
+        while(item != end_item)
+        {
+            BN_LOG("    ",
+                   item->used ? "used" : "free",
+                   " - size: ", item->size);
+
+            item = item->next();
+        }
+
+        BN_LOG(']');
+        BN_LOG("first_level_bitmap: ", _first_level_bitmap);
+        BN_LOG("free_bytes_count: ", _free_bytes_count);
+        BN_LOG("total_bytes_count: ", _total_bytes_count);
+    }
+#endif
+
+void tlsf_allocator::_list_indexes(size_type size, int& first_level_index, int& second_level_index)
+{
+    if(size < _small_item_size)
+    {
+        first_level_index = 0;
+        second_level_index = size / (_small_item_size / _second_level_count);
+    }
+    else
+    {
+        int last_bit_index = _last_bit_index(unsigned(size));
+        first_level_index = last_bit_index - (_first_level_shift - 1);
+        second_level_index = (size >> (last_bit_index - _second_level_count_log2)) ^ _second_level_count;
+    }
+}
+
+void tlsf_allocator::_insert_free_item(item_type* item)
+{
+    int first_level_index;
+    int second_level_index;
+    _list_indexes(item->size, first_level_index, second_level_index);
+
+    item_type*& first_free_item = _free_items[first_level_index][second_level_index];
+    item->previous_free = nullptr;
+    item->next_free = first_free_item;
+
+    if(first_free_item)
+    {
+        first_free_item->previous_free = item;
+    }
+
+    first_free_item = item;
+    _first_level_bitmap |= 1U << first_level_index;
+    _second_level_bitmaps[first_level_index] |= 1U << second_level_index;
+}
+
+void tlsf_allocator::_erase_free_item(item_type* item)
+{
+    item_type* previous_free_item = item->previous_free;
+    item_type* next_free_item = item->next_free;
+
+    if(next_free_item)
+    {
+        next_free_item->previous_free = previous_free_item;
+    }
+
+    if(previous_free_item)
+    {
+        previous_free_item->next_free = next_free_item;
+        return;
+    }
+
+    int first_level_index;
+    int second_level_index;
+    _list_indexes(item->size, first_level_index, second_level_index);
+
+    _free_items[first_level_index][second_level_index] = next_free_item;
+
+    if(! next_free_item)
+    {
+        uint16_t& second_level_bitmap = _second_level_bitmaps[first_level_index];
+        second_level_bitmap &= ~(1U << second_level_index);
+
+        if(! second_level_bitmap)
+        {
+            _first_level_bitmap &= ~(1U << first_level_index);
+        }
+    }
+}
+
+tlsf_allocator::item_type* tlsf_allocator::_suitable_free_item(size_type bytes)
+{
+    size_type search_bytes = bytes;
+
+    if(search_bytes >= _small_item_size)
+    {
+        // Round up to the next second level list, so any item in it is big enough:
+        search_bytes += (1 << (_last_bit_index(unsigned(search_bytes)) - _second_level_count_log2)) - 1;
+    }
+
+    int first_level_index;
+    int second_level_index;
+    _list_indexes(search_bytes, first_level_index, second_level_index);
+
+    if(first_level_index < _first_level_count)
+    {
+        unsigned second_level_bitmap = _second_level_bitmaps[first_level_index] & (~0U << second_level_index);
+
+        if(! second_level_bitmap)
+        {
+            unsigned first_level_bitmap = _first_level_bitmap & (~0U << (first_level_index + 1));
+
+            if(first_level_bitmap)
+            {
+                first_level_index = _first_bit_index(first_level_bitmap);
+                second_level_bitmap = _second_level_bitmaps[first_level_index];
+            }
+        }
+
+        if(second_level_bitmap)
+        {
+            second_level_index = _first_bit_index(second_level_bitmap);
+            return _free_items[first_level_index][second_level_index];
+        }
+    }
+
+    // Last resort: search an item big enough in the list of the requested size:
+    _list_indexes(bytes, first_level_index, second_level_index);
+
+    item_type* item = _free_items[first_level_index][second_level_index];
+
+    while(item && item->size < bytes)
+    {
+        item = item->next_free;
+    }
+
+    return item;
+}
+
+}
@@ -50,6 +50,373 @@ def append_compression_command(tag, compression, command):
         command.append('-' + tag + 'zh')
 
 
+def reduce_repeated_graphics(grit_asm_file_path, tiles_label, graphics):
+    with open(grit_asm_file_path, 'r') as grit_asm_file:
+        grit_asm_lines = grit_asm_file.read().splitlines()
+
+    label_line_index = grit_asm_lines.index(tiles_label + ':')
+    first_word_line_index = label_line_index + 1
+    last_word_line_index = first_word_line_index
+    words = []
+
+    while last_word_line_index < len(grit_asm_lines):
+        grit_asm_line = grit_asm_lines[last_word_line_index].strip()
+
+        if not grit_asm_line.startswith('.word'):
+            break
+
+        words.extend(grit_asm_line[len('.word'):].replace(' ', '').split(','))
+        last_word_line_index += 1
+
+    words_per_graphic = int(len(words) / graphics)
+    unique_graphics = {}
+    unique_words = []
+    graphics_indexes = []
+
+    for graphics_index in range(graphics):
+        graphic_words = tuple(words[graphics_index * words_per_graphic:(graphics_index + 1) * words_per_graphic])
+        unique_graphics_index = unique_graphics.get(graphic_words)
+
+        if unique_graphics_index is None:
+            unique_graphics_index = len(unique_graphics)
+            unique_graphics[graphic_words] = unique_graphics_index
+            unique_words.extend(graphic_words)
+
+        graphics_indexes.append(unique_graphics_index)
+
+    unique_graphics_count = len(unique_graphics)
+
+    if unique_graphics_count == graphics:
+        return None, graphics
+
+    word_lines = []
+
+    for word_index in range(0, len(unique_words), 8):
+        word_lines.append('\t.word ' + ','.join(unique_words[word_index:word_index + 8]))
+
+    grit_asm_lines[first_word_line_index:last_word_line_index] = word_lines
+
+    for line_index in range(label_line_index):
+        grit_asm_line = grit_asm_lines[line_index]
+
+        if '.global' in grit_asm_line and tiles_label in grit_asm_line:
+            grit_asm_lines[line_index] = re.sub(r'@ ([0-9]+) unsigned chars',
+                                                '@ ' + str(len(unique_words) * 4) + ' unsigned chars', grit_asm_line)
+
+    with open(grit_asm_file_path, 'w') as grit_asm_file:
+        grit_asm_file.write('\n'.join(grit_asm_lines) + '\n')
+
+    return graphics_indexes, unique_graphics_count
+
+
+def pad_compressed_data(data):
+    while len(data) % 4 != 0:
+        data.append(0)
+
+    return data
+
+
+def lz77_compress(data):
+    # GBA BIOS LZ77 format, with a minimum displacement of 2 to allow 16-bit writes:
+    size = len(data)
+    output = bytearray([0x10, size & 0xFF, (size >> 8) & 0xFF, (size >> 16) & 0xFF])
+    positions = {}
+    index = 0
+
+    while index < size:
+        flags_index = len(output)
+        flags = 0
+        output.append(0)
+
+        for block in range(8):
+            if index >= size:
+                break
+
+            best_length = 0
+            best_displacement = 0
+            max_length = min(18, size - index)
+
+            if max_length >= 3:
+                for position in reversed(positions.get(bytes(data[index:index + 3]), [])):
+                    displacement = index - position
+
+                    if displacement > 4096:
+                        break
+
+                    if displacement >= 2:
+                        length = 3
+
+                        while length < max_length and data[position + length] == data[index + length]:
+                            length += 1
+
+                        if length > best_length:
+                            best_length = length
+                            best_displacement = displacement
+
+                            if length == max_length:
+                                break
+
+            if best_length >= 3:
+                flags |= 0x80 >> block
+                output.append(((best_length - 3) << 4) | ((best_displacement - 1) >> 8))
+                output.append((best_displacement - 1) & 0xFF)
+                step = best_length
+            else:
+                output.append(data[index])
+                step = 1
+
+            for step_index in range(index, index + step):
+                positions.setdefault(bytes(data[step_index:step_index + 3]), []).append(step_index)
+
+            index += step
+
+        output[flags_index] = flags
+
+    return pad_compressed_data(output)
+
+
+def run_length_compress(data):
+    # GBA BIOS run-length format:
+    size = len(data)
+    output = bytearray([0x30, size & 0xFF, (size >> 8) & 0xFF, (size >> 16) & 0xFF])
+    literals = bytearray()
+    index = 0
+
+    def flush_literals():
+        if len(literals) > 0:
+            output.append(len(literals) - 1)
+            output.extend(literals)
+            literals.clear()
+
+    while index < size:
+        run = 1
+
+        while index + run < size and run < 130 and data[index + run] == data[index]:
+            run += 1
+
+        if run >= 3:
+            flush_literals()
+            output.append(0x80 | (run - 3))
+            output.append(data[index])
+            index += run
+        else:
+            literals.append(data[index])
+            index += 1
+
+            if len(literals) == 128:
+                flush_literals()
+
+    flush_literals()
+    return pad_compressed_data(output)
+
+
+def chunked_map_data(map_cells, width, height, compression):
+    # Compressed big maps are split in 32x32 chunks compressed independently,
+    # preceded by a table with the 32-bit byte offset of each chunk:
+    compressed_chunks = []
+
+    for chunk_y in range(height // 32):
+        for chunk_x in range(width // 32):
+            chunk_data = bytearray()
+
+            for row in range(32):
+                row_index = ((chunk_y * 32) + row) * width + (chunk_x * 32)
+
+                for map_cell in map_cells[row_index:row_index + 32]:
+                    chunk_data.extend(map_cell.to_bytes(2, 'little'))
+
+            if compression == 'lz77':
+                compressed_chunks.append(lz77_compress(chunk_data))
+            elif compression == 'run_length':
+                compressed_chunks.append(run_length_compress(chunk_data))
+            else:
+                raise ValueError('Compression not supported in big maps: ' + str(compression))
+
+    offsets_data = bytearray()
+    chunks_data = bytearray()
+    offset = len(compressed_chunks) * 4
+
+    for compressed_chunk in compressed_chunks:
+        offsets_data.extend((offset + len(chunks_data)).to_bytes(4, 'little'))
+        chunks_data.extend(compressed_chunk)
+
+    return offsets_data + chunks_data
+
+
+def asm_data_lines(grit_asm_lines, label):
+    label_line_index = grit_asm_lines.index(label + ':')
+    first_data_line_index = label_line_index + 1
+    last_data_line_index = first_data_line_index
+
+    while last_data_line_index < len(grit_asm_lines):
+        grit_asm_line = grit_asm_lines[last_data_line_index].strip()
+
+        if not grit_asm_line.startswith('.hword') and not grit_asm_line.startswith('.word'):
+            break
+
+        last_data_line_index += 1
+
+    return label_line_index, first_data_line_index, last_data_line_index
+
+
+def read_asm_data(grit_asm_lines, label):
+    label_line_index, first_data_line_index, last_data_line_index = asm_data_lines(grit_asm_lines, label)
+    data = bytearray()
+
+    for grit_asm_line in grit_asm_lines[first_data_line_index:last_data_line_index]:
+        grit_asm_line = grit_asm_line.strip()
+
+        if grit_asm_line.startswith('.hword'):
+            for half_word in grit_asm_line[len('.hword'):].replace(' ', '').split(','):
+                data.extend(int(half_word, 0).to_bytes(2, 'little'))
+        else:
+            for word in grit_asm_line[len('.word'):].replace(' ', '').split(','):
+                data.extend(int(word, 0).to_bytes(4, 'little'))
+
+    return data
+
+
+def write_asm_data(grit_asm_lines, label, data):
+    label_line_index, first_data_line_index, last_data_line_index = asm_data_lines(grit_asm_lines, label)
+    word_lines = []
+
+    for byte_index in range(0, len(data), 32):
+        words = []
+
+        for word_index in range(byte_index, min(byte_index + 32, len(data)), 4):
+            words.append('0x%08X' % int.from_bytes(data[word_index:word_index + 4], 'little'))
+
+        word_lines.append('\t.word ' + ','.join(words))
+
+    grit_asm_lines[first_data_line_index:last_data_line_index] = word_lines
+
+    for line_index in range(label_line_index):
+        grit_asm_line = grit_asm_lines[line_index]
+
+        if '.global' in grit_asm_line and label in grit_asm_line:
+            grit_asm_lines[line_index] = re.sub(r'@ ([0-9]+) unsigned chars',
+                                                '@ ' + str(len(data)) + ' unsigned chars', grit_asm_line)
+
+
+def rename_asm_data(grit_asm_lines, label, new_label):
+    label_line_index = grit_asm_lines.index(label + ':')
+
+    for line_index in range(label_line_index + 1):
+        grit_asm_line = grit_asm_lines[line_index]
+
+        if grit_asm_line == label + ':' or (grit_asm_line.lstrip().startswith('.') and label in grit_asm_line):
+            grit_asm_lines[line_index] = re.sub(r'\b' + label + r'\b', new_label, grit_asm_line)
+
+
+def remove_asm_data(grit_asm_lines, label):
+    label_line_index, first_data_line_index, last_data_line_index = asm_data_lines(grit_asm_lines, label)
+    first_line_index = label_line_index
+
+    while first_line_index > 0:
+        grit_asm_line = grit_asm_lines[first_line_index - 1].strip()
+
+        if not grit_asm_line.startswith('.global') and not grit_asm_line.startswith('.hidden'):
+            break
+
+        first_line_index -= 1
+
+    del grit_asm_lines[first_line_index:last_data_line_index]
+
+
+def compress_data(data, compression):
+    if compression == 'none':
+        return compression, bytes(data)
+
+    if compression == 'lz77':
+        return compression, bytes(lz77_compress(data))
+
+    if compression == 'run_length':
+        return compression, bytes(run_length_compress(data))
+
+    if compression == 'auto':
+        best_compression, best_data = compress_data(data, 'none')
+
+        for test_compression in ['run_length', 'lz77']:
+            test_compression, test_data = compress_data(data, test_compression)
+
+            if len(test_data) < len(best_data):
+                best_compression = test_compression
+                best_data = test_data
+
+        return best_compression, best_data
+
+    raise ValueError('Compression not supported in tileset groups: ' + str(compression))
+
+
+def chunk_big_map(grit_asm_file_path, map_label, width, height, compression):
+    with open(grit_asm_file_path, 'r') as grit_asm_file:
+        grit_asm_lines = grit_asm_file.read().splitlines()
+
+    map_bytes = read_asm_data(grit_asm_lines, map_label)
+    map_cells = [int.from_bytes(map_bytes[index:index + 2], 'little') for index in range(0, len(map_bytes), 2)]
+
+    if compression == 'auto':
+        map_data = None
+
+        for test_compression in ['run_length', 'lz77']:
+            test_map_data = chunked_map_data(map_cells, width, height, test_compression)
+
+            if map_data is None or len(test_map_data) < len(map_data):
+                map_data = test_map_data
+                compression = test_compression
+
+        if len(map_data) >= len(map_cells) * 2:
+            return 'none', len(map_cells)
+    else:
+        map_data = chunked_map_data(map_cells, width, height, compression)
+
+    write_asm_data(grit_asm_lines, map_label, map_data)
+
+    with open(grit_asm_file_path, 'w') as grit_asm_file:
+        grit_asm_file.write('\n'.join(grit_asm_lines) + '\n')
+
+    return compression, len(map_data) // 2
+
+
+def tile_flips(tile_data, bpp_8):
+    # Returns the tile data without flip, with horizontal flip, with vertical flip and with both flips:
+    row_bytes = 8 if bpp_8 else 4
+    rows = [bytes(tile_data[index:index + row_bytes]) for index in range(0, len(tile_data), row_bytes)]
+
+    if bpp_8:
+        horizontal_flip_rows = [row[::-1] for row in rows]
+    else:
+        horizontal_flip_rows = [bytes(((pixels & 0x0F) << 4) | (pixels >> 4) for pixels in row[::-1]) for row in rows]
+
+    return b''.join(rows), b''.join(horizontal_flip_rows), b''.join(rows[::-1]), b''.join(horizontal_flip_rows[::-1])
+
+
+def validate_item_name(item_name, description):
+    if len(item_name) == 0:
+        raise ValueError('Empty ' + description)
+
+    if item_name[0] not in string.ascii_lowercase:
+        raise ValueError('Invalid ' + description + ': ' + item_name +
+                         ' (invalid character: \'' + item_name[0] + '\')')
+
+    valid_characters = '_%s%s' % (string.ascii_lowercase, string.digits)
+
+    for item_name_character in item_name:
+        if item_name_character not in valid_characters:
+            raise ValueError('Invalid ' + description + ': ' + item_name +
+                             ' (invalid character: \'' + item_name_character + '\')')
+
+
+def graphics_indexes_declaration(name, graphics_indexes):
+    result = 'constexpr inline uint16_t ' + name + '_bn_gfxGraphicsIndexes[' + str(len(graphics_indexes)) + '] = {'
+
+    for index in range(0, len(graphics_indexes), 16):
+        result += '\n    ' + ', '.join(str(graphics_index) for graphics_index in graphics_indexes[index:index + 16])
+        result += ','
+
+    return result + '\n};\n'
+
+
 class SpriteItem:
 
     @staticmethod
@@ -127,6 +494,11 @@ class SpriteItem:
         self.__graphics = int(bmp.height / height)
         self.__shape, self.__size = SpriteItem.shape_and_size(bmp.width, height)
 
+        try:
+            self.__repeated_graphics_reduction = bool(info['repeated_graphics_reduction'])
+        except KeyError:
+            self.__repeated_graphics_reduction = True
+
         try:
             self.__tiles_compression = info['tiles_compression']
             validate_compression(self.__tiles_compression)
@@ -219,9 +591,29 @@ class SpriteItem:
             bpp_mode_label = 'bpp_mode::BPP_8'
             tiles_count *= 2
 
+        graphics_indexes = None
+
+        if self.__repeated_graphics_reduction and tiles_compression == 'none' and self.__graphics > 1:
+            graphics_indexes, unique_graphics = reduce_repeated_graphics(
+                self.__build_folder_path + '/' + name + '_bn_gfx.s', name + '_bn_gfxTiles', self.__graphics)
+
+            if graphics_indexes is not None:
+                removed_tiles_count = tiles_count - int(tiles_count * unique_graphics / self.__graphics)
+                tiles_count -= removed_tiles_count
+                total_size -= (removed_tiles_count * 32) - (self.__graphics * 2)
+
         grit_data = re.sub(r'Tiles\[([0-9]+)]', 'Tiles[' + str(tiles_count) + ']', grit_data)
         grit_data = re.sub(r'Pal\[([0-9]+)]', 'Pal[' + str(self.__colors_count) + ']', grit_data)
 
+        if graphics_indexes is not None:
+            graphics_indexes_label = 'span<const uint16_t>(' + name + '_bn_gfxGraphicsIndexes, ' + \
+                                     str(self.__graphics) + ')'
+            grit_data += '\n' + graphics_indexes_declaration(name, graphics_indexes)
+            tiles_item_arguments = bpp_mode_label + ', ' + graphics_indexes_label
+        else:
+            tiles_item_arguments = bpp_mode_label + ', ' + compression_label(tiles_compression) + ', ' + \
+                                   str(self.__graphics)
+
         with open(header_file_path, 'w') as header_file:
             include_guard = 'BN_SPRITE_ITEMS_' + name.upper() + '_H'
             header_file.write('#ifndef ' + include_guard + '\n')
@@ -236,8 +628,7 @@ class SpriteItem:
                               'sprite_shape_size(sprite_shape::' + self.__shape + ', ' +
                               'sprite_size::' + self.__size + '), ' + '\n            ' +
                               'sprite_tiles_item(span<const tile>(' + name + '_bn_gfxTiles, ' +
-                              str(tiles_count) + '), ' + bpp_mode_label + ', ' + compression_label(tiles_compression) +
-                              ', ' + str(self.__graphics) + '), ' + '\n            ' +
+                              str(tiles_count) + '), ' + tiles_item_arguments + '), ' + '\n            ' +
                               'sprite_palette_item(span<const color>(' + name + '_bn_gfxPal, ' +
                               str(self.__colors_count) + '), ' + bpp_mode_label + ', ' +
                               compression_label(palette_compression) + '));\n')
@@ -290,6 +681,11 @@ class SpriteTilesItem:
         self.__graphics = int(bmp.height / height)
         self.__shape, self.__size = SpriteItem.shape_and_size(bmp.width, height)
 
+        try:
+            self.__repeated_graphics_reduction = bool(info['repeated_graphics_reduction'])
+        except KeyError:
+            self.__repeated_graphics_reduction = True
+
         try:
             bpp_mode = str(info['bpp_mode'])
 
@@ -363,8 +759,28 @@ class SpriteTilesItem:
         else:
             bpp_mode_label = 'bpp_mode::BPP_4'
 
+        graphics_indexes = None
+
+        if self.__repeated_graphics_reduction and compression == 'none' and self.__graphics > 1:
+            graphics_indexes, unique_graphics = reduce_repeated_graphics(
+                self.__build_folder_path + '/' + name + '_bn_gfx.s', name + '_bn_gfxTiles', self.__graphics)
+
+            if graphics_indexes is not None:
+                removed_tiles_count = tiles_count - int(tiles_count * unique_graphics / self.__graphics)
+                tiles_count -= removed_tiles_count
+                total_size -= (removed_tiles_count * 32) - (self.__graphics * 2)
+
         grit_data = re.sub(r'Tiles\[([0-9]+)]', 'Tiles[' + str(tiles_count) + ']', grit_data)
 
+        if graphics_indexes is not None:
+            graphics_indexes_label = 'span<const uint16_t>(' + name + '_bn_gfxGraphicsIndexes, ' + \
+                                     str(self.__graphics) + ')'
+            grit_data += '\n' + graphics_indexes_declaration(name, graphics_indexes)
+            tiles_item_arguments = bpp_mode_label + ', ' + graphics_indexes_label
+        else:
+            tiles_item_arguments = bpp_mode_label + ', ' + compression_label(compression) + ', ' + \
+                                   str(self.__graphics)
+
         with open(header_file_path, 'w') as header_file:
             include_guard = 'BN_SPRITE_TILES_ITEMS_' + name.upper() + '_H'
             header_file.write('#ifndef ' + include_guard + '\n')
@@ -378,8 +794,7 @@ class SpriteTilesItem:
             header_file.write('{' + '\n')
             header_file.write('    constexpr inline sprite_tiles_item ' + name + '(span<const tile>(' +
                               name + '_bn_gfxTiles, ' + str(tiles_count) + '), ' + '\n            ' +
-                              bpp_mode_label + ', ' + compression_label(compression) + ', ' +
-                              str(self.__graphics) + ');' + '\n')
+                              tiles_item_arguments + ');' + '\n')
             header_file.write('\n')
             header_file.write('    constexpr inline sprite_shape_size ' + name +
                               '_shape_size(sprite_shape::' + self.__shape + ', ' +
@@ -540,6 +955,7 @@ class RegularBgItem:
         self.__bpp_8 = False
         self.__sbb = (width == 256 and height == 512) or (width == 512 and height == 256) or \
                      (width == 512 and height == 512)
+        self.__big = self.__width > 64 or self.__height > 64
 
         try:
             self.__repeated_tiles_reduction = bool(info['repeated_tiles_reduction'])
@@ -552,22 +968,14 @@ class RegularBgItem:
             self.__flipped_tiles_reduction = True
 
         try:
-            palette_item = str(info['palette_item'])
-
-            if len(palette_item) == 0:
-                raise ValueError('Empty palette item')
-
-            if palette_item[0] not in string.ascii_lowercase:
-                raise ValueError('Invalid palette item: ' + palette_item +
-                                 ' (invalid character: \'' + palette_item[0] + '\')')
-
-            valid_characters = '_%s%s' % (string.ascii_lowercase, string.digits)
-
-            for palette_item_character in palette_item:
-                if palette_item_character not in valid_characters:
-                    raise ValueError('Invalid palette item: ' + palette_item +
-                                     ' (invalid character: \'' + palette_item_character + '\')')
+            self.__tileset_group = str(info['tileset_group'])
+            validate_item_name(self.__tileset_group, 'tileset group')
+        except KeyError:
+            self.__tileset_group = None
 
+        try:
+            palette_item = str(info['palette_item'])
+            validate_item_name(palette_item, 'palette item')
             self.__palette_item = palette_item
             self.__colors_count = 0
         except KeyError:
@@ -627,6 +1035,9 @@ class RegularBgItem:
             except KeyError:
                 self.__map_compression = 'none'
 
+        if self.__big and self.__map_compression == 'huffman':
+            raise ValueError('Huffman compression not supported in big maps')
+
     def process(self):
         tiles_compression = self.__tiles_compression
         palette_compression = self.__palette_compression
@@ -644,7 +1055,7 @@ class RegularBgItem:
                                                                              file_size)
             palette_compression, file_size = self.__test_palette_compression(palette_compression, 'lz77', file_size)
 
-        if map_compression == 'auto':
+        if map_compression == 'auto' and not self.__big:
             map_compression, file_size = self.__test_map_compression(map_compression, 'none', None)
             map_compression, file_size = self.__test_map_compression(map_compression, 'run_length', file_size)
             map_compression, file_size = self.__test_map_compression(map_compression, 'lz77', file_size)
@@ -653,6 +1064,145 @@ class RegularBgItem:
         self.__execute_command(tiles_compression, palette_compression, map_compression)
         return self.__write_header(tiles_compression, palette_compression, map_compression, False)
 
+    def name(self):
+        return self.__file_name_no_ext
+
+    def tileset_group(self):
+        return self.__tileset_group
+
+    def bpp_8(self):
+        return self.__bpp_8
+
+    def flipped_tiles_reduction(self):
+        return self.__flipped_tiles_reduction
+
+    def tiles_compression(self):
+        return self.__tiles_compression
+
+    def read_tileset_group_data(self):
+        palette_compression = self.__palette_compression
+
+        if palette_compression == 'auto':
+            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'none', None)
+            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'run_length',
+                                                                             file_size)
+            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'lz77', file_size)
+
+        # Tiles and map are compressed after merging the tiles of all backgrounds of the group:
+        self.__palette_compression = palette_compression
+        self.__execute_command('none', palette_compression, 'none')
+
+        name = self.__file_name_no_ext
+
+        with open(self.__build_folder_path + '/' + name + '_bn_gfx.s', 'r') as grit_asm_file:
+            grit_asm_lines = grit_asm_file.read().splitlines()
+
+        tiles_data = read_asm_data(grit_asm_lines, name + '_bn_gfxTiles')
+        map_data = read_asm_data(grit_asm_lines, name + '_bn_gfxMap')
+        map_cells = [int.from_bytes(map_data[index:index + 2], 'little') for index in range(0, len(map_data), 2)]
+        return tiles_data, map_cells
+
+    def write_tileset_group_data(self, tileset_group_tiles_data, map_cells):
+        name = self.__file_name_no_ext
+        grit_asm_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.s'
+        grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
+        header_file_path = self.__build_folder_path + '/bn_regular_bg_items_' + name + '.h'
+        tiles_label = name + '_bn_gfxTiles'
+        map_label = name + '_bn_gfxMap'
+        palette_label = name + '_bn_gfxPal'
+
+        with open(grit_asm_file_path, 'r') as grit_asm_file:
+            grit_asm_lines = grit_asm_file.read().splitlines()
+
+        # Group tiles are stored in the assembly file of the first background of the group:
+        if tileset_group_tiles_data is None:
+            remove_asm_data(grit_asm_lines, tiles_label)
+        else:
+            write_asm_data(grit_asm_lines, tiles_label, tileset_group_tiles_data)
+            rename_asm_data(grit_asm_lines, tiles_label, self.__tileset_group + '_bn_gfxTiles')
+
+        map_data = bytearray()
+
+        for map_cell in map_cells:
+            map_data.extend(map_cell.to_bytes(2, 'little'))
+
+        if self.__big:
+            map_compression = 'none'
+        else:
+            map_compression, map_data = compress_data(map_data, self.__map_compression)
+
+        write_asm_data(grit_asm_lines, map_label, map_data)
+        map_half_words = len(map_data) // 2
+
+        if palette_label + ':' in grit_asm_lines:
+            total_size = len(read_asm_data(grit_asm_lines, palette_label))
+        else:
+            total_size = 0
+
+        with open(grit_asm_file_path, 'w') as grit_asm_file:
+            grit_asm_file.write('\n'.join(grit_asm_lines) + '\n')
+
+        if self.__big and self.__map_compression != 'none':
+            map_compression, map_half_words = chunk_big_map(
+                grit_asm_file_path, map_label, self.__width, self.__height, self.__map_compression)
+
+        total_size += map_half_words * 2
+
+        with open(grit_file_path, 'r') as grit_file:
+            grit_lines = [grit_line for grit_line in grit_file.read().splitlines() if tiles_label not in grit_line]
+            grit_data = '\n'.join(grit_lines) + '\n'
+            grit_data = grit_data.replace('unsigned short', 'bn::regular_bg_map_cell', 1)
+
+            if self.__palette_item is None:
+                grit_data = grit_data.replace('unsigned short', 'bn::color', 1)
+
+        remove_file(grit_file_path)
+
+        if self.__bpp_8:
+            bpp_mode_label = 'bpp_mode::BPP_8'
+        else:
+            bpp_mode_label = 'bpp_mode::BPP_4'
+
+        grit_data = re.sub(r'Pal\[([0-9]+)]', 'Pal[' + str(self.__colors_count) + ']', grit_data)
+        grit_data = re.sub(r'Map\[([0-9]+)]', 'Map[' + str(map_half_words) + ']', grit_data)
+        grit_data = re.sub(r'MapLen ([0-9]+)', 'MapLen ' + str(map_half_words * 2), grit_data)
+
+        with open(header_file_path, 'w') as header_file:
+            include_guard = 'BN_REGULAR_BG_ITEMS_' + name.upper() + '_H'
+            header_file.write('#ifndef ' + include_guard + '\n')
+            header_file.write('#define ' + include_guard + '\n')
+            header_file.write('\n')
+            header_file.write('#include "bn_regular_bg_item.h"' + '\n')
+            header_file.write('#include "bn_regular_bg_tiles_items_' + self.__tileset_group + '.h"' + '\n')
+            header_file.write(grit_data)
+            header_file.write('\n')
+
+            if self.__palette_item is not None:
+                header_file.write('#include "bn_bg_palette_items_' + self.__palette_item + '.h"' + '\n')
+                header_file.write('\n')
+
+            header_file.write('namespace bn::regular_bg_items' + '\n')
+            header_file.write('{' + '\n')
+            header_file.write('    constexpr inline regular_bg_item ' + name + '(' + '\n            ' +
+                              'bn::regular_bg_tiles_items::' + self.__tileset_group + ',' + '\n            ')
+
+            if self.__palette_item is None:
+                header_file.write('bg_palette_item(span<const color>(' + name + '_bn_gfxPal, ' +
+                                  str(self.__colors_count) + '), ' + bpp_mode_label + ', ' +
+                                  compression_label(self.__palette_compression) + '),' + '\n            ')
+            else:
+                header_file.write('bn::bg_palette_items::' + self.__palette_item + ',' + '\n            ')
+
+            header_file.write('regular_bg_map_item(' + name + '_bn_gfxMap[0], ' +
+                              'size(' + str(self.__width) + ', ' + str(self.__height) + '), ' +
+                              compression_label(map_compression) + '));' + '\n')
+            header_file.write('}' + '\n')
+            header_file.write('\n')
+            header_file.write('#endif' + '\n')
+            header_file.write('\n')
+
+        return total_size
+
     def __test_tiles_compression(self, best_tiles_compression, new_tiles_compression, best_file_size):
         self.__execute_command(new_tiles_compression, 'none', 'none')
         new_file_size = self.__write_header(new_tiles_compression, 'none', 'none', True)
@@ -724,6 +1274,13 @@ class RegularBgItem:
         grit_data = re.sub(r'Tiles\[([0-9]+)]', 'Tiles[' + str(tiles_count) + ']', grit_data)
         grit_data = re.sub(r'Pal\[([0-9]+)]', 'Pal[' + str(self.__colors_count) + ']', grit_data)
 
+        if self.__big and map_compression != 'none':
+            map_compression, map_half_words = chunk_big_map(
+                self.__build_folder_path + '/' + name + '_bn_gfx.s', name + '_bn_gfxMap',
+                self.__width, self.__height, map_compression)
+            grit_data = re.sub(r'Map\[([0-9]+)]', 'Map[' + str(map_half_words) + ']', grit_data)
+            grit_data = re.sub(r'MapLen ([0-9]+)', 'MapLen ' + str(map_half_words * 2), grit_data)
+
         with open(header_file_path, 'w') as header_file:
             include_guard = 'BN_REGULAR_BG_ITEMS_' + name.upper() + '_H'
             header_file.write('#ifndef ' + include_guard + '\n')
@@ -799,7 +1356,11 @@ class RegularBgItem:
 
         append_compression_command('g', tiles_compression, command)
         append_compression_command('p', palette_compression, command)
-        append_compression_command('m', map_compression, command)
+
+        # Big maps are compressed in chunks after calling grit:
+        if not self.__big:
+            append_compression_command('m', map_compression, command)
+
         command.append('-o' + self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
         command = ' '.join(command)
 
@@ -934,6 +1495,119 @@ class RegularBgTilesItem:
             raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
 
+class RegularBgTilesetGroupItem:
+
+    def __init__(self, name, regular_bg_items, build_folder_path):
+        self.__name = name
+        self.__regular_bg_items = sorted(regular_bg_items, key=lambda regular_bg_item: regular_bg_item.name())
+        self.__build_folder_path = build_folder_path
+
+        first_regular_bg_item = self.__regular_bg_items[0]
+        self.__bpp_8 = first_regular_bg_item.bpp_8()
+        self.__tiles_compression = first_regular_bg_item.tiles_compression()
+        self.__flipped_tiles_reduction = True
+
+        for regular_bg_item in self.__regular_bg_items:
+            if regular_bg_item.bpp_8() != self.__bpp_8:
+                raise ValueError('Tileset group BGs BPP mode mismatch: ' + regular_bg_item.name())
+
+            if regular_bg_item.tiles_compression() != self.__tiles_compression:
+                raise ValueError('Tileset group BGs tiles compression mismatch: ' + regular_bg_item.name())
+
+            if not regular_bg_item.flipped_tiles_reduction():
+                self.__flipped_tiles_reduction = False
+
+    def process(self):
+        bpp_8 = self.__bpp_8
+        tile_bytes = 64 if bpp_8 else 32
+        tile_indexes = {}
+        tiles_data = bytearray()
+        regular_bg_items_map_cells = []
+
+        for regular_bg_item in self.__regular_bg_items:
+            regular_bg_tiles_data, map_cells = regular_bg_item.read_tileset_group_data()
+            new_tiles = []
+
+            for tile_index in range(0, len(regular_bg_tiles_data), tile_bytes):
+                tile_data = regular_bg_tiles_data[tile_index:tile_index + tile_bytes]
+                flips = tile_flips(tile_data, bpp_8)
+                new_tile = None
+
+                if not self.__flipped_tiles_reduction:
+                    flips = flips[:1]
+
+                for flip_index, flip_data in enumerate(flips):
+                    shared_tile_index = tile_indexes.get(flip_data)
+
+                    if shared_tile_index is not None:
+                        # Bit 10 of a map cell is the horizontal flip flag and bit 11 is the vertical flip flag:
+                        new_tile = (shared_tile_index, flip_index << 10)
+                        break
+
+                if new_tile is None:
+                    new_tile = (len(tile_indexes), 0)
+                    tile_indexes[flips[0]] = new_tile[0]
+                    tiles_data.extend(flips[0])
+
+                new_tiles.append(new_tile)
+
+            new_map_cells = []
+
+            for map_cell in map_cells:
+                shared_tile_index, flip_flags = new_tiles[map_cell & 0x3FF]
+                new_map_cells.append(((map_cell & 0xFC00) ^ flip_flags) | shared_tile_index)
+
+            regular_bg_items_map_cells.append(new_map_cells)
+
+        tiles_count = len(tile_indexes)
+
+        if tiles_count > 1024:
+            raise ValueError('Tileset groups with more than 1024 tiles not supported: ' + str(tiles_count))
+
+        tiles_compression, tiles_data = compress_data(tiles_data, self.__tiles_compression)
+        total_size = len(tiles_data)
+
+        for index, regular_bg_item in enumerate(self.__regular_bg_items):
+            regular_bg_item_tiles_data = tiles_data if index == 0 else None
+            total_size += regular_bg_item.write_tileset_group_data(regular_bg_item_tiles_data,
+                                                                   regular_bg_items_map_cells[index])
+
+        return total_size, self.__write_header(tiles_compression, tiles_count, len(tiles_data))
+
+    def __write_header(self, compression, tiles_count, tiles_bytes):
+        name = self.__name
+        header_file_path = self.__build_folder_path + '/bn_regular_bg_tiles_items_' + name + '.h'
+
+        if self.__bpp_8:
+            bpp_mode_label = 'bpp_mode::BPP_8'
+            tiles_count *= 2
+        else:
+            bpp_mode_label = 'bpp_mode::BPP_4'
+
+        with open(header_file_path, 'w') as header_file:
+            include_guard = 'BN_REGULAR_BG_TILES_ITEMS_' + name.upper() + '_H'
+            header_file.write('#ifndef ' + include_guard + '\n')
+            header_file.write('#define ' + include_guard + '\n')
+            header_file.write('\n')
+            header_file.write('#include "bn_regular_bg_tiles_item.h"' + '\n')
+            header_file.write('\n')
+            header_file.write('#define ' + name + '_bn_gfxTilesLen ' + str(tiles_bytes) + '\n')
+            header_file.write('extern const bn::tile ' + name + '_bn_gfxTiles[' + str(tiles_count) + '];' + '\n')
+            header_file.write('\n')
+            header_file.write('namespace bn::regular_bg_tiles_items' + '\n')
+            header_file.write('{' + '\n')
+            header_file.write('    constexpr inline regular_bg_tiles_item ' + name + '(' + '\n            ' +
+                              'span<const tile>(' + name + '_bn_gfxTiles, ' +
+                              str(tiles_count) + '), ' + bpp_mode_label + ', ' + compression_label(compression) +
+                              ');' + '\n')
+            header_file.write('}' + '\n')
+            header_file.write('\n')
+            header_file.write('#endif' + '\n')
+            header_file.write('\n')
+
+        return header_file_path
+
+
 class AffineBgItem:
 
     def __init__(self, file_path, file_name_no_ext, build_folder_path, info):
@@ -961,21 +1635,7 @@ class AffineBgItem:
 
         try:
             palette_item = str(info['palette_item'])
-
-            if len(palette_item) == 0:
-                raise ValueError('Empty palette item')
-
-            if palette_item[0] not in string.ascii_lowercase:
-                raise ValueError('Invalid palette item: ' + palette_item +
-                                 ' (invalid character: \'' + palette_item[0] + '\')')
-
-            valid_characters = '_%s%s' % (string.ascii_lowercase, string.digits)
-
-            for palette_item_character in palette_item:
-                if palette_item_character not in valid_characters:
-                    raise ValueError('Invalid palette item: ' + palette_item +
-                                     ' (invalid character: \'' + palette_item_character + '\')')
-
+            validate_item_name(palette_item, 'palette item')
             self.__palette_item = palette_item
             self.__colors_count = 0
         except KeyError:
@@ -1392,6 +2052,128 @@ class BgPaletteItem:
             raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
 
+class TileCollisionMapItem:
+
+    def __init__(self, file_path, file_name_no_ext, build_folder_path, info):
+        bmp = BMP(file_path)
+        self.__file_path = file_path
+        self.__file_name_no_ext = file_name_no_ext
+        self.__build_folder_path = build_folder_path
+        self.__width = bmp.width // 8
+        self.__height = bmp.height // 8
+
+        try:
+            self.__bits_per_cell = int(info['bits_per_cell'])
+
+            if self.__bits_per_cell != 1 and self.__bits_per_cell != 4:
+                raise ValueError('Invalid bits per cell: ' + str(self.__bits_per_cell))
+        except KeyError:
+            self.__bits_per_cell = 1
+
+    def process(self):
+        name = self.__file_name_no_ext
+        grit_asm_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.s'
+        grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
+        self.__execute_command()
+
+        with open(grit_asm_file_path, 'r') as grit_asm_file:
+            grit_asm_lines = grit_asm_file.read().splitlines()
+
+        tiles_data = read_asm_data(grit_asm_lines, name + '_bn_gfxTiles')
+        remove_file(grit_file_path)
+
+        # Each 8x8 pixels cell gets the highest color index of its pixels (color index 0 means empty):
+        width = self.__width
+        height = self.__height
+        cells = [max(tiles_data[tile_index:tile_index + 64]) for tile_index in range(0, width * height * 64, 64)]
+        row_words = (width + 31) // 32
+        column_words = (height + 31) // 32
+        solid_rows = [0] * (row_words * height)
+        solid_columns = [0] * (column_words * width)
+
+        for y in range(height):
+            for x in range(width):
+                if cells[(y * width) + x]:
+                    solid_rows[(y * row_words) + (x // 32)] |= 1 << (x % 32)
+                    solid_columns[(x * column_words) + (y // 32)] |= 1 << (y % 32)
+
+        data_arrays = [('SolidRows', solid_rows), ('SolidColumns', solid_columns)]
+
+        if self.__bits_per_cell == 4:
+            value_words = (width + 7) // 8
+            values = [0] * (value_words * height)
+
+            for y in range(height):
+                for x in range(width):
+                    value = cells[(y * width) + x]
+
+                    if value > 15:
+                        raise ValueError('Invalid cell value (' + str(value) + ') at position (' +
+                                         str(x) + ', ' + str(y) + '): it must be in the range [0, 15]')
+
+                    values[(y * value_words) + (x // 8)] |= value << ((x % 8) * 4)
+
+            data_arrays.append(('Values', values))
+
+        asm_lines = ['', '\t.section .rodata', '\t.align\t2']
+
+        for suffix, words in data_arrays:
+            label = name + '_bn_gfx' + suffix
+            asm_lines.append('\t.global ' + label + '\t\t@ ' + str(len(words) * 4) + ' unsigned chars')
+            asm_lines.append('\t.hidden ' + label)
+            asm_lines.append(label + ':')
+
+            for word_index in range(0, len(words), 8):
+                asm_lines.append('\t.word ' + ','.join('0x%08X' % word for word in words[word_index:word_index + 8]))
+
+            asm_lines.append('')
+
+        with open(grit_asm_file_path, 'w') as grit_asm_file:
+            grit_asm_file.write('\n'.join(asm_lines) + '\n')
+
+        total_size = sum(len(words) * 4 for suffix, words in data_arrays)
+        return total_size, self.__write_header(data_arrays)
+
+    def __write_header(self, data_arrays):
+        name = self.__file_name_no_ext
+        header_file_path = self.__build_folder_path + '/bn_tile_collision_map_items_' + name + '.h'
+
+        with open(header_file_path, 'w') as header_file:
+            include_guard = 'BN_TILE_COLLISION_MAP_ITEMS_' + name.upper() + '_H'
+            header_file.write('#ifndef ' + include_guard + '\n')
+            header_file.write('#define ' + include_guard + '\n')
+            header_file.write('\n')
+            header_file.write('#include "bn_tile_collision_map.h"' + '\n')
+            header_file.write('\n')
+
+            for suffix, words in data_arrays:
+                header_file.write('extern const uint32_t ' + name + '_bn_gfx' + suffix + '[' + str(len(words)) + '];' +
+                                  '\n')
+
+            header_file.write('\n')
+            header_file.write('namespace bn::tile_collision_map_items' + '\n')
+            header_file.write('{' + '\n')
+            header_file.write('    constexpr inline tile_collision_map ' + name + '(' + '\n            ' +
+                              ', '.join(name + '_bn_gfx' + suffix + '[0]' for suffix, words in data_arrays) +
+                              ', ' + 'size(' + str(self.__width) + ', ' + str(self.__height) + '));' + '\n')
+            header_file.write('}' + '\n')
+            header_file.write('\n')
+            header_file.write('#endif' + '\n')
+            header_file.write('\n')
+
+        return header_file_path
+
+    def __execute_command(self):
+        command = ['grit', self.__file_path, '-gt', '-gB8', '-m!', '-p!',
+                   '-o' + self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx']
+        command = ' '.join(command)
+
+        try:
+            subprocess.check_output(command, shell=True, stderr=subprocess.STDOUT)
+        except subprocess.CalledProcessError as e:
+            raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
+
+
 class GraphicsFileInfo:
 
     def __init__(self, json_file_path, file_path, file_name, file_name_no_ext, file_info_path):
@@ -1404,13 +2186,26 @@ class GraphicsFileInfo:
     def print_file_name(self):
         print(self.__file_name)
 
+    def file_path(self):
+        return self.__file_path
+
+    def file_name_no_ext(self):
+        return self.__file_name_no_ext
+
+    def load_info(self):
+        try:
+            with open(self.__json_file_path) as json_file:
+                return json.load(json_file)
+        except Exception as exception:
+            raise ValueError(self.__json_file_path + ' graphics json file parse failed: ' + str(exception))
+
+    def write_file_info(self):
+        with open(self.__file_info_path, 'w') as file_info:
+            file_info.write('')
+
     def process(self, build_folder_path):
         try:
-            try:
-                with open(self.__json_file_path) as json_file:
-                    info = json.load(json_file)
-            except Exception as exception:
-                raise ValueError(self.__json_file_path + ' graphics json file parse failed: ' + str(exception))
+            info = self.load_info()
 
             try:
                 graphics_type = str(info['type'])
@@ -1433,20 +2228,53 @@ class GraphicsFileInfo:
                 item = AffineBgTilesItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
             elif graphics_type == 'bg_palette':
                 item = BgPaletteItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
+            elif graphics_type == 'tile_collision_map':
+                item = TileCollisionMapItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
             else:
                 raise ValueError('Unknown graphics type "' + graphics_type +
                                  '" found in graphics json file: ' + self.__json_file_path)
 
             total_size, header_file_path = item.process()
-
-            with open(self.__file_info_path, 'w') as file_info:
-                file_info.write('')
-
+            self.write_file_info()
             return [self.__file_name, header_file_path, total_size]
         except Exception as exc:
             return [self.__file_name, exc]
 
 
+class TilesetGroupFileInfo:
+
+    def __init__(self, name, graphics_file_infos, group_info_path, group_info):
+        self.__name = name
+        self.__graphics_file_infos = graphics_file_infos
+        self.__group_info_path = group_info_path
+        self.__group_info = group_info
+
+    def print_file_name(self):
+        print(self.__name + ' tileset group')
+
+    def process(self, build_folder_path):
+        try:
+            regular_bg_items = []
+
+            for graphics_file_info in self.__graphics_file_infos:
+                regular_bg_items.append(RegularBgItem(
+                    graphics_file_info.file_path(), graphics_file_info.file_name_no_ext(), build_folder_path,
+                    graphics_file_info.load_info()))
+
+            item = RegularBgTilesetGroupItem(self.__name, regular_bg_items, build_folder_path)
+            total_size, header_file_path = item.process()
+
+            for graphics_file_info in self.__graphics_file_infos:
+                graphics_file_info.write_file_info()
+
+            with open(self.__group_info_path, 'w') as group_info:
+                group_info.write(self.__group_info)
+
+            return [self.__name + ' tileset group', header_file_path, total_size]
+        except Exception as exc:
+            return [self.__name + ' tileset group', exc]
+
+
 class GraphicsFileInfoProcessor:
 
     def __init__(self, build_folder_path):
@@ -1456,10 +2284,26 @@ class GraphicsFileInfoProcessor:
         return graphics_file_info.process(self.__build_folder_path)
 
 
+def graphics_tileset_group(json_file_path):
+    try:
+        with open(json_file_path) as json_file:
+            info = json.load(json_file)
+
+        if str(info['type']) == 'regular_bg':
+            return str(info['tileset_group'])
+    except Exception:
+        # Invalid json files are reported when they are processed:
+        pass
+
+    return None
+
+
 def list_graphics_file_infos(graphics_folder_paths, build_folder_path):
     graphics_folder_path_list = graphics_folder_paths.split(' ')
     graphics_file_infos = []
     file_names_set = set()
+    tileset_groups = {}
+    build_tileset_groups = set()
 
     for graphics_folder_path in graphics_folder_path_list:
         graphics_file_names = os.listdir(graphics_folder_path)
@@ -1498,10 +2342,38 @@ def list_graphics_file_infos(graphics_folder_paths, build_folder_path):
                             json_file_mtime = os.path.getmtime(json_file_path)
                             build = file_info_mtime < json_file_mtime
 
-                    if build:
-                        graphics_file_infos.append(GraphicsFileInfo(
-                            json_file_path, graphics_file_path, graphics_file_name, graphics_file_name_no_ext,
-                            file_info_path))
+                    graphics_file_info = GraphicsFileInfo(
+                        json_file_path, graphics_file_path, graphics_file_name, graphics_file_name_no_ext,
+                        file_info_path)
+                    tileset_group = graphics_tileset_group(json_file_path)
+
+                    if tileset_group is not None:
+                        tileset_groups.setdefault(tileset_group, []).append(graphics_file_info)
+
+                        if build:
+                            build_tileset_groups.add(tileset_group)
+                    elif build:
+                        graphics_file_infos.append(graphics_file_info)
+
+    # The BGs of a tileset group are processed together, so if one of them changes, all of them are rebuilt:
+    for tileset_group, tileset_group_file_infos in tileset_groups.items():
+        if tileset_group in file_names_set:
+            raise ValueError('There\'s a tileset group with the same name as a graphics file: ' + tileset_group)
+
+        group_info_path = build_folder_path + '/_bn_' + tileset_group + '_tileset_group_info.txt'
+        group_info = ' '.join(sorted(file_info.file_name_no_ext() for file_info in tileset_group_file_infos))
+
+        if tileset_group not in build_tileset_groups:
+            try:
+                with open(group_info_path, 'r') as group_info_file:
+                    if group_info_file.read() != group_info:
+                        build_tileset_groups.add(tileset_group)
+            except OSError:
+                build_tileset_groups.add(tileset_group)
+
+        if tileset_group in build_tileset_groups:
+            graphics_file_infos.append(TilesetGroupFileInfo(
+                tileset_group, tileset_group_file_infos, group_info_path, group_info))
 
     return graphics_file_infos
 
@@ -0,0 +1,574 @@
+"""
+Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+import traceback
+
+
+bg_blocks_count = 32
+bg_block_half_words = 1024
+bg_tiles_alignment_blocks_count = 8
+max_bpp_4_regular_tiles_blocks_count = 16
+max_bpp_8_regular_tiles_blocks_count = 32
+max_affine_tiles_blocks_count = 8
+sprite_tiles_count = 1024
+
+sprite_shape_sizes = {
+    ('SQUARE', 'SMALL'): (8, 8),
+    ('SQUARE', 'NORMAL'): (16, 16),
+    ('SQUARE', 'BIG'): (32, 32),
+    ('SQUARE', 'HUGE'): (64, 64),
+    ('WIDE', 'SMALL'): (16, 8),
+    ('WIDE', 'NORMAL'): (32, 8),
+    ('WIDE', 'BIG'): (32, 16),
+    ('WIDE', 'HUGE'): (64, 32),
+    ('TALL', 'SMALL'): (8, 16),
+    ('TALL', 'NORMAL'): (8, 32),
+    ('TALL', 'BIG'): (16, 32),
+    ('TALL', 'HUGE'): (32, 64),
+}
+
+
+def ceil_half_words_to_blocks(half_words):
+    return (half_words + bg_block_half_words - 1) // bg_block_half_words
+
+
+class ItemHeader:
+
+    def __init__(self, build_folder_path, prefix, name):
+        self.__file_path = build_folder_path + '/bn_' + prefix + '_' + name + '.h'
+
+        try:
+            with open(self.__file_path, 'r') as header_file:
+                self.__data = header_file.read()
+        except OSError:
+            raise ValueError('Item header not found: ' + self.__file_path)
+
+    def search(self, pattern):
+        match = re.search(pattern, self.__data)
+
+        if match is None:
+            raise ValueError('Item header parse failed: ' + self.__file_path)
+
+        return match
+
+    def find(self, pattern):
+        return re.search(pattern, self.__data)
+
+
+class TilesInfo:
+
+    def __init__(self, label, tiles_count, bpp_8):
+        self.label = label
+        self.tiles_count = tiles_count
+        self.bpp_8 = bpp_8
+
+
+def read_tiles_info(header, item_type):
+    tiles_item_match = header.find(r'bn::' + item_type + r's::(\w+),')
+
+    if tiles_item_match is not None:
+        # Tiles shared with a tileset group:
+        return None, tiles_item_match.group(1)
+
+    match = header.search(r'span<const tile>\((\w+), ([0-9]+)\)(, bpp_mode::BPP_([48]))?')
+    bpp_8 = match.group(4) == '8' or item_type == 'affine_bg_tiles_item'
+    return TilesInfo(match.group(1), int(match.group(2)), bpp_8), None
+
+
+def regular_bg_tiles_info(build_folder_path, tiles_item_name):
+    header = ItemHeader(build_folder_path, 'regular_bg_tiles_items', tiles_item_name)
+    return read_tiles_info(header, 'regular_bg_tiles_item')[0]
+
+
+class BgInfo:
+
+    def __init__(self, build_folder_path, name, affine):
+        prefix = 'affine_bg_items' if affine else 'regular_bg_items'
+        header = ItemHeader(build_folder_path, prefix, name)
+        tiles_item_type = 'affine_bg_tiles_item' if affine else 'regular_bg_tiles_item'
+        self.tiles, tiles_item_name = read_tiles_info(header, tiles_item_type)
+
+        if self.tiles is None:
+            self.tiles = regular_bg_tiles_info(build_folder_path, tiles_item_name)
+
+        map_match = header.search(r'_map_item\((\w+)\[0\], size\(([0-9]+), ([0-9]+)\)')
+        self.map_label = map_match.group(1)
+        self.width = int(map_match.group(2))
+        self.height = int(map_match.group(3))
+        self.affine = affine
+
+
+class SpriteTilesInfo:
+
+    def __init__(self, build_folder_path, name, sprite_item):
+        if sprite_item:
+            header = ItemHeader(build_folder_path, 'sprite_items', name)
+        else:
+            header = ItemHeader(build_folder_path, 'sprite_tiles_items', name)
+
+        tiles_match = header.search(r'span<const tile>\((\w+), ([0-9]+)\),\s*bpp_mode::BPP_([48]), ')
+        shape_size_match = header.search(r'sprite_shape::(\w+), sprite_size::(\w+)\)')
+        width, height = sprite_shape_sizes[(shape_size_match.group(1), shape_size_match.group(2))]
+        self.label = tiles_match.group(1)
+        self.graphic_tiles_count = (width * height) // 64
+
+        if tiles_match.group(3) == '8':
+            self.graphic_tiles_count *= 2
+
+        graphics_indexes_match = header.find(r'_bn_gfxGraphicsIndexes\[([0-9]+)\] = \{([^}]*)\}')
+
+        if graphics_indexes_match is not None:
+            self.graphics_count = int(graphics_indexes_match.group(1))
+            self.graphics_indexes = [int(index) for index in graphics_indexes_match.group(2).replace(',', ' ').split()]
+        else:
+            self.graphics_count = int(header.search(r'compression_type::\w+, ([0-9]+)\)').group(1))
+            self.graphics_indexes = None
+
+    def graphics_key(self, graphics_index):
+        if graphics_index < 0 or graphics_index >= self.graphics_count:
+            raise ValueError('Invalid graphics index: ' + self.label + ' - ' + str(graphics_index))
+
+        if self.graphics_indexes is not None:
+            graphics_index = self.graphics_indexes[graphics_index]
+
+        return self.label, graphics_index
+
+
+class BgBlocksSimulator:
+    # Mirrors bg_blocks_manager placement: tiles are placed at the start of VRAM and maps at the end.
+
+    def __init__(self, max_items, allow_tiles_offset):
+        self.__max_items = max_items
+        self.__allow_tiles_offset = allow_tiles_offset
+        self.__items = [{'start': 0, 'count': bg_blocks_count, 'kind': None}]
+        self.__keys = {}
+        self.__free_blocks_count = bg_blocks_count
+        self.__compactions = 0
+
+    def create_tiles(self, tiles_info, affine):
+        key = tiles_info.label
+
+        if key is None or key not in self.__keys:
+            blocks_count = ceil_half_words_to_blocks(tiles_info.tiles_count * 16)
+
+            if not self.__allow_tiles_offset:
+                max_blocks_count = None
+            elif affine:
+                max_blocks_count = max_affine_tiles_blocks_count
+            elif tiles_info.bpp_8:
+                max_blocks_count = max_bpp_8_regular_tiles_blocks_count
+            else:
+                max_blocks_count = max_bpp_4_regular_tiles_blocks_count
+
+            self.__create(key, 'tiles', blocks_count, max_blocks_count)
+
+    def create_map(self, bg_info):
+        self.__create_map(bg_info.map_label, bg_info.width, bg_info.height, bg_info.affine)
+
+    def allocate_tiles(self, tiles_count, bpp_8):
+        self.create_tiles(TilesInfo(None, tiles_count, bpp_8), False)
+
+    def allocate_map(self, width, height):
+        self.__create_map(None, width, height, False)
+
+    def used_blocks_count(self, kind):
+        return sum(item['count'] for item in self.__items if item['kind'] == kind)
+
+    def padding_blocks_count(self):
+        return sum(item['count'] for item in self.__items if item['kind'] == 'padding')
+
+    def free_runs(self):
+        runs = []
+        run = 0
+
+        for item in self.__items:
+            if item['kind'] is None or item['kind'] == 'padding':
+                run += item['count']
+            elif run:
+                runs.append(run)
+                run = 0
+
+        if run:
+            runs.append(run)
+
+        return runs
+
+    def items_count(self):
+        return len(self.__items)
+
+    def compactions(self):
+        return self.__compactions
+
+    def layout(self):
+        characters = {None: '.', 'padding': '_', 'tiles': 'T', 'map': 'M'}
+        return ''.join(characters[item['kind']] * item['count'] for item in self.__items)
+
+    def __create_map(self, key, width, height, affine):
+        if key is None or key not in self.__keys:
+            if affine:
+                big = width != height or width not in [16, 32, 64, 128]
+                half_words = (32 * 32) // 2 if big else (width * height) // 2
+            else:
+                big = width > 64 or height > 64
+                half_words = 32 * 32 if big else width * height
+
+            self.__create(key, 'map', ceil_half_words_to_blocks(half_words), None)
+
+    def __padding(self, start_block, blocks_count, max_blocks_count):
+        extra_blocks_count = start_block % bg_tiles_alignment_blocks_count
+
+        if max_blocks_count is None:
+            return bg_tiles_alignment_blocks_count - extra_blocks_count if extra_blocks_count else 0
+
+        if blocks_count + extra_blocks_count > max_blocks_count:
+            return bg_tiles_alignment_blocks_count - extra_blocks_count
+
+        return 0
+
+    def __find_free_item(self, kind, blocks_count, max_blocks_count):
+        # Tiles use the first free item which fits them and maps the last one:
+        result = None
+
+        for index, item in enumerate(self.__items):
+            if item['kind'] is None or item['kind'] == 'padding':
+                padding = 0 if kind == 'map' else self.__padding(item['start'], blocks_count, max_blocks_count)
+
+                if item['count'] >= blocks_count + padding:
+                    result = (index, padding)
+
+                    if kind != 'map':
+                        break
+
+        return result
+
+    def __insert(self, index, item):
+        if len(self.__items) >= self.__max_items:
+            raise ValueError('No more BG block items available (BN_CFG_BG_BLOCKS_MAX_ITEMS: ' +
+                             str(self.__max_items) + ')')
+
+        self.__items.insert(index, item)
+
+    def __compact(self):
+        result = False
+        moved = True
+
+        while moved:
+            moved = False
+
+            for index in range(len(self.__items) - 1):
+                item = self.__items[index]
+                next_item = self.__items[index + 1]
+
+                if item['kind'] == 'map' and item['movable'] and next_item['kind'] in [None, 'padding']:
+                    start = item['start']
+                    item['start'] = start + next_item['count']
+                    next_item['start'] = start
+                    next_item['kind'] = None
+                    self.__items[index] = next_item
+                    self.__items[index + 1] = item
+
+                    if index > 0 and self.__items[index - 1]['kind'] in [None, 'padding']:
+                        self.__items[index - 1]['count'] += next_item['count']
+                        self.__items[index - 1]['kind'] = None
+                        del self.__items[index]
+
+                    moved = True
+                    result = True
+                    break
+
+        return result
+
+    def __create(self, key, kind, blocks_count, max_blocks_count):
+        found = None
+
+        if blocks_count <= self.__free_blocks_count:
+            found = self.__find_free_item(kind, blocks_count, max_blocks_count)
+
+            # Allocated items (the ones without key) don't compact VRAM:
+            if found is None and key is not None and self.__compact():
+                self.__compactions += 1
+                found = self.__find_free_item(kind, blocks_count, max_blocks_count)
+
+        if found is None:
+            raise ValueError('No more BG blocks available: ' + (key or 'allocated ' + kind) + ' needs ' +
+                             str(blocks_count) + ' blocks (free blocks: ' + str(self.__free_blocks_count) +
+                             ', layout: ' + self.layout() + ')')
+
+        index, padding = found
+        item = self.__items[index]
+
+        if padding:
+            new_item = {'start': item['start'] + padding, 'count': item['count'] - padding, 'kind': None}
+            item['count'] = padding
+            item['kind'] = 'padding'
+            self.__insert(index + 1, new_item)
+            index += 1
+            item = new_item
+
+        remaining_blocks_count = item['count'] - blocks_count
+
+        if remaining_blocks_count:
+            start = item['start']
+            alignment = bg_tiles_alignment_blocks_count
+            create_item_at_back = kind == 'map' and \
+                (start % alignment == 0 or start // alignment != (start + blocks_count - 1) // alignment)
+
+            if create_item_at_back:
+                item['count'] = remaining_blocks_count
+                item = {'start': start + remaining_blocks_count, 'count': blocks_count, 'kind': None}
+                self.__insert(index + 1, item)
+            else:
+                item['count'] = blocks_count
+                self.__insert(index + 1, {'start': start + blocks_count, 'count': remaining_blocks_count,
+                                          'kind': None})
+
+        # Only maps with source data can be moved:
+        item['kind'] = kind
+        item['movable'] = kind == 'map' and key is not None
+        self.__free_blocks_count -= blocks_count
+
+        if key is not None:
+            self.__keys[key] = item
+
+
+class SpriteTilesSimulator:
+    # Mirrors sprite_tiles_manager placement: the smallest free item with enough tiles is used.
+
+    def __init__(self, max_items):
+        self.__max_items = max_items
+        self.__items = [{'start': 0, 'count': sprite_tiles_count, 'used': False}]
+        self.__free_items = [self.__items[0]]
+        self.__keys = set()
+        self.__free_tiles_count = sprite_tiles_count
+
+    def create(self, key, tiles_count):
+        if key not in self.__keys:
+            self.__keys.add(key)
+            self.allocate(tiles_count)
+
+    def allocate(self, tiles_count):
+        item = None
+
+        if tiles_count <= self.__free_tiles_count:
+            for free_item in self.__free_items:
+                if free_item['count'] >= tiles_count:
+                    item = free_item
+                    break
+
+        if item is None:
+            raise ValueError('No more sprite tiles available: ' + str(tiles_count) + ' tiles needed (free tiles: ' +
+                             str(self.__free_tiles_count) + ', largest free run: ' +
+                             str(max(self.free_runs(), default=0)) + ')')
+
+        self.__free_items.remove(item)
+        new_free_tiles_count = item['count'] - tiles_count
+
+        if new_free_tiles_count:
+            if len(self.__items) >= self.__max_items:
+                raise ValueError('No more sprite tiles items available (BN_CFG_SPRITE_TILES_MAX_ITEMS: ' +
+                                 str(self.__max_items) + ')')
+
+            new_item = {'start': item['start'] + tiles_count, 'count': new_free_tiles_count, 'used': False}
+            self.__items.insert(self.__items.index(item) + 1, new_item)
+            insert_index = 0
+
+            while insert_index < len(self.__free_items) and \
+                    self.__free_items[insert_index]['count'] <= new_free_tiles_count:
+                insert_index += 1
+
+            self.__free_items.insert(insert_index, new_item)
+
+        item['count'] = tiles_count
+        item['used'] = True
+        self.__free_tiles_count -= tiles_count
+
+    def used_tiles_count(self):
+        return sprite_tiles_count - self.__free_tiles_count
+
+    def free_runs(self):
+        return [item['count'] for item in self.__items if not item['used']]
+
+    def items_count(self):
+        return len(self.__items)
+
+
+def fragmentation_label(free_runs):
+    free_count = sum(free_runs)
+
+    if free_count == 0:
+        return '0%'
+
+    return str(int(round(100 - (max(free_runs) * 100 / free_count)))) + '%'
+
+
+def parse_item_entry(entry):
+    # Entries are item names, optionally followed by a graphics index (for example, "hero:2"):
+    entry_split = str(entry).split(':')
+
+    if len(entry_split) == 1:
+        return entry_split[0], 0
+
+    if len(entry_split) == 2:
+        return entry_split[0], int(entry_split[1])
+
+    raise ValueError('Invalid item entry: ' + str(entry))
+
+
+def simulate_scene(scene, build_folder_path, bg_blocks_max_items, sprite_tiles_max_items, allow_tiles_offset):
+    bg_blocks = BgBlocksSimulator(bg_blocks_max_items, allow_tiles_offset)
+    sprite_tiles = SpriteTilesSimulator(sprite_tiles_max_items)
+
+    for name in scene.get('regular_bgs', []):
+        bg_info = BgInfo(build_folder_path, str(name), False)
+        bg_blocks.create_tiles(bg_info.tiles, False)
+        bg_blocks.create_map(bg_info)
+
+    for name in scene.get('affine_bgs', []):
+        bg_info = BgInfo(build_folder_path, str(name), True)
+        bg_blocks.create_tiles(bg_info.tiles, True)
+        bg_blocks.create_map(bg_info)
+
+    for name in scene.get('regular_bg_tiles', []):
+        bg_blocks.create_tiles(regular_bg_tiles_info(build_folder_path, str(name)), False)
+
+    for allocation in scene.get('allocated_regular_bg_tiles', []):
+        bg_blocks.allocate_tiles(int(allocation['tiles']), str(allocation.get('bpp_mode', 'bpp_4')) == 'bpp_8')
+
+    for allocation in scene.get('allocated_regular_bg_maps', []):
+        bg_blocks.allocate_map(int(allocation['width']), int(allocation['height']))
+
+    sprite_tiles_infos = {}
+
+    for sprite_item, items in [(True, scene.get('sprites', [])), (False, scene.get('sprite_tiles', []))]:
+        for entry in items:
+            name, graphics_index = parse_item_entry(entry)
+            sprite_tiles_info = sprite_tiles_infos.get((name, sprite_item))
+
+            if sprite_tiles_info is None:
+                sprite_tiles_info = SpriteTilesInfo(build_folder_path, name, sprite_item)
+                sprite_tiles_infos[(name, sprite_item)] = sprite_tiles_info
+
+            sprite_tiles.create(sprite_tiles_info.graphics_key(graphics_index),
+                                sprite_tiles_info.graphic_tiles_count)
+
+    for tiles_count in scene.get('allocated_sprite_tiles', []):
+        sprite_tiles.allocate(int(tiles_count))
+
+    return bg_blocks, sprite_tiles
+
+
+def write_scene_header(build_folder_path, scene_name, bg_blocks):
+    # Simulated layouts are written to a header, so they can be compared with the runtime ones:
+    if re.fullmatch(r'[a-z][a-z0-9_]*', scene_name) is None:
+        raise ValueError('Invalid scene name: ' + scene_name)
+
+    header_file_path = build_folder_path + '/bn_vram_scenes_' + scene_name + '.h'
+    include_guard = 'BN_VRAM_SCENES_' + scene_name.upper() + '_H'
+    header = '#ifndef ' + include_guard + '\n' + \
+             '#define ' + include_guard + '\n' + \
+             '\n' + \
+             '#include "bn_string_view.h"' + '\n' + \
+             '\n' + \
+             'namespace bn::vram_scenes' + '\n' + \
+             '{' + '\n' + \
+             '    constexpr inline string_view ' + scene_name + '_bg_blocks_layout("' + bg_blocks.layout() + '");\n' + \
+             '}' + '\n' + \
+             '\n' + \
+             '#endif' + '\n' + \
+             '\n'
+
+    try:
+        with open(header_file_path, 'r') as header_file:
+            if header_file.read() == header:
+                return
+    except OSError:
+        pass
+
+    with open(header_file_path, 'w') as header_file:
+        header_file.write(header)
+
+
+def process_scenes(scenes_folder_paths, build_folder_path, bg_blocks_max_items, sprite_tiles_max_items,
+                   allow_tiles_offset):
+    peak_bg_blocks_count = 0
+    peak_sprite_tiles_count = 0
+    scene_excs = []
+
+    for scenes_folder_path in scenes_folder_paths.split(' '):
+        for scene_file_name in sorted(os.listdir(scenes_folder_path)):
+            if not scene_file_name.endswith('.json'):
+                continue
+
+            scene_name = os.path.splitext(scene_file_name)[0]
+            scene_file_path = scenes_folder_path + '/' + scene_file_name
+
+            try:
+                try:
+                    with open(scene_file_path) as scene_file:
+                        scene = json.load(scene_file)
+                except Exception as exception:
+                    raise ValueError(scene_file_path + ' scene json file parse failed: ' + str(exception))
+
+                bg_blocks, sprite_tiles = simulate_scene(scene, build_folder_path, bg_blocks_max_items,
+                                                         sprite_tiles_max_items, allow_tiles_offset)
+                write_scene_header(build_folder_path, scene_name, bg_blocks)
+            except Exception as exc:
+                scene_excs.append([scene_name, exc])
+                continue
+
+            tile_blocks_count = bg_blocks.used_blocks_count('tiles')
+            map_blocks_count = bg_blocks.used_blocks_count('map')
+            used_blocks_count = tile_blocks_count + map_blocks_count
+            bg_free_runs = bg_blocks.free_runs()
+            sprite_free_runs = sprite_tiles.free_runs()
+            peak_bg_blocks_count = max(peak_bg_blocks_count, used_blocks_count)
+            peak_sprite_tiles_count = max(peak_sprite_tiles_count, sprite_tiles.used_tiles_count())
+
+            print('    ' + scene_name + ' scene:')
+            print('        BG blocks: ' + str(used_blocks_count) + '/' + str(bg_blocks_count) + ' used (tiles: ' +
+                  str(tile_blocks_count) + ', maps: ' + str(map_blocks_count) + '), alignment padding: ' +
+                  str(bg_blocks.padding_blocks_count()) + ', fragmentation: ' + fragmentation_label(bg_free_runs) +
+                  ', items: ' + str(bg_blocks.items_count()) + '/' + str(bg_blocks_max_items) +
+                  (', compactions: ' + str(bg_blocks.compactions()) if bg_blocks.compactions() else ''))
+            print('        BG blocks layout: ' + bg_blocks.layout())
+            print('        Sprite tiles: ' + str(sprite_tiles.used_tiles_count()) + '/' + str(sprite_tiles_count) +
+                  ' used, fragmentation: ' + fragmentation_label(sprite_free_runs) + ', items: ' +
+                  str(sprite_tiles.items_count()) + '/' + str(sprite_tiles_max_items))
+
+    print('    ' + 'Peak VRAM usage: ' + str(peak_bg_blocks_count) + ' BG blocks (' +
+          str(peak_bg_blocks_count * bg_block_half_words * 2) + ' bytes), ' + str(peak_sprite_tiles_count) +
+          ' sprite tiles (' + str(peak_sprite_tiles_count * 32) + ' bytes)')
+    sys.stdout.flush()
+
+    if len(scene_excs) > 0:
+        for scene_exc in scene_excs:
+            sys.stderr.write(str(scene_exc[0]) + ' scene error: ' + str(scene_exc[1]) + '\n')
+
+        exit(-1)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Butano VRAM budget tool.')
+    parser.add_argument('--scenes', required=True, help='scenes folder paths')
+    parser.add_argument('--build', required=True, help='build folder path')
+    parser.add_argument('--bg_blocks_max_items', type=int, default=16, help='BN_CFG_BG_BLOCKS_MAX_ITEMS value')
+    parser.add_argument('--sprite_tiles_max_items', type=int, default=128,
+                        help='BN_CFG_SPRITE_TILES_MAX_ITEMS value')
+    parser.add_argument('--no_tiles_offset', action='store_true',
+                        help='simulate bn::bg_tiles::set_allow_offset(false)')
+
+    try:
+        args = parser.parse_args()
+        process_scenes(args.scenes, args.build, args.bg_blocks_max_items, args.sprite_tiles_max_items,
+                       not args.no_tiles_offset)
+    except Exception as ex:
+        sys.stderr.write('Error: ' + str(ex) + '\n')
+        traceback.print_exc()
+        exit(-1)
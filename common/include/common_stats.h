@@ -42,9 +42,11 @@ public:
 
 private:
     bn::sprite_text_generator& _text_generator;
-    bn::vector<bn::sprite_ptr, 8> _static_text_sprites;
+    bn::vector<bn::sprite_ptr, 10> _static_text_sprites;
     bn::vector<bn::sprite_ptr, 2> _text_sprites;
+    bn::vector<bn::sprite_ptr, 4> _heap_text_sprites;
     bn::fixed_point _text_position;
+    bn::fixed_point _heap_text_position;
     bn::fixed _max_cpu_usage;
     mode_type _mode = mode_type::SIMPLE;
     int _counter = 0;
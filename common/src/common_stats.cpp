@@ -27,6 +27,7 @@ void stats::set_mode(mode_type mode)
     _mode = mode;
     _static_text_sprites.clear();
     _text_sprites.clear();
+    _heap_text_sprites.clear();
     _max_cpu_usage = 0;
     _counter = 0;
 
@@ -66,6 +67,11 @@ void stats::set_mode(mode_type mode)
             text_stream.append("B");
             _text_generator.generate(text_x, _text_position.y() + (text_height * 2), text, _static_text_sprites);
 
+            bn::string_view heap_label = "HEAP: ";
+            _heap_text_position = bn::fixed_point(text_x + _text_generator.width(heap_label),
+                                                  _text_position.y() + (text_height * 3));
+            _text_generator.generate(text_x, _heap_text_position.y(), heap_label, _static_text_sprites);
+
             _text_generator.set_bg_priority(old_bg_priority);
         }
         break;
@@ -128,6 +134,20 @@ void stats::update()
         text_stream.append("%");
         _text_sprites.clear();
         _text_generator.generate(_text_position, text, _text_sprites);
+
+        if(_mode == mode_type::DETAILED)
+        {
+            // Used bytes and size of the biggest free block, to spot heap fragmentation:
+            bn::allocator_stats heap_stats = bn::memory::alloc_ewram_stats();
+            text.clear();
+            text_stream.append(heap_stats.used_bytes());
+            text_stream.append("B/");
+            text_stream.append(heap_stats.largest_free_bytes());
+            text_stream.append("B");
+            _heap_text_sprites.clear();
+            _text_generator.generate(_heap_text_position, text, _heap_text_sprites);
+        }
+
         _text_generator.set_bg_priority(old_bg_priority);
 
         _max_cpu_usage = 0;
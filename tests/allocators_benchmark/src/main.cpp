@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_core.h"
+#include "bn_log.h"
+#include "bn_timer.h"
+#include "bn_colors.h"
+#include "bn_memory.h"
+#include "bn_random.h"
+#include "bn_string.h"
+#include "bn_sstream.h"
+#include "bn_bg_palettes.h"
+#include "bn_tlsf_allocator.h"
+#include "bn_best_fit_allocator.h"
+#include "bn_sprite_text_generator.h"
+
+#include "common_info.h"
+#include "common_variable_8x16_sprite_font.h"
+
+namespace
+{
+    constexpr int buffer_bytes = 64 * 1024;
+    constexpr int max_live_items = 512;
+    constexpr int iterations = 256;
+
+    template<class Allocator>
+    [[nodiscard]] int benchmark(void* buffer, int live_items)
+    {
+        Allocator allocator(buffer, buffer_bytes);
+        bn::vector<void*, max_live_items> items;
+        bn::random random;
+
+        // Fill the allocator and free half of the items to fragment it:
+
+        for(int index = 0; index < live_items; ++index)
+        {
+            void* item = allocator.alloc(8 + random.get_int(120));
+            BN_ASSERT(item, "Allocation failed");
+            items.push_back(item);
+        }
+
+        for(int index = 0; index < live_items; index += 2)
+        {
+            allocator.free(items[index]);
+            items[index] = nullptr;
+        }
+
+        bn::timer timer;
+
+        for(int index = 0; index < iterations; ++index)
+        {
+            void* item = allocator.alloc(8 + random.get_int(120));
+            BN_ASSERT(item, "Allocation failed");
+            allocator.free(item);
+        }
+
+        int elapsed_ticks = timer.elapsed_ticks();
+
+        for(void* item : items)
+        {
+            allocator.free(item);
+        }
+
+        return elapsed_ticks / iterations;
+    }
+}
+
+int main()
+{
+    bn::core::init();
+
+    bn::sprite_text_generator text_generator(common::variable_8x16_sprite_font);
+    bn::bg_palettes::set_transparent_color(bn::colors::gray);
+
+    void* buffer = bn::memory::ewram_alloc(buffer_bytes);
+    BN_ASSERT(buffer, "Buffer allocation failed");
+
+    constexpr int live_items_array[] = { 32, 128, 512 };
+    bn::vector<bn::string<32>, 4> results;
+    results.push_back("Ticks per alloc + free:");
+
+    for(int live_items : live_items_array)
+    {
+        int best_fit_ticks = benchmark<bn::best_fit_allocator>(buffer, live_items);
+        int tlsf_ticks = benchmark<bn::tlsf_allocator>(buffer, live_items);
+        BN_LOG("Live items: ", live_items, " - best fit: ", best_fit_ticks, " - TLSF: ", tlsf_ticks);
+
+        bn::string<32>& result = results.emplace_back();
+        bn::ostringstream result_stream(result);
+        result_stream << live_items << " items: BF " << best_fit_ticks << " TLSF " << tlsf_ticks;
+    }
+
+    bn::memory::ewram_free(buffer);
+
+    bn::string_view info_text_lines[4];
+
+    for(int index = 0; index < 4; ++index)
+    {
+        info_text_lines[index] = results[index];
+    }
+
+    common::info info("Allocators benchmark", info_text_lines, text_generator);
+    info.set_show_always(true);
+
+    while(true)
+    {
+        info.update();
+        bn::core::update();
+    }
+}
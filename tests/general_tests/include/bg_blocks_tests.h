@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BG_BLOCKS_TESTS_H
+#define BG_BLOCKS_TESTS_H
+
+#include "bn_core.h"
+#include "bn_optional.h"
+#include "bn_bg_palette_ptr.h"
+#include "bn_regular_bg_ptr.h"
+#include "bn_dynamic_vector.h"
+#include "bn_bg_palette_item.h"
+#include "bn_regular_bg_map_ptr.h"
+#include "bn_regular_bg_map_item.h"
+#include "bn_regular_bg_tiles_ptr.h"
+#include "bn_regular_bg_tiles_item.h"
+#include "tests.h"
+
+class bg_blocks_tests : public tests
+{
+
+public:
+    bg_blocks_tests() :
+        tests("bg_blocks")
+    {
+        // Release the items of previous tests:
+        bn::core::update();
+
+        bn::color colors[16];
+        bn::bg_palette_ptr palette = bn::bg_palette_ptr::create_new(bn::bg_palette_item(colors, bn::bpp_mode::BPP_4));
+        bn::regular_bg_tiles_ptr tiles = bn::regular_bg_tiles_ptr::allocate(1024, bn::bpp_mode::BPP_4);
+        BN_ASSERT(tiles.id() == 0);
+
+        // Tiles are placed at the start of VRAM and maps at the end:
+        bn::dynamic_vector<bn::regular_bg_map_cell> a_cells(32 * 32, 1);
+        bn::dynamic_vector<bn::regular_bg_map_cell> b_cells(32 * 32, 2);
+        bn::dynamic_vector<bn::regular_bg_map_cell> c_cells(32 * 32, 3);
+        bn::regular_bg_map_ptr a_map = _create_map(a_cells, tiles, palette);
+        bn::optional<bn::regular_bg_map_ptr> b_map = _create_map(b_cells, tiles, palette);
+        bn::regular_bg_map_ptr c_map = _create_map(c_cells, tiles, palette);
+        BN_ASSERT(a_map.id() == 31);
+        BN_ASSERT(b_map->id() == 30);
+        BN_ASSERT(c_map.id() == 29);
+
+        bn::regular_bg_ptr c_bg = bn::regular_bg_ptr::create(0, 0, c_map);
+        bn::core::update();
+        BN_ASSERT(_bg_cnt_blocks(c_map, tiles));
+
+        // 14 free blocks split in two runs of 13 and 1 blocks, so the C map is moved to join them:
+        b_map.reset();
+
+        bn::dynamic_vector<bn::tile> new_tiles_data(896);
+        bn::span<const bn::tile> new_tiles_ref(new_tiles_data.data(), new_tiles_data.size());
+        bn::regular_bg_tiles_ptr new_tiles = bn::regular_bg_tiles_ptr::create_new(
+                    bn::regular_bg_tiles_item(new_tiles_ref, bn::bpp_mode::BPP_4));
+        BN_ASSERT(new_tiles.id() == 16);
+        BN_ASSERT(c_map.id() == 30);
+        BN_ASSERT(a_map.id() == 31);
+
+        bn::core::update();
+        BN_ASSERT(_bg_cnt_blocks(c_map, tiles));
+
+        auto vram = reinterpret_cast<const volatile bn::regular_bg_map_cell*>(0x06000000 + (c_map.id() * 2048));
+        int offset = (c_map.palette_banks_offset() << 12) + c_map.tiles_offset();
+
+        for(int index = 0; index < 32 * 32; ++index)
+        {
+            BN_ASSERT(vram[index] == c_cells[index] + offset, "Moved map not committed: ", index);
+        }
+    }
+
+private:
+    [[nodiscard]] static bn::regular_bg_map_ptr _create_map(
+            const bn::ivector<bn::regular_bg_map_cell>& cells, const bn::regular_bg_tiles_ptr& tiles,
+            const bn::bg_palette_ptr& palette)
+    {
+        bn::regular_bg_map_item map_item(cells[0], bn::size(32, 32));
+        return bn::regular_bg_map_ptr::create_new(map_item, tiles, palette);
+    }
+
+    // Checks the BG control register of the only enabled BG:
+    [[nodiscard]] static bool _bg_cnt_blocks(const bn::regular_bg_map_ptr& map,
+                                             const bn::regular_bg_tiles_ptr& tiles)
+    {
+        auto display_cnt = *reinterpret_cast<const volatile uint16_t*>(0x04000000);
+
+        for(int bg = 0; bg < 4; ++bg)
+        {
+            if(display_cnt & (0x100 << bg))
+            {
+                auto bg_cnt = *reinterpret_cast<const volatile uint16_t*>(0x04000008 + (bg * 2));
+                int sbb = (bg_cnt >> 8) & 0x1F;
+                int cbb = (bg_cnt >> 2) & 0x3;
+                return sbb == map.id() && cbb == tiles.id() / 8;
+            }
+        }
+
+        return false;
+    }
+};
+
+#endif
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BITMAP_BG_TESTS_H
+#define BITMAP_BG_TESTS_H
+
+#include "bn_core.h"
+#include "bn_color.h"
+#include "bn_bitmap_bg_ptr.h"
+#include "bn_config_bgs.h"
+#include "tests.h"
+
+class bitmap_bg_tests : public tests
+{
+
+public:
+    bitmap_bg_tests() :
+        tests("bitmap_bg")
+    {
+        constexpr int canvas_pixels = 240 * 160;
+        constexpr int frames = (canvas_pixels / BN_CFG_BGS_BITMAP_MAX_COMMITTED_PIXELS) + 1;
+
+        bn::bitmap_bg_ptr bitmap_bg = bn::bitmap_bg_ptr::create(bn::bitmap_bg_mode::MODE_3);
+        bn::color color(31, 0, 0);
+
+        // Redrawing the whole canvas every frame must not prevent the bottom scanlines from being uploaded:
+        for(int frame = 0; frame < frames; ++frame)
+        {
+            bitmap_bg.clear(color);
+            bn::core::update();
+        }
+
+        auto vram = reinterpret_cast<const volatile uint16_t*>(0x06000000);
+
+        for(int index = canvas_pixels - 240; index < canvas_pixels; ++index)
+        {
+            BN_ASSERT(vram[index] == color.data(), "Scanline not uploaded: ", index / 240);
+        }
+    }
+};
+
+#endif
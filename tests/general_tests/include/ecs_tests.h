@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef ECS_TESTS_H
+#define ECS_TESTS_H
+
+#include "bn_ecs.h"
+#include "tests.h"
+
+class ecs_tests : public tests
+{
+
+public:
+    ecs_tests() :
+        tests("ecs")
+    {
+        bn::ecs::entity_registry<4> registry;
+        bn::ecs::component_set<int, 4> ints;
+        bn::ecs::component_set<char, 4, 2> chars;
+        BN_ASSERT(registry.empty());
+
+        bn::ecs::entity a = registry.create();
+        bn::ecs::entity b = registry.create();
+        bn::ecs::entity c = registry.create();
+        BN_ASSERT(registry.size() == 3);
+        BN_ASSERT(registry.contains(a) && registry.contains(b) && registry.contains(c));
+
+        ints.insert(a, 1);
+        ints.insert(b, 2);
+        ints.insert(c, 3);
+        chars.insert(c, 'c');
+        chars.insert(a, 'a');
+        BN_ASSERT(chars.full());
+
+        int sum = 0;
+        bn::ecs::for_each([&sum](bn::ecs::entity, int& value, char character)
+        {
+            sum += value + character;
+        }, ints, chars);
+
+        BN_ASSERT(sum == 1 + 'a' + 3 + 'c');
+
+        BN_ASSERT(ints.erase(a));
+        BN_ASSERT(! ints.erase(a));
+        BN_ASSERT(ints.size() == 2);
+        BN_ASSERT(ints[b] == 2 && ints[c] == 3);
+
+        registry.destroy(c, ints, chars);
+        BN_ASSERT(! registry.contains(c));
+        BN_ASSERT(! ints.contains(c) && ! chars.contains(c));
+        BN_ASSERT(chars.size() == 1 && chars[a] == 'a');
+
+        // Destroyed entity indexes are recycled, but with a new generation:
+        bn::ecs::entity d = registry.create();
+        BN_ASSERT(bn::ecs::entity_index(d) == bn::ecs::entity_index(c));
+        BN_ASSERT(d != c);
+        BN_ASSERT(registry.contains(d) && ! registry.contains(c));
+
+        ints.insert(d, 4);
+        BN_ASSERT(ints.contains(d) && ! ints.contains(c));
+        BN_ASSERT(! ints.find(c));
+        BN_ASSERT(ints.index(c) == -1);
+        BN_ASSERT(! ints.erase(c));
+        BN_ASSERT(ints[d] == 4);
+
+        registry.clear();
+        BN_ASSERT(registry.empty());
+        BN_ASSERT(! registry.contains(a) && ! registry.contains(d));
+    }
+};
+
+#endif
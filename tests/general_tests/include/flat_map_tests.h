@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef FLAT_MAP_TESTS_H
+#define FLAT_MAP_TESTS_H
+
+#include "bn_array.h"
+#include "bn_flat_set.h"
+#include "bn_flat_map.h"
+#include "tests.h"
+
+class flat_map_tests : public tests
+{
+
+public:
+    flat_map_tests() :
+        tests("flat_map")
+    {
+        bn::flat_map<int, int, 8> map;
+        BN_ASSERT(map.empty());
+
+        BN_ASSERT(map.insert(3, 30) != map.end());
+        BN_ASSERT(map.insert(1, 10) != map.end());
+        BN_ASSERT(map.insert(2, 20) != map.end());
+        BN_ASSERT(map.insert(2, 21) == map.end());
+        BN_ASSERT(map.size() == 3);
+        BN_ASSERT(map.begin()->first == 1 && (map.end() - 1)->first == 3);
+        BN_ASSERT(map.at(2) == 20);
+
+        map.insert_or_assign(2, 22);
+        map[5] = 50;
+        BN_ASSERT(map.at(2) == 22 && map.at(5) == 50);
+        BN_ASSERT(! map.contains(4));
+        BN_ASSERT(map.lower_bound(4)->first == 5);
+        BN_ASSERT(map.upper_bound(3)->first == 5);
+
+        bn::array<bn::pair<int, int>, 5> sorted_values = {{ { 0, 0 }, { 2, 0 }, { 4, 40 }, { 4, 41 }, { 6, 60 } }};
+        map.insert_sorted(sorted_values.begin(), sorted_values.end());
+        BN_ASSERT(map.size() == 7);
+        BN_ASSERT(map.at(0) == 0 && map.at(2) == 22 && map.at(4) == 40 && map.at(6) == 60);
+
+        for(auto it = map.begin() + 1, end = map.end(); it != end; ++it)
+        {
+            BN_ASSERT((it - 1)->first < it->first);
+        }
+
+        BN_ASSERT(map.erase(3));
+        BN_ASSERT(! map.erase(3));
+        BN_ASSERT(erase_if(map, [](const bn::pair<int, int>& value){ return value.first % 2; }) == 2);
+        BN_ASSERT(map.size() == 4);
+
+        bn::flat_map<int, int, 8> map_copy(map);
+        BN_ASSERT(map_copy == map);
+
+        map.clear();
+        BN_ASSERT(map.empty());
+        BN_ASSERT(map_copy != map);
+
+        bn::flat_set<int, 8> set;
+        BN_ASSERT(set.insert(7) != set.end());
+        BN_ASSERT(set.insert(3) != set.end());
+        BN_ASSERT(set.insert(7) == set.end());
+        BN_ASSERT(set.size() == 2 && *set.begin() == 3);
+
+        bn::array<int, 5> sorted_keys = { 1, 3, 5, 5, 9 };
+        set.insert_sorted(sorted_keys.begin(), sorted_keys.end());
+        BN_ASSERT(set.size() == 5);
+
+        int keys[] = { 1, 3, 5, 7, 9 };
+        int index = 0;
+
+        for(int key : set)
+        {
+            BN_ASSERT(key == keys[index]);
+            ++index;
+        }
+
+        BN_ASSERT(set.erase(5));
+        BN_ASSERT(! set.contains(5));
+        BN_ASSERT(*set.lower_bound(5) == 7);
+    }
+};
+
+#endif
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef FUNCTION_TESTS_H
+#define FUNCTION_TESTS_H
+
+#include "bn_function.h"
+#include "tests.h"
+
+[[nodiscard]] inline int function_tests_twice(int value)
+{
+    return value * 2;
+}
+
+class function_tests : public tests
+{
+
+public:
+    function_tests() :
+        tests("function")
+    {
+        bn::function<int(int)> empty_function;
+        BN_ASSERT(! empty_function.has_value());
+        BN_ASSERT(! empty_function);
+
+        bn::function<int(int)> pointer_function = function_tests_twice;
+        BN_ASSERT(pointer_function.has_value());
+        BN_ASSERT(pointer_function(2) == 4);
+
+        int counter = 0;
+        bn::function<int(int)> lambda_function = [&counter](int value)
+        {
+            counter += value;
+            return counter;
+        };
+
+        BN_ASSERT(lambda_function(1) == 1);
+        BN_ASSERT(lambda_function(2) == 3);
+        BN_ASSERT(counter == 3);
+
+        bn::function<int(int), 16> copied_function(lambda_function);
+        BN_ASSERT(copied_function(3) == 6);
+
+        bn::ifunction<int(int)>& ifunction = copied_function;
+        ifunction = pointer_function;
+        BN_ASSERT(copied_function(3) == 6);
+        BN_ASSERT(counter == 6);
+
+        lambda_function.swap(empty_function);
+        BN_ASSERT(! lambda_function);
+        BN_ASSERT(empty_function(1) == 7);
+
+        empty_function.reset();
+        BN_ASSERT(! empty_function.has_value());
+    }
+};
+
+#endif
@@ -6,8 +6,12 @@
 #ifndef MEMORY_TESTS_H
 #define MEMORY_TESTS_H
 
+#include "bn_core.h"
 #include "bn_memory.h"
 #include "bn_cstdlib.h"
+#include "bn_frame_arena.h"
+#include "bn_dynamic_vector.h"
+#include "bn_dynamic_unordered_map.h"
 #include "tests.h"
 
 class memory_tests : public tests
@@ -38,6 +42,64 @@ public:
         bn::free(ptr);
         BN_ASSERT(bn::memory::used_alloc_ewram() == 0);
 
+        {
+            bn::dynamic_vector<int> dynamic_vector;
+            BN_ASSERT(dynamic_vector.capacity() == 0);
+            BN_ASSERT(bn::memory::used_alloc_ewram() == 0);
+
+            for(int index = 0; index < 100; ++index)
+            {
+                dynamic_vector.push_back(index);
+            }
+
+            BN_ASSERT(dynamic_vector.size() == 100);
+            BN_ASSERT(dynamic_vector.capacity() >= 100);
+            BN_ASSERT(dynamic_vector[99] == 99);
+            BN_ASSERT(bn::memory::used_alloc_ewram() > 0);
+
+            bn::ivector<int>& ivector = dynamic_vector;
+            BN_ASSERT(ivector.back() == 99);
+
+            dynamic_vector.shrink_to_fit();
+            dynamic_vector.push_back(dynamic_vector[0]);
+            dynamic_vector.emplace_back(dynamic_vector[1]);
+            BN_ASSERT(dynamic_vector.size() == 102);
+            BN_ASSERT(dynamic_vector[100] == 0);
+            BN_ASSERT(dynamic_vector[101] == 1);
+
+            dynamic_vector.clear();
+            dynamic_vector.shrink_to_fit();
+            BN_ASSERT(dynamic_vector.capacity() == 0);
+            BN_ASSERT(bn::memory::used_alloc_ewram() == 0);
+
+            bn::dynamic_unordered_map<int, int> dynamic_map;
+
+            for(int index = 0; index < 100; ++index)
+            {
+                dynamic_map[index] = index * 2;
+            }
+
+            BN_ASSERT(dynamic_map.size() == 100);
+            BN_ASSERT(dynamic_map.at(50) == 100);
+        }
+
+        BN_ASSERT(bn::memory::used_alloc_ewram() == 0);
+
+        int available_frame_arena_ewram = bn::frame_arena::available_ewram();
+        BN_ASSERT(bn::frame_arena::used_ewram() == 0);
+
+        ptr = bn::frame_arena::ewram_alloc(5);
+        BN_ASSERT(ptr);
+        BN_ASSERT(bn::aligned<4>(ptr));
+        BN_ASSERT(bn::frame_arena::used_ewram() == 8);
+        BN_ASSERT(bn::frame_arena::available_ewram() == available_frame_arena_ewram - 8);
+        BN_ASSERT(! bn::frame_arena::ewram_alloc(available_frame_arena_ewram));
+
+        bn::core::update();
+        BN_ASSERT(bn::frame_arena::used_ewram() == 0);
+        BN_ASSERT(bn::memory::max_used_stack_iwram() >= current_used_stack_iwram);
+        BN_ASSERT(bn::frame_arena::available_ewram() == available_frame_arena_ewram);
+
         uint32_t u32_array[3];
         BN_ASSERT(bn::aligned<4>(u32_array));
         BN_ASSERT(bn::aligned<4>(static_cast<const void*>(u32_array)));
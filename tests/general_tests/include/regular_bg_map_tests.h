@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef REGULAR_BG_MAP_TESTS_H
+#define REGULAR_BG_MAP_TESTS_H
+
+#include "bn_core.h"
+#include "bn_rect.h"
+#include "bn_bg_palette_ptr.h"
+#include "bn_dynamic_vector.h"
+#include "bn_bg_palette_item.h"
+#include "bn_config_bg_blocks.h"
+#include "bn_regular_bg_map_ptr.h"
+#include "bn_regular_bg_map_item.h"
+#include "bn_regular_bg_tiles_ptr.h"
+#include "tests.h"
+
+class regular_bg_map_tests : public tests
+{
+
+public:
+    regular_bg_map_tests() :
+        tests("regular_bg_map")
+    {
+        // 64x32 maps are stored in two screenblocks (64 VRAM rows):
+        static_assert(BN_CFG_BG_BLOCKS_MAX_DIRTY_ROWS < 64);
+
+        bn::color colors[16];
+        bn::dynamic_vector<bn::regular_bg_map_cell> cells(64 * 32);
+        bn::regular_bg_map_item map_item(cells[0], bn::size(64, 32));
+        bn::regular_bg_map_ptr map = bn::regular_bg_map_ptr::create_new(
+                    map_item, bn::regular_bg_tiles_ptr::allocate(16, bn::bpp_mode::BPP_4),
+                    bn::bg_palette_ptr::create_new(bn::bg_palette_item(colors, bn::bpp_mode::BPP_4)));
+        bn::core::update();
+        BN_ASSERT(_vram_matches(map, cells, 0, 64 * 32));
+
+        // Spans of the same row are merged, so only cells [1..5] of the first row are uploaded:
+        cells[3] = 9;
+        cells[6] = 9;
+        map.set_cell(5, 0, 2);
+        map.set_cell(1, 0, 1);
+        map.set_cells(bn::rect(33, 1, 2, 2), bn::span<const bn::regular_bg_map_cell>(rect_cells, 4));
+        bn::core::update();
+        BN_ASSERT(_vram_matches(map, cells, 0, 6));
+        BN_ASSERT(! _vram_matches(map, cells, 6, 1));
+        BN_ASSERT(_vram_matches(map, cells, 1024, 1024));
+
+        // Too many dirty rows, so the whole map is uploaded:
+        for(int y = 0; y < 32; ++y)
+        {
+            map.set_cell(0, y, 3);
+            map.set_cell(32, y, 3);
+        }
+
+        bn::core::update();
+        BN_ASSERT(_vram_matches(map, cells, 0, 64 * 32));
+    }
+
+private:
+    static constexpr bn::regular_bg_map_cell rect_cells[] = { 4, 5, 6, 7 };
+
+    [[nodiscard]] static bool _vram_matches(const bn::regular_bg_map_ptr& map,
+                                            const bn::ivector<bn::regular_bg_map_cell>& cells, int first, int count)
+    {
+        auto vram = reinterpret_cast<const volatile bn::regular_bg_map_cell*>(0x06000000 + (map.id() * 2048));
+        int offset = (map.palette_banks_offset() << 12) + map.tiles_offset();
+
+        for(int index = first; index < first + count; ++index)
+        {
+            if(vram[index] != cells[index] + offset)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPSC_QUEUE_TESTS_H
+#define SPSC_QUEUE_TESTS_H
+
+#include "bn_spsc_queue.h"
+#include "tests.h"
+
+class spsc_queue_tests : public tests
+{
+
+public:
+    spsc_queue_tests() :
+        tests("spsc_queue")
+    {
+        bn::spsc_queue<int, 4> queue;
+        BN_ASSERT(queue.empty());
+        BN_ASSERT(queue.max_size() == 4);
+
+        BN_ASSERT(queue.push(1));
+        BN_ASSERT(queue.push(2));
+        BN_ASSERT(queue.emplace(3));
+        BN_ASSERT(queue.push(4));
+        BN_ASSERT(queue.full());
+        BN_ASSERT(! queue.push(5));
+        BN_ASSERT(queue.size() == 4);
+        BN_ASSERT(queue.front() == 1);
+
+        int value = 0;
+        BN_ASSERT(queue.pop(value));
+        BN_ASSERT(value == 1);
+        queue.pop();
+        BN_ASSERT(queue.available() == 2);
+
+        // Indexes wrap around the buffer:
+        for(int index = 5; index < 100; ++index)
+        {
+            BN_ASSERT(queue.push(index));
+            BN_ASSERT(queue.pop(value));
+            BN_ASSERT(value == index - 2);
+        }
+
+        BN_ASSERT(queue.size() == 2);
+        BN_ASSERT(queue.front() == 98);
+
+        queue.clear();
+        BN_ASSERT(queue.empty());
+        BN_ASSERT(! queue.pop(value));
+    }
+};
+
+#endif
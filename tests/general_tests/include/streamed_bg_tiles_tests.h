@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef STREAMED_BG_TILES_TESTS_H
+#define STREAMED_BG_TILES_TESTS_H
+
+#include "bn_core.h"
+#include "bn_tile.h"
+#include "bn_dynamic_vector.h"
+#include "bn_bg_palette_ptr.h"
+#include "bn_regular_bg_ptr.h"
+#include "bn_bg_palette_item.h"
+#include "bn_regular_bg_map_ptr.h"
+#include "bn_regular_bg_map_item.h"
+#include "bn_regular_bg_tiles_ptr.h"
+#include "tests.h"
+
+class streamed_bg_tiles_tests : public tests
+{
+
+public:
+    streamed_bg_tiles_tests() :
+        tests("streamed_bg_tiles")
+    {
+        // Release the items of previous tests:
+        bn::core::update();
+
+        // Each tile is filled with its pool index:
+        bn::dynamic_vector<bn::tile> pool(pool_tiles_count);
+
+        for(int pool_tile = 0; pool_tile < pool_tiles_count; ++pool_tile)
+        {
+            for(uint32_t& tile_word : pool[pool_tile].data)
+            {
+                tile_word = uint32_t(pool_tile);
+            }
+        }
+
+        // Each map column uses 4 unique tiles, so the whole map uses more unique tiles than the cache holds,
+        // but the visible ones always fit in it:
+        bn::dynamic_vector<bn::regular_bg_map_cell> cells(map_width * map_height);
+
+        for(int y = 0; y < map_height; ++y)
+        {
+            for(int x = 0; x < map_width; ++x)
+            {
+                cells[(y * map_width) + x] = bn::regular_bg_map_cell((x * 4) + (y % 4));
+            }
+        }
+
+        bn::color colors[16];
+        bn::bg_palette_ptr palette = bn::bg_palette_ptr::create_new(bn::bg_palette_item(colors, bn::bpp_mode::BPP_4));
+        bn::regular_bg_tiles_ptr tiles = bn::regular_bg_tiles_ptr::create_streamed(
+                    bn::span<const bn::tile>(pool.data(), pool.size()), bn::bpp_mode::BPP_4, cache_tiles_count);
+        bn::regular_bg_map_item map_item(cells[0], bn::size(map_width, map_height));
+        BN_ASSERT(map_item.big());
+
+        bn::regular_bg_map_ptr map = bn::regular_bg_map_ptr::create(map_item, tiles, palette);
+        bn::regular_bg_ptr bg = bn::regular_bg_ptr::create(0, 0, map);
+        constexpr int max_x = ((map_width * 8) - 240) / 2;
+
+        // Scroll to the right end of the map and back to its left end:
+        for(int x = 0; x <= max_x; x += 8)
+        {
+            bg.set_x(-x);
+            bn::core::update();
+        }
+
+        BN_ASSERT(_vram_cells_valid(map, tiles));
+
+        for(int x = max_x; x >= -max_x; x -= 8)
+        {
+            bg.set_x(-x);
+            bn::core::update();
+        }
+
+        BN_ASSERT(_vram_cells_valid(map, tiles));
+    }
+
+private:
+    static constexpr int map_width = 128;
+    static constexpr int map_height = 32;
+    static constexpr int pool_tiles_count = map_width * 4;
+    static constexpr int cache_tiles_count = 256;
+
+    // Checks that every visible VRAM cell references a cache tile which holds the pool tile of its map cell
+    // (the map is vertically centered, so the visible rows are always the same):
+    [[nodiscard]] static bool _vram_cells_valid(const bn::regular_bg_map_ptr& map,
+                                                const bn::regular_bg_tiles_ptr& tiles)
+    {
+        auto vram_cells = reinterpret_cast<const volatile uint16_t*>(0x06000000 + (map.id() * 2048));
+        auto vram_tiles = reinterpret_cast<const volatile uint32_t*>(0x06000000 + (tiles.cbb() * 16384));
+        constexpr int first_visible_row = ((map_height * 8) - 160) / 16;
+
+        for(int vram_y = first_visible_row; vram_y < first_visible_row + 21; ++vram_y)
+        {
+            for(int vram_x = 0; vram_x < 32; ++vram_x)
+            {
+                int tile_index = vram_cells[(vram_y * 32) + vram_x] & 0x3FF;
+                int pool_tile = int(vram_tiles[tile_index * 8]);
+
+                if(pool_tile % 4 != vram_y % 4 || (pool_tile / 4) % 32 != vram_x)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef TILE_COLLISION_MAP_TESTS_H
+#define TILE_COLLISION_MAP_TESTS_H
+
+#include "bn_rect.h"
+#include "bn_tile_collision_map.h"
+#include "tests.h"
+
+class tile_collision_map_tests : public tests
+{
+
+public:
+    tile_collision_map_tests() :
+        tests("tile_collision_map")
+    {
+        _word_boundary_tests<31>();
+        _word_boundary_tests<32>();
+        _word_boundary_tests<33>();
+        _sweep_tests();
+        _raycast_tests();
+    }
+
+private:
+    template<int Width, int Height>
+    class map_data
+    {
+
+    public:
+        void set_solid(int x, int y)
+        {
+            rows[(y * row_words) + (x / 32)] |= uint32_t(1) << (x % 32);
+            columns[(x * column_words) + (y / 32)] |= uint32_t(1) << (y % 32);
+        }
+
+        [[nodiscard]] bn::tile_collision_map map() const
+        {
+            return bn::tile_collision_map(rows[0], columns[0], bn::size(Width, Height));
+        }
+
+    private:
+        static constexpr int row_words = (Width + 31) / 32;
+        static constexpr int column_words = (Height + 31) / 32;
+
+        uint32_t rows[row_words * Height] = {};
+        uint32_t columns[column_words * Width] = {};
+    };
+
+    // Solid cells at the last column of the first row and at the first column of the second row:
+    template<int Width>
+    static void _word_boundary_tests()
+    {
+        map_data<Width, 2> data;
+        data.set_solid(Width - 1, 0);
+        data.set_solid(0, 1);
+
+        bn::tile_collision_map map = data.map();
+        BN_ASSERT(map.solid(Width - 1, 0) && ! map.solid(Width, 0), "Invalid width: ", Width);
+        BN_ASSERT(map.first_solid_in_row(0, 0, Width - 1) == Width - 1, "Invalid width: ", Width);
+        BN_ASSERT(map.last_solid_in_row(0, 0, Width - 1) == Width - 1, "Invalid width: ", Width);
+        BN_ASSERT(map.first_solid_in_row(0, 0, Width - 2) == -1, "Invalid width: ", Width);
+        BN_ASSERT(map.last_solid_in_row(1, 0, Width - 1) == 0, "Invalid width: ", Width);
+        BN_ASSERT(map.first_solid_in_row(1, 1, Width - 1) == -1, "Invalid width: ", Width);
+        BN_ASSERT(map.first_solid_in_column(Width - 1, 0, 1) == 0, "Invalid width: ", Width);
+        BN_ASSERT(map.last_solid_in_column(0, 0, 1) == 1, "Invalid width: ", Width);
+        BN_ASSERT(map.any_solid(Width - 1, 0, 8, 1), "Invalid width: ", Width);
+        BN_ASSERT(! map.any_solid(0, 0, Width - 1, 1), "Invalid width: ", Width);
+
+        // An 8x8 rectangle moving along the first row from its left end and along the second row from its right end:
+        BN_ASSERT(map.sweep_x(bn::rect(4, 4, 8, 8), 1000) == (Width - 2) * 8, "Invalid width: ", Width);
+        BN_ASSERT(map.sweep_x(bn::rect((Width * 8) + 4, 12, 8, 8), -1000) == 8 - (Width * 8),
+                  "Invalid width: ", Width);
+    }
+
+    static void _sweep_tests()
+    {
+        map_data<8, 4> data;
+        data.set_solid(0, 0);
+        data.set_solid(7, 0);
+
+        bn::tile_collision_map map = data.map();
+
+        // Sweeps which start outside of the map:
+        BN_ASSERT(map.sweep_x(bn::rect(-16, 4, 8, 8), 30) == 12);
+        BN_ASSERT(map.sweep_x(bn::rect(78, 4, 8, 8), -30) == -10);
+        BN_ASSERT(map.sweep_y(bn::rect(4, -26, 8, 8), 40) == 22);
+        BN_ASSERT(map.sweep_x(bn::rect(12, -20, 8, 8), 100) == 100);
+
+        // Sweeps which end outside of the map:
+        BN_ASSERT(map.sweep_x(bn::rect(12, 12, 8, 8), 100) == 100);
+        BN_ASSERT(map.sweep_x(bn::rect(12, 12, 8, 8), -100) == -100);
+        BN_ASSERT(map.sweep_y(bn::rect(28, 4, 8, 8), 100) == 100);
+        BN_ASSERT(map.sweep_y(bn::rect(28, 12, 8, 8), -100) == -100);
+    }
+
+    static void _raycast_tests()
+    {
+        // The segment crosses the corner shared by the cells (0, 0), (1, 0), (0, 1) and (1, 1),
+        // so it can't pass between the two diagonally adjacent solid cells:
+        map_data<4, 4> diagonal_data;
+        diagonal_data.set_solid(1, 0);
+        diagonal_data.set_solid(0, 1);
+
+        bn::tile_collision_map diagonal_map = diagonal_data.map();
+        bn::optional<bn::point> diagonal_result = diagonal_map.raycast(bn::point(4, 4), bn::point(20, 20));
+        BN_ASSERT(diagonal_result && *diagonal_result == bn::point(0, 1));
+
+        diagonal_result = diagonal_map.raycast(bn::point(12, 12), bn::point(3, 3));
+        BN_ASSERT(diagonal_result && *diagonal_result == bn::point(1, 0));
+
+        map_data<4, 4> anti_diagonal_data;
+        anti_diagonal_data.set_solid(0, 0);
+        anti_diagonal_data.set_solid(1, 1);
+
+        bn::tile_collision_map anti_diagonal_map = anti_diagonal_data.map();
+        diagonal_result = anti_diagonal_map.raycast(bn::point(11, 4), bn::point(4, 11));
+        BN_ASSERT(diagonal_result && *diagonal_result == bn::point(1, 1));
+
+        // The segment passes near a corner without crossing it:
+        map_data<4, 4> corner_data;
+        corner_data.set_solid(2, 1);
+
+        bn::tile_collision_map corner_map = corner_data.map();
+        BN_ASSERT(! corner_map.raycast(bn::point(22, 18), bn::point(29, 7)));
+
+        corner_data.set_solid(3, 2);
+        corner_map = corner_data.map();
+        BN_ASSERT(corner_map.raycast(bn::point(22, 18), bn::point(29, 7)) == bn::point(3, 2));
+
+        // The returned position is in cells, and segments can start outside of the map:
+        map_data<8, 1> row_data;
+        row_data.set_solid(7, 0);
+
+        bn::tile_collision_map row_map = row_data.map();
+        BN_ASSERT(row_map.raycast(bn::point(-12, 4), bn::point(80, 4)) == bn::point(7, 0));
+        BN_ASSERT(! row_map.raycast(bn::point(-12, 4), bn::point(50, 4)));
+    }
+};
+
+#endif
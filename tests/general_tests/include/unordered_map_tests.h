@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef UNORDERED_MAP_TESTS_H
+#define UNORDERED_MAP_TESTS_H
+
+#include "bn_array.h"
+#include "bn_unordered_map.h"
+#include "bn_unordered_set.h"
+#include "tests.h"
+
+class unordered_map_tests : public tests
+{
+
+public:
+    unordered_map_tests() :
+        tests("unordered_map")
+    {
+        // Erasing elements of collision chains which wrap around the end of the storage
+        // only keeps them findable and visited once with backward shift deletion:
+        #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+            _map_tests();
+            _set_tests();
+        #endif
+    }
+
+private:
+    class identity_hash
+    {
+
+    public:
+        [[nodiscard]] unsigned operator()(int value) const
+        {
+            return unsigned(value);
+        }
+    };
+
+    using map_type = bn::unordered_map<int, int, 8, identity_hash>;
+    using set_type = bn::unordered_set<int, 8, identity_hash>;
+
+    // Keys 6, 14, 22 and 30 share the ideal index 6 of a table of 8 elements, so their chain wraps around its end:
+    static constexpr bn::array<int, 5> keys = { 6, 14, 22, 30, 3 };
+
+    static void _map_tests()
+    {
+        map_type map;
+
+        for(int key : keys)
+        {
+            map.insert(key, key * 10);
+        }
+
+        _erase_map_key(6, map);
+        BN_ASSERT(map.size() == 4 && ! map.contains(6));
+
+        // The erased element is the last one of the storage:
+        _erase_map_key(22, map);
+        BN_ASSERT(map.size() == 3 && ! map.contains(22));
+
+        for(int key : { 14, 30, 3 })
+        {
+            BN_ASSERT(map.at(key) == key * 10, "Invalid key: ", key);
+        }
+
+        map.clear();
+
+        for(int key : keys)
+        {
+            map.insert(key, key * 10);
+        }
+
+        bn::array<int, 32> visits = {};
+        int erased_count = erase_if(map, [&visits](const map_type::value_type& value)
+        {
+            ++visits[value.first];
+            return value.first == 6 || value.first == 22;
+        });
+
+        BN_ASSERT(erased_count == 2);
+        _check_visits(visits);
+
+        for(int key : { 14, 30, 3 })
+        {
+            BN_ASSERT(map.at(key) == key * 10, "Invalid key: ", key);
+        }
+    }
+
+    static void _set_tests()
+    {
+        set_type set;
+
+        for(int key : keys)
+        {
+            set.insert(key);
+        }
+
+        _erase_set_key(6, set);
+        _erase_set_key(22, set);
+        BN_ASSERT(set.size() == 3 && ! set.contains(6) && ! set.contains(22));
+        BN_ASSERT(set.contains(14) && set.contains(30) && set.contains(3));
+
+        set.clear();
+
+        for(int key : keys)
+        {
+            set.insert(key);
+        }
+
+        bn::array<int, 32> visits = {};
+        int erased_count = erase_if(set, [&visits](int key)
+        {
+            ++visits[key];
+            return key == 6 || key == 22;
+        });
+
+        BN_ASSERT(erased_count == 2);
+        _check_visits(visits);
+        BN_ASSERT(set.contains(14) && set.contains(30) && set.contains(3));
+    }
+
+    // Each element must be visited once while the given key is erased:
+    static void _erase_map_key(int erased_key, map_type& map)
+    {
+        bn::array<int, 32> visits = {};
+
+        for(auto it = map.begin(), end = map.end(); it != end; )
+        {
+            ++visits[it->first];
+
+            if(it->first == erased_key)
+            {
+                it = map.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        _check_visits(visits);
+    }
+
+    static void _erase_set_key(int erased_key, set_type& set)
+    {
+        bn::array<int, 32> visits = {};
+
+        for(auto it = set.begin(), end = set.end(); it != end; )
+        {
+            ++visits[*it];
+
+            if(*it == erased_key)
+            {
+                it = set.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        _check_visits(visits);
+    }
+
+    static void _check_visits(const bn::array<int, 32>& visits)
+    {
+        for(int key = 0; key < 32; ++key)
+        {
+            BN_ASSERT(visits[key] <= 1, "Element visited more than once: ", key);
+        }
+    }
+};
+
+#endif
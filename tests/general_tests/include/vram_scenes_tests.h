@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef VRAM_SCENES_TESTS_H
+#define VRAM_SCENES_TESTS_H
+
+#include "bn_core.h"
+#include "bn_size.h"
+#include "bn_array.h"
+#include "bn_bg_palette_ptr.h"
+#include "bn_bg_palette_item.h"
+#include "bn_regular_bg_map_ptr.h"
+#include "bn_regular_bg_tiles_ptr.h"
+#include "bn_vram_scenes_allocated_bgs.h"
+#include "tests.h"
+
+class vram_scenes_tests : public tests
+{
+
+public:
+    vram_scenes_tests() :
+        tests("vram_scenes")
+    {
+        // Release the items of previous tests:
+        bn::core::update();
+
+        // Same items as scenes/allocated_bgs.json, created in the same order:
+        bn::color colors[16];
+        bn::bg_palette_ptr palette = bn::bg_palette_ptr::create_new(bn::bg_palette_item(colors, bn::bpp_mode::BPP_4));
+        bn::regular_bg_tiles_ptr small_tiles = bn::regular_bg_tiles_ptr::allocate(64, bn::bpp_mode::BPP_4);
+        bn::regular_bg_tiles_ptr big_tiles = bn::regular_bg_tiles_ptr::allocate(1024, bn::bpp_mode::BPP_4);
+        bn::regular_bg_map_ptr small_map = bn::regular_bg_map_ptr::allocate(bn::size(32, 32), small_tiles, palette);
+        bn::regular_bg_map_ptr big_map = bn::regular_bg_map_ptr::allocate(bn::size(64, 64), small_tiles, palette);
+
+        bn::array<char, 32> layout;
+        layout.fill('.');
+        _fill_layout(small_tiles.id(), small_tiles.tiles_count() * 32, 'T', layout);
+        _fill_layout(big_tiles.id(), big_tiles.tiles_count() * 32, 'T', layout);
+        _fill_layout(small_map.id(), small_map.dimensions().width() * small_map.dimensions().height() * 2, 'M',
+                     layout);
+        _fill_layout(big_map.id(), big_map.dimensions().width() * big_map.dimensions().height() * 2, 'M', layout);
+
+        // Alignment padding blocks are free at runtime:
+        bn::string_view simulated_layout = bn::vram_scenes::allocated_bgs_bg_blocks_layout;
+        BN_ASSERT(simulated_layout.size() == layout.size());
+
+        for(int block = 0, limit = layout.size(); block < limit; ++block)
+        {
+            char simulated_block = simulated_layout[block] == '_' ? '.' : simulated_layout[block];
+            BN_ASSERT(layout[block] == simulated_block, "Layout mismatch: ", block);
+        }
+    }
+
+private:
+    static void _fill_layout(int first_block, int bytes, char block_character, bn::array<char, 32>& layout)
+    {
+        int blocks = (bytes + 2047) / 2048;
+
+        for(int block = first_block; block < first_block + blocks; ++block)
+        {
+            layout[block] = block_character;
+        }
+    }
+};
+
+#endif
@@ -18,9 +18,20 @@
 #include "sqrt_tests.h"
 #include "optional_tests.h"
 #include "any_tests.h"
+#include "function_tests.h"
 #include "format_tests.h"
+#include "flat_map_tests.h"
+#include "unordered_map_tests.h"
+#include "spsc_queue_tests.h"
+#include "ecs_tests.h"
+#include "tile_collision_map_tests.h"
 #include "memory_tests.h"
 #include "sram_tests.h"
+#include "regular_bg_map_tests.h"
+#include "bitmap_bg_tests.h"
+#include "bg_blocks_tests.h"
+#include "vram_scenes_tests.h"
+#include "streamed_bg_tiles_tests.h"
 
 #if ! BN_CFG_ASSERT_ENABLED
     static_assert(false, "Enable asserts in bn_config_assert.h to run tests");
@@ -32,6 +43,9 @@ int main()
 
     int used_stack_iwram = bn::memory::used_stack_iwram();
 
+    // Bitmap BGs overlap the first sprite tiles, so they must be tested before creating any sprite:
+    bitmap_bg_tests();
+
     bn::sprite_text_generator text_generator(common::variable_8x16_sprite_font);
     text_generator.set_center_alignment();
 
@@ -45,8 +59,18 @@ int main()
     sqrt_tests();
     optional_tests();
     any_tests();
+    function_tests();
     format_tests();
+    flat_map_tests();
+    unordered_map_tests();
+    spsc_queue_tests();
+    ecs_tests();
+    tile_collision_map_tests();
     memory_tests memory_tests(used_stack_iwram);
+    regular_bg_map_tests();
+    bg_blocks_tests();
+    vram_scenes_tests();
+    streamed_bg_tiles_tests();
     sram_tests sram_tests;
 
     if(sram_tests.again())
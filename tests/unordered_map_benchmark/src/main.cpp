@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_core.h"
+#include "bn_log.h"
+#include "bn_timer.h"
+#include "bn_colors.h"
+#include "bn_random.h"
+#include "bn_string.h"
+#include "bn_sstream.h"
+#include "bn_bg_palettes.h"
+#include "bn_unordered_map.h"
+#include "bn_sprite_text_generator.h"
+
+#include "common_info.h"
+#include "common_variable_8x16_sprite_font.h"
+
+// Build with USERFLAGS := -DBN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED=true to benchmark Robin Hood hashing.
+
+namespace
+{
+    constexpr int max_size = 1024;
+    constexpr int lookups = 1024;
+
+    struct context_type
+    {
+        bn::unordered_map<unsigned, int, max_size> map;
+        bn::vector<unsigned, max_size> keys;
+    };
+
+    void benchmark(context_type& context, int load_factor, int& hit_ticks, int& miss_ticks)
+    {
+        bn::unordered_map<unsigned, int, max_size>& map = context.map;
+        bn::vector<unsigned, max_size>& keys = context.keys;
+        bn::random random;
+        int size = max_size * load_factor / 100;
+        map.clear();
+
+        // Even keys are inserted, so odd keys are always missing:
+
+        while(map.size() < size)
+        {
+            map.insert(random.get() & ~1U, 0);
+        }
+
+        keys.clear();
+
+        for(const auto& key_value_pair : map)
+        {
+            keys.push_back(key_value_pair.first);
+        }
+
+        int found_count = 0;
+        bn::timer timer;
+
+        for(int index = 0; index < lookups; ++index)
+        {
+            found_count += map.contains(keys[index % size]);
+        }
+
+        hit_ticks = timer.elapsed_ticks() / lookups;
+        timer.restart();
+
+        for(int index = 0; index < lookups; ++index)
+        {
+            found_count += map.contains(random.get() | 1U);
+        }
+
+        miss_ticks = timer.elapsed_ticks() / lookups;
+        BN_ASSERT(found_count == lookups, "Invalid found count: ", found_count);
+    }
+}
+
+int main()
+{
+    bn::core::init();
+
+    bn::sprite_text_generator text_generator(common::variable_8x16_sprite_font);
+    bn::bg_palettes::set_transparent_color(bn::colors::gray);
+
+    constexpr int load_factors[] = { 25, 50, 75, 90, 98 };
+    constexpr int results_count = int(sizeof(load_factors) / sizeof(int)) + 1;
+    bn::vector<bn::string<32>, results_count> results;
+    results.push_back("Ticks per lookup (hit, miss):");
+
+    auto context = new context_type();
+
+    for(int load_factor : load_factors)
+    {
+        int hit_ticks;
+        int miss_ticks;
+        benchmark(*context, load_factor, hit_ticks, miss_ticks);
+        BN_LOG("Load factor: ", load_factor, "% - hit: ", hit_ticks, " - miss: ", miss_ticks);
+
+        bn::string<32>& result = results.emplace_back();
+        bn::ostringstream result_stream(result);
+        result_stream << load_factor << "%: " << hit_ticks << ", " << miss_ticks;
+    }
+
+    delete context;
+
+    bn::string_view info_text_lines[results_count];
+
+    for(int index = 0; index < results_count; ++index)
+    {
+        info_text_lines[index] = results[index];
+    }
+
+    #if BN_CFG_UNORDERED_CONTAINERS_ROBIN_HOOD_ENABLED
+        constexpr bn::string_view title = "Robin Hood benchmark";
+    #else
+        constexpr bn::string_view title = "Linear probing benchmark";
+    #endif
+
+    common::info info(title, info_text_lines, text_generator);
+    info.set_show_always(true);
+
+    while(true)
+    {
+        info.update();
+        bn::core::update();
+    }
+}